@@ -165,6 +165,58 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoall.
+ *
+ * \param sendbuf The buffer containing the data to be sent to each unit.
+ * \param recvbuf The buffer to hold the data received from each unit.
+ * \param nelem   Number of values sent to and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the alltoall.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI alltoallv.
+ *
+ * \param sendbuf     The buffer containing the data to be sent to each unit.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the alltoallv.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI allreduce.
  *
@@ -213,6 +265,33 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI_Exscan.
+ *
+ * Unit \c i receives the element-wise reduction of the values in
+ * \c sendbuf of units \c 0 to \c i-1 in \c recvbuf, combined in order of
+ * unit ids. The content of \c recvbuf is undefined at unit 0.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the result of the prefix reduction in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team) DART_NOTHROW;
+
 /** \} */
 
 /**
@@ -519,6 +598,98 @@ dart_ret_t dart_put_handle(
   dart_datatype_t   dst_type,
   dart_handle_t   * handle) DART_NOTHROW;
 
+/**
+ * 'HANDLE' variant of dart_accumulate.
+ * Neither local nor remote completion is guaranteed. The buffer \c values
+ * may be reused after local completion, i.e. after \c dart_wait_local or
+ * successful \c dart_test_local. A later \c dart_wait*() call or a
+ * flush operation is needed to guarantee remote completion.
+ *
+ * DART Equivalent to MPI_Raccumulate.
+ *
+ * \param gptr    A global pointer determining the target of the accumulate
+ *                operation.
+ * \param values  The local buffer holding the elements to accumulate.
+ * \param nelem   The number of local elements to accumulate per unit.
+ * \param dtype   The data type to use in the accumulate operation \c op.
+ * \param op      The accumulation operation to perform.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_accumulate_handle(
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_handle_t  * handle) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of dart_fetch_and_op.
+ * The value before the update is available in \c result after local
+ * completion of the operation, i.e. after \c dart_wait_local,
+ * \c dart_wait or successful \c dart_test_local.
+ *
+ * DART Equivalent to MPI_Rget_accumulate on a single element.
+ *
+ * \param gptr    A global pointer determining the target of the fetch-and-op
+ *                operation.
+ * \param value   Pointer to an element of type \c dtype to be involved in
+ *                operation \c op on the value referenced by \c gptr.
+ * \param result  Pointer to an element of type \c dtype to hold the value of
+ *                the element referenced by \c gptr before the operation
+ *                \c op.
+ * \param dtype   The data type to use in the operation \c op.
+ * \param op      The operation to perform.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_fetch_and_op_handle(
+  dart_gptr_t      gptr,
+  const void     * value,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_handle_t  * handle) DART_NOTHROW;
+
+/**
+ * 'HANDLE' variant of dart_bcast.
+ * The buffer \c buf may not be accessed before the operation completed,
+ * i.e. after \c dart_wait or successful \c dart_test.
+ *
+ * DART Equivalent to MPI_Ibcast. All units in \c team have to start
+ * non-blocking collective operations on the team in the same order.
+ *
+ * \param buf    Buffer that is the source (on \c root) or the destination
+ *               of the broadcast.
+ * \param nelem  The number of values to broadcast/receive.
+ * \param dtype  The data type of values in \c buf.
+ * \param root   The unit that broadcasts data to all other members in
+ *               \c team
+ * \param team   The team to participate in the broadcast.
+ * \param[out] handle Pointer to DART handle to instantiate for later use with \c dart_wait, \c dart_wait_all etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_bcast_handle(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
 /**
  * Wait for the local and remote completion of an operation.
  *
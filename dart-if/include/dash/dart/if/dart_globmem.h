@@ -159,6 +159,26 @@ dart_ret_t dart_gptr_getaddr(
   const dart_gptr_t    gptr,
         void        ** addr) DART_NOTHROW;
 
+/**
+ * Get a memory address for the specified global pointer \c gptr that can
+ * be accessed directly by the calling unit. This is the case if \c gptr
+ * has affinity to the calling unit or to a unit on the same node that
+ * shares the memory of the segment with the calling unit.
+ *
+ * \param      gptr Global pointer
+ * \param[out] addr Pointer to a pointer that will hold the address of the
+ *                  memory element referenced by \c gptr, or \c NULL if the
+ *                  element cannot be accessed directly.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_gptr_getaddr_shared(
+  const dart_gptr_t    gptr,
+        void        ** addr) DART_NOTHROW;
+
 /**
  * Set the local memory address for the specified global pointer such
  * the the specified address.
@@ -256,6 +276,11 @@ dart_ret_t dart_gptr_setflags(
  * address space of the calling unit and returns a global pointer to it.
  * This is *not* a collective function.
  *
+ * Memory is allocated from a pool that is reserved in \c dart_init, see
+ * \c dart_config_t::local_alloc_size. Once the pool is exhausted, it
+ * grows by memory that other units on the same node do not access
+ * through shared memory.
+ *
  * \param nelem The number of elements of type \c dtype to allocate.
  * \param dtype The type to use.
  * \param[out] gptr Global Pointer to hold the allocation
@@ -286,6 +311,59 @@ dart_ret_t dart_memalloc(
  */
 dart_ret_t dart_memfree(dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Usage statistics of the pool of memory used by \ref dart_memalloc at
+ * the calling unit.
+ *
+ * Small allocations are served from slabs of objects of equal size class,
+ * so \c bytes_used includes rounding to the size class and
+ * \c bytes_reserved - \c bytes_used is the memory lost to internal
+ * fragmentation and unused slab capacity. A \c bytes_largest_free much
+ * smaller than \c pool_size - \c bytes_reserved indicates external
+ * fragmentation of the pool.
+ *
+ * \ingroup DartGlobMem
+ */
+typedef struct
+{
+  /// The size of the local allocation pool in bytes.
+  size_t pool_size;
+  /// The number of bytes in live allocations, including rounding.
+  size_t bytes_used;
+  /// The number of bytes reserved in the pool by slabs and large
+  /// allocations.
+  size_t bytes_reserved;
+  /// The maximum number of bytes reserved in the pool at any time.
+  size_t bytes_reserved_peak;
+  /// The size of the largest contiguous free chunk in the pool.
+  size_t bytes_largest_free;
+  /// The number of live allocations.
+  size_t num_allocs;
+  /// The number of slabs reserved for small allocations.
+  size_t num_slabs;
+  /// The number of memory regions of the pool, greater than 1 if the
+  /// pool has grown beyond its initial size.
+  size_t num_regions;
+} dart_memalloc_stats_t;
+
+/**
+ * Query usage statistics of the pool of memory used by
+ * \ref dart_memalloc at the calling unit, e.g. to determine the pool size
+ * required by an application.
+ * This is *not* a collective function.
+ *
+ * Not supported by the shmem backend, which logs an error, sets all
+ * fields of \c stats to 0 and returns \c DART_ERR_OTHER.
+ *
+ * \param[out] stats Usage statistics of the local allocation pool.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_memalloc_stats(dart_memalloc_stats_t *stats) DART_NOTHROW;
+
 /**
  * Collective function on the specified team to allocate \c nelem elements
  * of type \c dtype of memory in each unit's global address space with a
@@ -25,6 +25,14 @@ extern "C" {
  * Lock type to ensure mutual exclusion among units in a team.
  * The lock is thread-aware so only one thread of a unit can acquire
  * the lock at once.
+ *
+ * The lock is hierarchical: units on the same node are queued in a
+ * node-local lock and only one unit per node competes for the lock
+ * across nodes. A released lock is preferably handed to waiting units on
+ * the same node, at most \c DART_LOCK_HANDOFF_MAX times in a row before it
+ * is passed on to the next node. The bound can be set in the environment
+ * variable \c DART_LOCK_HANDOFF_MAX at the time the lock is initialized,
+ * a value of 0 disables node-local handoffs.
  * \ingroup DartSync
  */
 typedef struct dart_lock_struct *dart_lock_t;
@@ -109,6 +117,142 @@ dart_ret_t dart_lock_release(
   dart_lock_t   lock)   DART_NOTHROW;
 
 
+/**
+ * Reader-writer lock type to ensure mutual exclusion of writers among
+ * units in a team while readers may hold the lock concurrently.
+ *
+ * Writers take priority: once a writer waits for the lock, units trying
+ * to acquire it for reading wait until the writer released it. Writers
+ * are served in the order of the underlying \ref dart_lock_t, so a
+ * waiting writer only waits for readers that held the lock when it
+ * arrived and for the writers queued before it.
+ *
+ * \ingroup DartSync
+ */
+typedef struct dart_rwlock_struct *dart_rwlock_t;
+
+/**
+ * Collective operation to initialize the reader-writer lock \c lock.
+ *
+ * \param teamid Team this lock is used for.
+ * \param lock   The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_init(
+  dart_team_t     teamid,
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Collective operation to destroy a reader-writer lock initialized using
+ * \ref dart_team_rwlock_init.
+ *
+ * \param lock   The \c lock to free.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_destroy(
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Block until \c lock was acquired for reading.
+ *
+ * The lock can be held for reading by any number of threads in any
+ * units of the team at once.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire_read(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire \c lock for reading and return immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire_read(
+  dart_rwlock_t   lock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Release \c lock acquired through \ref dart_rwlock_acquire_read or
+ * \ref dart_rwlock_try_acquire_read.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release_read(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Block until \c lock was acquired for writing.
+ *
+ * The lock can be held for writing by only one thread in the team and
+ * not concurrently with readers.
+ *
+ * Note that the lock is not recursive, trying to acquire the lock twice
+ * in the same thread is erroneous.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire_write(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire \c lock for writing and return immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire_write(
+  dart_rwlock_t   lock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Release \c lock acquired through \ref dart_rwlock_acquire_write or
+ * \ref dart_rwlock_try_acquire_write.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release_write(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
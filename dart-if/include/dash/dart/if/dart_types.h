@@ -11,6 +11,7 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -59,37 +60,61 @@ enum {
 
 /**
  * Operations to be used for certain RMA and collective operations.
+ *
+ * Values other than the predefined operations \c DART_OP_* are handles of
+ * user-defined operations created by \ref dart_op_create.
+ *
  * \ingroup DartTypes
  */
-typedef enum
-{
-  /** Undefined, do not use */
-  DART_OP_UNDEFINED = 0,
-  /** Minimum */
-  DART_OP_MIN,
-  /** Maximum */
-  DART_OP_MAX,
-  /** Summation */
-  DART_OP_SUM,
-  /** Product */
-  DART_OP_PROD,
-  /** Binary AND */
-  DART_OP_BAND,
-  /** Logical AND */
-  DART_OP_LAND,
-  /** Binary OR */
-  DART_OP_BOR,
-  /** Logical OR */
-  DART_OP_LOR,
-  /** Binary XOR */
-  DART_OP_BXOR,
-  /** Logical XOR */
-  DART_OP_LXOR,
-  /** Replace Value */
-  DART_OP_REPLACE,
-  /** No operation */
-  DART_OP_NO_OP
-} dart_operation_t;
+typedef intptr_t dart_operation_t;
+
+/** Undefined, do not use */
+#define DART_OP_UNDEFINED (dart_operation_t)(0)
+/** Minimum */
+#define DART_OP_MIN       (dart_operation_t)(1)
+/** Maximum */
+#define DART_OP_MAX       (dart_operation_t)(2)
+/** Summation */
+#define DART_OP_SUM       (dart_operation_t)(3)
+/** Product */
+#define DART_OP_PROD      (dart_operation_t)(4)
+/** Binary AND */
+#define DART_OP_BAND      (dart_operation_t)(5)
+/** Logical AND */
+#define DART_OP_LAND      (dart_operation_t)(6)
+/** Binary OR */
+#define DART_OP_BOR       (dart_operation_t)(7)
+/** Logical OR */
+#define DART_OP_LOR       (dart_operation_t)(8)
+/** Binary XOR */
+#define DART_OP_BXOR      (dart_operation_t)(9)
+/** Logical XOR */
+#define DART_OP_LXOR      (dart_operation_t)(10)
+/** Replace Value */
+#define DART_OP_REPLACE   (dart_operation_t)(11)
+/** No operation */
+#define DART_OP_NO_OP     (dart_operation_t)(12)
+/** Reserved, do not use! */
+#define DART_OP_LAST      (dart_operation_t)(13)
+
+/**
+ * Signature of user-defined reduce operations, combining the \c len
+ * elements in \c invec element-wise with the elements in \c inoutvec.
+ * Results are stored in \c inoutvec, with elements of \c invec as left
+ * operands.
+ *
+ * \param invec     The left operands of the operation.
+ * \param inoutvec  The right operands and the results of the operation.
+ * \param len       The number of elements in \c invec and \c inoutvec.
+ * \param userdata  The pointer passed to \ref dart_op_create.
+ *
+ * \ingroup DartTypes
+ */
+typedef void (*dart_operator_t)(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * userdata);
 
 /**
  * Raw data types supported by the DART interface.
@@ -687,6 +712,13 @@ dart_unit_locality_t;
 typedef struct
 {
   int log_enabled;
+  /**
+   * Initial size in bytes of the pool of memory used by
+   * \c dart_memalloc, read in \c dart_init. If 0, the size is taken from
+   * the environment variable \c DART_LOCAL_ALLOC_SIZE or set to a
+   * default of 16 MiB. The pool grows beyond its initial size on demand.
+   */
+  size_t local_alloc_size;
 }
 dart_config_t;
 
@@ -736,9 +768,58 @@ dart_type_create_indexed(
   const size_t      offset[],
   dart_datatype_t * newtype);
 
+/**
+ * Create a data type describing the \c ndim -dimensional block of extents
+ * \c subsizes at offset \c starts in an array of extents \c sizes,
+ * stored in row-major order. The number of elements copied using the
+ * resulting datatype has to be a multiple of the number of elements in the
+ * block. Consecutive blocks are located in consecutive arrays.
+ *
+ * Subarray types allow to transfer a tile of a multi-dimensional array in
+ * a single operation.
+ *
+ * \param      basetype The type of elements in the array.
+ * \param      ndim     The number of dimensions.
+ * \param      sizes    The extents of the array in every dimension.
+ * \param      subsizes The extents of the block in every dimension.
+ * \param      starts   The offsets of the block in every dimension.
+ * \param[out] newtype  The newly created data type.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_type_create_subarray(
+  dart_datatype_t   basetype,
+  int               ndim,
+  const size_t      sizes[],
+  const size_t      subsizes[],
+  const size_t      starts[],
+  dart_datatype_t * newtype);
+
+/**
+ * Create a data type of elements of \c num_bytes contiguous bytes, such as
+ * trivially copyable user-defined types. Elements of custom types can be
+ * used in all operations accepting basic types, except for atomic and
+ * reduce operations with predefined \c DART_OP_* operations.
+ *
+ * \param      num_bytes The size of an element in bytes.
+ * \param[out] newtype   The newly created data type.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_type_create_custom(
+  size_t            num_bytes,
+  dart_datatype_t * newtype);
+
 /**
  * Destroy a data type that was previously created using
- * \ref dart_type_create_strided or \ref dart_type_create_indexed.
+ * \ref dart_type_create_strided, \ref dart_type_create_indexed,
+ * \ref dart_type_create_subarray, or \ref dart_type_create_custom.
  *
  * Data types can be destroyed before pending operations using that type have
  * completed. However, after destruction a type may not be used to start
@@ -753,6 +834,46 @@ dart_type_create_indexed(
 dart_ret_t
 dart_type_destroy(dart_datatype_t *dart_type);
 
+/**
+ * Create a user-defined reduce operation on elements of type \c dtype
+ * that can be used in \ref dart_allreduce, \ref dart_reduce and
+ * \ref dart_exscan. User-defined operations cannot be used in atomic
+ * operations.
+ *
+ * The operation has to be associative. Results of non-commutative
+ * operations are combined in order of unit ids.
+ *
+ * \param      op        The function applying the operation.
+ * \param      userdata  Pointer passed to \c op on every invocation.
+ * \param      commute   Whether the operation is commutative.
+ * \param      dtype     The basic or custom type of the operands.
+ * \param[out] new_op    The newly created operation.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_op_create(
+  dart_operator_t    op,
+  void             * userdata,
+  bool               commute,
+  dart_datatype_t    dtype,
+  dart_operation_t * new_op);
+
+/**
+ * Destroy an operation that was previously created using
+ * \ref dart_op_create.
+ *
+ * \param      op  The operation to be destroyed.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_op_destroy(dart_operation_t *op);
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
@@ -12,6 +12,7 @@
 #include <dash/dart/base/macro.h>
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/mutex.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -25,10 +26,17 @@
  */
 #define MAX_CONTIG_ELEMENTS INT_MAX
 
+/**
+ * The maximum number of committed MPI vector types cached for a strided
+ * DART type, one for every distinct number of blocks transferred.
+ */
+#define DART_STRIDED_TYPE_CACHE_SIZE 8
+
 typedef enum {
   DART_KIND_BASIC = 0,
   DART_KIND_STRIDED,
-  DART_KIND_INDEXED
+  DART_KIND_INDEXED,
+  DART_KIND_SUBARRAY
 } dart_type_kind_t;
 
 typedef struct dart_datatype_struct {
@@ -49,11 +57,19 @@ typedef struct dart_datatype_struct {
       MPI_Datatype     max_type;
     } basic;
     /// used for DART_KIND_STRIDED
-    /// NOTE: the underlying MPI strided type is created dynamically based on
-    ///       the number of blocks required.
+    /// NOTE: the underlying MPI strided type depends on the number of blocks
+    ///       transferred. Types are created on first use and cached.
     struct {
       /// the stride between blocks of size \c num_elem
       int              stride;
+      /// the number of cached MPI vector types
+      int              num_cached;
+      /// the number of blocks of each cached MPI vector type
+      size_t           cached_num_blocks[DART_STRIDED_TYPE_CACHE_SIZE];
+      /// the cached, committed MPI vector types
+      MPI_Datatype     cached_mpi_types[DART_STRIDED_TYPE_CACHE_SIZE];
+      /// protects insertion of types into the cache
+      dart_mutex_t     mutex;
     } strided;
     /// used for DART_KIND_INDEXED
     struct {
@@ -66,12 +82,36 @@ typedef struct dart_datatype_struct {
       /// the number of blocks
       int              num_blocks;
     } indexed;
+    /// used for DART_KIND_SUBARRAY
+    struct {
+      /// the underlying MPI type
+      MPI_Datatype     mpi_type;
+      /// the number of dimensions
+      int              ndim;
+    } subarray;
   };
 } dart_datatype_struct_t;
 
 DART_INTERNAL
 extern dart_datatype_struct_t __dart_base_types[DART_TYPE_LAST];
 
+/**
+ * A user-defined reduce operation created by \ref dart_op_create.
+ */
+typedef struct dart_operation_struct {
+  /// the MPI operation invoking \c op
+  MPI_Op               mpi_op;
+  /// duplicate of the MPI type of the operands carrying this struct as
+  /// attribute, used in place of the operands' type in reductions
+  MPI_Datatype         mpi_type;
+  /// the DART type of the operands
+  dart_datatype_t      dtype;
+  /// the user-defined operation
+  dart_operator_t      op;
+  /// the pointer passed to \c op
+  void               * userdata;
+} dart_operation_struct_t;
+
 
 dart_ret_t
 dart__mpi__datatype_init() DART_INTERNAL;
@@ -79,7 +119,20 @@ dart__mpi__datatype_init() DART_INTERNAL;
 dart_ret_t
 dart__mpi__datatype_fini() DART_INTERNAL;
 
+DART_INLINE
+bool dart__mpi__op_iscustom(dart_operation_t dart_op) {
+  return (dart_op >= DART_OP_LAST);
+}
+
+DART_INLINE
+dart_operation_struct_t * dart__mpi__op_struct(dart_operation_t dart_op) {
+  return (dart_operation_struct_t *)dart_op;
+}
+
 DART_INLINE MPI_Op dart__mpi__op(dart_operation_t dart_op) {
+  if (dart__mpi__op_iscustom(dart_op)) {
+    return dart__mpi__op_struct(dart_op)->mpi_op;
+  }
   switch (dart_op) {
     case DART_OP_MIN     : return MPI_MIN;
     case DART_OP_MAX     : return MPI_MAX;
@@ -154,13 +207,43 @@ size_t dart__mpi__datatype_num_elem(dart_datatype_t dart_type) {
   return (dart__mpi__datatype_struct(dart_type)->num_elem);
 }
 
+/**
+ * Returns the MPI type of the operands of a reduction with \c dart_op on
+ * elements of the basic type \c dart_type. User-defined operations are
+ * applied on the duplicate of the operands' type they are attached to.
+ */
+DART_INLINE
+MPI_Datatype dart__mpi__op_datatype(
+  dart_operation_t dart_op,
+  dart_datatype_t  dart_type) {
+  return dart__mpi__op_iscustom(dart_op)
+           ? dart__mpi__op_struct(dart_op)->mpi_type
+           : dart__mpi__datatype_struct(dart_type)->basic.mpi_type;
+}
+
+/**
+ * Returns the committed MPI vector type for \c num_blocks blocks of the
+ * strided DART type. The type is owned by the DART type and must not be
+ * freed.
+ *
+ * Types are committed on first use and cached for up to
+ * \c DART_STRIDED_TYPE_CACHE_SIZE distinct numbers of blocks. Types for
+ * further block counts are created for the single transfer and have to be
+ * released using \ref dart__mpi__datatype_release_mpi.
+ */
 MPI_Datatype
-dart__mpi__create_strided_mpi(
+dart__mpi__strided_mpi(
   dart_datatype_t dart_type,
   size_t          num_blocks) DART_INTERNAL;
 
+/**
+ * Releases an MPI type obtained from \ref dart__mpi__datatype_convert_mpi
+ * unless it is owned by the DART type.
+ */
 void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type) DART_INTERNAL;
+dart__mpi__datatype_release_mpi(
+  dart_datatype_t   dart_type,
+  MPI_Datatype    * mpi_type) DART_INTERNAL;
 
 DART_INLINE
 void
@@ -178,13 +261,17 @@ dart__mpi__datatype_convert_mpi(
       break;
     case DART_KIND_STRIDED:
       *mpi_num_elem = 1;
-      *mpi_type     = dart__mpi__create_strided_mpi(
+      *mpi_type     = dart__mpi__strided_mpi(
                                       dart_type, dart_num_elem / dts->num_elem);
       break;
     case DART_KIND_INDEXED:
       *mpi_num_elem = dart_num_elem / dts->num_elem;
       *mpi_type     = dts->indexed.mpi_type;
       break;
+    case DART_KIND_SUBARRAY:
+      *mpi_num_elem = dart_num_elem / dts->num_elem;
+      *mpi_type     = dts->subarray.mpi_type;
+      break;
     default:
       // should not happen!
       DART_ASSERT_MSG(NULL, "Unknown DART type detected!");
@@ -193,6 +280,35 @@ dart__mpi__datatype_convert_mpi(
 
 char* dart__mpi__datatype_name(dart_datatype_t dart_type) DART_INTERNAL;
 
+/**
+ * Helper macro that checks whether the given operation is a predefined
+ * operation and errors out in case of an error.
+ */
+#define CHECK_IS_BUILTIN_OP(_op) \
+  do {                                                                        \
+    if (dart__unlikely(dart__mpi__op_iscustom(_op))) {                        \
+      DART_LOG_ERROR(                                                         \
+                 "%s ! User-defined operations not allowed in this operation",\
+                 __FUNCTION__);                                               \
+      return DART_ERR_INVAL;                                                  \
+    }                                                                         \
+  } while (0)
+
+/**
+ * Helper macro that checks whether a user-defined operation is applied on
+ * elements of the type it has been created for.
+ */
+#define CHECK_OP_DATATYPE(_op, _dtype) \
+  do {                                                                        \
+    if (dart__unlikely(dart__mpi__op_iscustom(_op) &&                         \
+                       dart__mpi__op_struct(_op)->dtype != (_dtype))) {       \
+      DART_LOG_ERROR(                                                         \
+                 "%s ! Operation has not been created for the given type",    \
+                 __FUNCTION__);                                               \
+      return DART_ERR_INVAL;                                                  \
+    }                                                                         \
+  } while (0)
+
 /**
  * Helper macro that checks whether the given type is a basic type
  * and errors out in case of an error.
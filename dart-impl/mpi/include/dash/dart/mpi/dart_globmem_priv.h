@@ -2,9 +2,17 @@
 #define DART__MPI__DART_GLOBMEM_PRIV_H__
 
 #include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_globmem.h>
 #include <mpi.h>
 
 /* Global object for one-sided communication on memory region allocated with 'local allocation'. */
 extern MPI_Win dart_win_local_alloc DART_INTERNAL;
 
+/**
+ * The window for one-sided communication on memory allocated with
+ * \c dart_memalloc at \c gptr. Offsets of such global pointers are
+ * displacements in the returned window.
+ */
+MPI_Win dart__mpi__memalloc_win(dart_gptr_t gptr) DART_INTERNAL;
+
 #endif /* DART__MPI__DART_GLOBMEM_PRIV_H__ */
@@ -0,0 +1,84 @@
+/**
+ * \file dart_localpool.h
+ *
+ * Growable pool of memory served by \c dart_memalloc.
+ *
+ * The pool starts with a region in a shared memory window that is created
+ * in \c dart_init and accessed through segment \c DART_SEGMENT_LOCAL with
+ * offsets relative to the region, so units on the same node access it
+ * with \c memcpy.
+ * The size of the initial region is taken from
+ * \c dart_config_t::local_alloc_size or the environment variable
+ * \c DART_LOCAL_ALLOC_SIZE and defaults to \c DART_LOCAL_ALLOC_SIZE bytes.
+ *
+ * Once the initial region is exhausted, the pool grows by extension
+ * regions that are attached to the dynamic window of \c DART_TEAM_ALL
+ * without involving other units. Extension regions are accessed through
+ * segment \c DART_SEGMENT_LOCAL_EXT with absolute addresses as offsets
+ * and use MPI RMA also for targets on the same node.
+ */
+
+#ifndef DART__MPI__DART_LOCALPOOL_H__
+#define DART__MPI__DART_LOCALPOOL_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/base/macro.h>
+
+/**
+ * Default size in bytes of the initial region of the pool.
+ */
+#define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
+
+/**
+ * Maximum size in bytes of the initial region of the pool.
+ */
+#define DART_LOCAL_ALLOC_SIZE_MAX (1024*1024*1024)
+
+/**
+ * Maximum size in bytes of extension regions shared by multiple
+ * allocations. Extension regions double in size up to this bound,
+ * allocations of more than half this size are served from dedicated
+ * regions.
+ */
+#define DART_LOCAL_ALLOC_EXT_SIZE_MAX (1024*1024*64)
+
+#define DART_LOCAL_ALLOC_SIZE_ENVSTR "DART_LOCAL_ALLOC_SIZE"
+
+/**
+ * The size in bytes of the initial region of the pool, a power of two.
+ */
+size_t dart__mpi__localpool_initial_size() DART_INTERNAL;
+
+/**
+ * Allocate \c nbytes bytes from the extension regions of the pool,
+ * adding a region if required.
+ *
+ * \return The address of the allocated memory as offset in segment
+ *         \c DART_SEGMENT_LOCAL_EXT, or <tt>(uint64_t)(-1)</tt> if no
+ *         memory could be allocated.
+ */
+uint64_t dart__mpi__localpool_ext_alloc(size_t nbytes) DART_INTERNAL;
+
+/**
+ * Return the memory allocated at \c offset in segment
+ * \c DART_SEGMENT_LOCAL_EXT to the pool.
+ *
+ * \return 0 on success, -1 if \c offset does not refer to an allocation.
+ */
+int dart__mpi__localpool_ext_free(uint64_t offset) DART_INTERNAL;
+
+/**
+ * Add the usage statistics of the extension regions to \c stats.
+ */
+void dart__mpi__localpool_ext_stats(
+  dart_memalloc_stats_t * stats) DART_INTERNAL;
+
+/**
+ * Detach and free all extension regions, called in \c dart_exit.
+ */
+void dart__mpi__localpool_ext_fini() DART_INTERNAL;
+
+#endif /* DART__MPI__DART_LOCALPOOL_H__ */
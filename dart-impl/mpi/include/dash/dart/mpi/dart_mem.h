@@ -52,9 +52,16 @@ size_t dart_buddy_alloc(struct dart_buddy *, size_t size) DART_INTERNAL;
 int dart_buddy_free(struct dart_buddy *, uint64_t offset) DART_INTERNAL;
 
 /**
- * ???
+ * The size in bytes of the memory chunk allocated at the given offset,
+ * or 0 if no allocation starts at the offset.
  */
-int buddy_size(struct dart_buddy *, uint64_t offset) DART_INTERNAL;
+size_t dart_buddy_size(struct dart_buddy *, uint64_t offset) DART_INTERNAL;
+
+/**
+ * The size in bytes of the largest memory chunk that can currently be
+ * allocated.
+ */
+size_t dart_buddy_largest_free(struct dart_buddy *) DART_INTERNAL;
 void buddy_dump(struct dart_buddy *) DART_INTERNAL;
 
 #endif
@@ -12,10 +12,23 @@
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/base/macro.h>
+#include <dash/dart/base/logging.h>
 
 typedef int16_t dart_segid_t;
 
-#define DART_SEGMENT_HASH_SIZE 256
+/**
+ * Initial number of entries in the segment tables of a team, the tables
+ * grow on demand.
+ */
+#define DART_SEGMENT_TABLE_INIT_SIZE 32
+
+/**
+ * ID of the segment containing the regions by which the local allocation
+ * pool of \c dart_memalloc grows beyond its initial shared memory region,
+ * see \c dart_localpool.h.
+ * The ID is reserved in the range of registered segments of every team.
+ */
+#define DART_SEGMENT_LOCAL_EXT ((dart_segid_t)-1)
 
 typedef struct
 {
@@ -31,13 +44,24 @@ typedef struct
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
-typedef struct dart_seghash_elem dart_seghash_elem_t;
+typedef struct dart_segment_elem dart_segment_elem_t;
 
 typedef struct {
-  dart_seghash_elem_t * hashtab[DART_SEGMENT_HASH_SIZE];
-  dart_team_t           team_id;
-  dart_seghash_elem_t * mem_freelist;
-  dart_seghash_elem_t * reg_freelist;
+  /**
+   * Segments with non-negative IDs (allocated segments and the local
+   * allocation segment), indexed by segment ID.
+   */
+  dart_segment_info_t ** mem_tab;
+  /**
+   * Registered segments with negative IDs, indexed by the negated
+   * segment ID.
+   */
+  dart_segment_info_t ** reg_tab;
+  int                    mem_tab_size;
+  int                    reg_tab_size;
+  dart_team_t            team_id;
+  dart_segment_elem_t  * mem_freelist;
+  dart_segment_elem_t  * reg_freelist;
 
   /**
    * For DART collective allocation/free: offset in the returned gptr
@@ -54,13 +78,14 @@ typedef struct {
 
 typedef enum {
   DART_SEGMENT_LOCAL_ALLOC,
+  DART_SEGMENT_LOCAL_ALLOC_EXT,
   DART_SEGMENT_ALLOC,
   DART_SEGMENT_REGISTER
 } dart_segment_type;
 
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment tables.
  */
 dart_ret_t dart_segment_init(
   dart_segmentdata_t *segdata,
@@ -85,11 +110,32 @@ dart_segment_register(
   dart_segment_info_t *seg) DART_INTERNAL;
 
 /**
- * Returns the segment info for the segment with ID \c segid.
+ * Returns the segment info for the segment with ID \c segid, or \c NULL
+ * if no such segment exists.
+ *
+ * Segment infos are stored in tables indexed by segment ID so the lookup
+ * on the communication path is a range check and a single load.
  */
+static inline
 dart_segment_info_t * dart_segment_get_info(
   dart_segmentdata_t *segdata,
-  dart_segid_t        segid) DART_INTERNAL;
+  dart_segid_t        segid)
+{
+  dart_segment_info_t * seginfo = NULL;
+  if (segid >= 0) {
+    if (segid < segdata->mem_tab_size) {
+      seginfo = segdata->mem_tab[segid];
+    }
+  } else if (-segid < segdata->reg_tab_size) {
+    seginfo = segdata->reg_tab[-segid];
+  }
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_segment_get_info : "
+                   "Invalid segment ID %i on team %i",
+                   segid, segdata->team_id);
+  }
+  return seginfo;
+}
 
 /**
  * Returns the segment's displacement at unit \c team_unit_id.
@@ -178,7 +224,7 @@ dart_ret_t dart_segment_free(
 
 
 /**
- * Clear the segment data hash table.
+ * Clear the segment tables.
  */
 dart_ret_t dart_segment_fini(dart_segmentdata_t *segdata) DART_INTERNAL;
 
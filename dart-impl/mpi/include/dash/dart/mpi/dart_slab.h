@@ -0,0 +1,81 @@
+/**
+ * \file dart_slab.h
+ *
+ * Size-class slab allocator serving small allocations in the local
+ * allocation pool used by \c dart_memalloc.
+ *
+ * Slabs of \c DART_SLAB_SIZE bytes are obtained from the buddy allocator
+ * and split into objects of a single size class. Every thread allocates
+ * from slabs it owns without synchronization. Objects freed by threads
+ * other than the owner are pushed to a lock-free free list of their slab
+ * and reclaimed by the owner. Allocations larger than
+ * \c DART_SLAB_MAX_OBJECT bytes are served by the buddy allocator.
+ */
+
+#ifndef DART_SLAB_H_
+#define DART_SLAB_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/base/macro.h>
+#include <dash/dart/mpi/dart_mem.h>
+
+/**
+ * The size of a slab in bytes. Must be a power of two so slabs are aligned
+ * to their size in the pool.
+ */
+#define DART_SLAB_SIZE        (64 * 1024)
+
+/**
+ * The largest allocation in bytes served from slabs.
+ */
+#define DART_SLAB_MAX_OBJECT  (4 * 1024)
+
+struct dart_slab_pool;
+extern struct dart_slab_pool * dart_localslabs DART_INTERNAL;
+
+/**
+ * Create a slab allocator for the pool of \c size bytes that is managed
+ * by the buddy allocator \c buddy.
+ */
+struct dart_slab_pool *
+dart_slab_pool_new(
+  struct dart_buddy * buddy,
+  size_t              size) DART_INTERNAL;
+
+/**
+ * Delete the given slab allocator instance. Does not delete the
+ * underlying buddy allocator.
+ */
+void dart_slab_pool_delete(struct dart_slab_pool * pool) DART_INTERNAL;
+
+/**
+ * Allocate \c nbytes bytes from the pool.
+ *
+ * \return The offset relative to the start of the pool where the allocated
+ *         memory begins, or <tt>(uint64_t)(-1)</tt> if the pool is
+ *         exhausted.
+ */
+uint64_t dart_slab_alloc(
+  struct dart_slab_pool * pool,
+  size_t                  nbytes) DART_INTERNAL;
+
+/**
+ * Return the memory allocated at \c offset to the pool.
+ *
+ * \return 0 on success, -1 if \c offset does not refer to an allocation.
+ */
+int dart_slab_free(
+  struct dart_slab_pool * pool,
+  uint64_t                offset) DART_INTERNAL;
+
+/**
+ * Query usage statistics of the pool.
+ */
+void dart_slab_stats(
+  struct dart_slab_pool * pool,
+  dart_memalloc_stats_t * stats) DART_INTERNAL;
+
+#endif /* DART_SLAB_H_ */
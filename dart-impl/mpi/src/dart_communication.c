@@ -324,12 +324,10 @@ dart__mpi__get_complex(
             win,
             reqs, num_reqs),
     "MPI_Rget");
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
-  }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
+  // clean-up strided data types not cached in the DART type
+  dart__mpi__datatype_release_mpi(src_type, &src_mpi_type);
+  if (src_type != dst_type) {
+    dart__mpi__datatype_release_mpi(dst_type, &dst_mpi_type);
   }
   return DART_OK;
 }
@@ -470,12 +468,10 @@ dart__mpi__put_complex(
             reqs, num_reqs),
     "MPI_Put");
 
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
-  }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
+  // clean-up strided data types not cached in the DART type
+  dart__mpi__datatype_release_mpi(src_type, &src_mpi_type);
+  if (src_type != dst_type) {
+    dart__mpi__datatype_release_mpi(dst_type, &dst_mpi_type);
   }
   return DART_OK;
 }
@@ -597,6 +593,7 @@ dart_ret_t dart_accumulate(
   dart_team_t teamid = gptr.teamid;
 
   CHECK_IS_BASICTYPE(dtype);
+  CHECK_IS_BUILTIN_OP(op);
   mpi_dtype          = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
   mpi_op             = dart__mpi__op(op);
 
@@ -684,6 +681,7 @@ dart_ret_t dart_fetch_and_op(
   dart_team_t teamid = gptr.teamid;
 
   CHECK_IS_BASICTYPE(dtype);
+  CHECK_IS_BUILTIN_OP(op);
   mpi_dtype          = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
   mpi_op             = dart__mpi__op(op);
 
@@ -931,6 +929,189 @@ dart_ret_t dart_put_handle(
   return ret;
 }
 
+dart_ret_t dart_accumulate_handle(
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_handle_t  * handleptr)
+{
+  MPI_Datatype mpi_dtype;
+  MPI_Op       mpi_op;
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t    offset = gptr.addr_or_offs.offset;
+  int16_t     seg_id = gptr.segid;
+  dart_team_t teamid = gptr.teamid;
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+  CHECK_IS_BUILTIN_OP(op);
+  mpi_dtype          = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  mpi_op             = dart__mpi__op(op);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_handle ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  DART_LOG_DEBUG("dart_accumulate_handle() nelem:%zu dtype:%d op:%d unit:%d",
+                 nelem, dtype, op, team_unit_id.id);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_handle ! "
+                   "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Win win = seginfo->win;
+  offset     += dart_segment_disp(seginfo, team_unit_id);
+
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->dest         = team_unit_id.id;
+  handle->win          = win;
+  handle->needs_flush  = true;
+
+  // chunk up the accumulate, at most two requests
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+  const char * src_ptr   = (const char*) values;
+
+  if (nchunks > 0) {
+    DART_LOG_TRACE("dart_accumulate_handle:  MPI_Raccumulate "
+                   "(src %p, size %zu)",
+                   src_ptr, nchunks * MAX_CONTIG_ELEMENTS);
+    CHECK_MPI_RET(
+      MPI_Raccumulate(
+          src_ptr,
+          nchunks,
+          dart__mpi__datatype_maxtype(dtype),
+          team_unit_id.id,
+          offset,
+          nchunks,
+          dart__mpi__datatype_maxtype(dtype),
+          mpi_op,
+          win,
+          &handle->reqs[handle->num_reqs++]),
+      "MPI_Raccumulate");
+    offset  += nchunks * MAX_CONTIG_ELEMENTS;
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+  }
+
+  if (remainder > 0) {
+    DART_LOG_TRACE("dart_accumulate_handle:  MPI_Raccumulate "
+                   "(src %p, size %zu)",
+                   src_ptr, remainder);
+    CHECK_MPI_RET(
+      MPI_Raccumulate(
+          src_ptr,
+          remainder,
+          mpi_dtype,
+          team_unit_id.id,
+          offset,
+          remainder,
+          mpi_dtype,
+          mpi_op,
+          win,
+          &handle->reqs[handle->num_reqs++]),
+      "MPI_Raccumulate");
+  }
+
+  if (handle->num_reqs == 0) {
+    free(handle);
+    handle = DART_HANDLE_NULL;
+  }
+
+  *handleptr = handle;
+
+  DART_LOG_DEBUG("dart_accumulate_handle > handle(%p)", (void*)(handle));
+  return DART_OK;
+}
+
+dart_ret_t dart_fetch_and_op_handle(
+  dart_gptr_t      gptr,
+  const void     * value,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_handle_t  * handleptr)
+{
+  MPI_Datatype mpi_dtype;
+  MPI_Op       mpi_op;
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t    offset = gptr.addr_or_offs.offset;
+  int16_t     seg_id = gptr.segid;
+  dart_team_t teamid = gptr.teamid;
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+  CHECK_IS_BUILTIN_OP(op);
+  mpi_dtype          = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  mpi_op             = dart__mpi__op(op);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_fetch_and_op_handle ! failed: Unknown team %i!",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_fetch_and_op_handle ! "
+                   "Unknown segment %i on team %i", seg_id, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  DART_LOG_DEBUG("dart_fetch_and_op_handle() dtype:%d op:%d unit:%d "
+                 "offset:%"PRIu64" segid:%d",
+                 dtype, op, team_unit_id.id,
+                 gptr.addr_or_offs.offset, seg_id);
+
+  MPI_Win win = seginfo->win;
+  offset     += dart_segment_disp(seginfo, team_unit_id);
+
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->dest         = team_unit_id.id;
+  handle->win          = win;
+  // completion of the request implies that the result has been received
+  handle->needs_flush  = false;
+
+  CHECK_MPI_RET(
+    MPI_Rget_accumulate(
+      value,             // Origin address
+      1,                 // Number of origin elements
+      mpi_dtype,         // Data type of origin buffer entries
+      result,            // Result address
+      1,                 // Number of result elements
+      mpi_dtype,         // Data type of result buffer entries
+      team_unit_id.id,   // Rank of target
+      offset,            // Displacement from start of window to beginning
+                         // of target buffer
+      1,                 // Number of target elements
+      mpi_dtype,         // Data type of target buffer entries
+      mpi_op,            // Reduce operation
+      win,
+      &handle->reqs[handle->num_reqs++]),
+    "MPI_Rget_accumulate");
+
+  *handleptr = handle;
+
+  DART_LOG_DEBUG("dart_fetch_and_op_handle > handle(%p)", (void*)(handle));
+  return DART_OK;
+}
+
 /* -- Blocking dart one-sided operations -- */
 
 /**
@@ -1642,6 +1823,64 @@ dart_ret_t dart_bcast(
   return DART_OK;
 }
 
+dart_ret_t dart_bcast_handle(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handleptr)
+{
+  DART_LOG_TRACE("dart_bcast_handle() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_bcast_handle ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  MPI_Comm comm = team_data->comm;
+
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->dest         = root.id;
+  handle->win          = MPI_WIN_NULL;
+  handle->needs_flush  = false;
+
+  // chunk up the bcast if necessary, one request per part
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+        char * src_ptr   = (char*) buf;
+
+  if (nchunks > 0) {
+    CHECK_MPI_RET(
+      MPI_Ibcast(src_ptr, nchunks,
+                 dart__mpi__datatype_maxtype(dtype),
+                 root.id, comm,
+                 &handle->reqs[handle->num_reqs++]),
+      "MPI_Ibcast");
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+  }
+
+  if (remainder > 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+    CHECK_MPI_RET(
+      MPI_Ibcast(src_ptr, remainder, mpi_dtype, root.id, comm,
+                 &handle->reqs[handle->num_reqs++]),
+      "MPI_Ibcast");
+  }
+
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_bcast_handle > root:%d team:%d nelem:%zu handle(%p)",
+                 root.id, teamid, nelem, (void*)(handle));
+  return DART_OK;
+}
+
 dart_ret_t dart_scatter(
   const void        * sendbuf,
   void              * recvbuf,
@@ -1908,6 +2147,122 @@ dart_ret_t dart_allgatherv(
   return DART_OK;
 }
 
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoall() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_alltoall ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoall ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  CHECK_MPI_RET(
+    MPI_Alltoall(
+        sendbuf,
+        nelem,
+        mpi_dtype,
+        recvbuf,
+        nelem,
+        mpi_dtype,
+        team_data->comm),
+    "MPI_Alltoall");
+
+  DART_LOG_TRACE("dart_alltoall > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  MPI_Comm comm      = team_data->comm;
+  int      comm_size = team_data->size;
+
+  // convert counts and displacements, MPI uses offset type int
+  int *isendcounts = malloc(sizeof(int) * comm_size * 4);
+  if (isendcounts == NULL) {
+    DART_LOG_ERROR("dart_alltoallv ! failed to allocate %d counts",
+                   comm_size * 4);
+    return DART_ERR_OTHER;
+  }
+  int *isenddispls = isendcounts + comm_size;
+  int *irecvcounts = isenddispls + comm_size;
+  int *irecvdispls = irecvcounts + comm_size;
+  for (int i = 0; i < comm_size; i++) {
+    if (nsendcounts[i] > MAX_CONTIG_ELEMENTS ||
+        senddispls[i]  > MAX_CONTIG_ELEMENTS ||
+        nrecvcounts[i] > MAX_CONTIG_ELEMENTS ||
+        recvdispls[i]  > MAX_CONTIG_ELEMENTS)
+    {
+      DART_LOG_ERROR(
+        "dart_alltoallv ! failed: counts or displacements of unit %i "
+        "> INT_MAX", i);
+      free(isendcounts);
+      return DART_ERR_INVAL;
+    }
+    isendcounts[i] = nsendcounts[i];
+    isenddispls[i] = senddispls[i];
+    irecvcounts[i] = nrecvcounts[i];
+    irecvdispls[i] = recvdispls[i];
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  if (MPI_Alltoallv(
+           sendbuf,
+           isendcounts,
+           isenddispls,
+           mpi_dtype,
+           recvbuf,
+           irecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    free(isendcounts);
+    return DART_ERR_INVAL;
+  }
+  free(isendcounts);
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  return DART_OK;
+}
+
 dart_ret_t dart_allreduce(
   const void       * sendbuf,
   void             * recvbuf,
@@ -1918,9 +2273,10 @@ dart_ret_t dart_allreduce(
 {
 
   CHECK_IS_BASICTYPE(dtype);
+  CHECK_OP_DATATYPE(op, dtype);
 
   MPI_Op       mpi_op    = dart__mpi__op(op);
-  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  MPI_Datatype mpi_dtype = dart__mpi__op_datatype(op, dtype);
 
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
@@ -1959,8 +2315,9 @@ dart_ret_t dart_reduce(
 {
   MPI_Comm     comm;
   CHECK_IS_BASICTYPE(dtype);
+  CHECK_OP_DATATYPE(op, dtype);
   MPI_Op       mpi_op    = dart__mpi__op(op);
-  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  MPI_Datatype mpi_dtype = dart__mpi__op_datatype(op, dtype);
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
@@ -1991,6 +2348,44 @@ dart_ret_t dart_reduce(
   return DART_OK;
 }
 
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
+{
+  CHECK_IS_BASICTYPE(dtype);
+  CHECK_OP_DATATYPE(op, dtype);
+  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Datatype mpi_dtype = dart__mpi__op_datatype(op, dtype);
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_exscan ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_exscan ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_MPI_RET(
+    MPI_Exscan(
+           sendbuf,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           mpi_op,
+           team_data->comm),
+    "MPI_Exscan");
+  return DART_OK;
+}
+
 dart_ret_t dart_send(
   const void         * sendbuf,
   size_t               nelem,
@@ -18,9 +18,11 @@
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_slab.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_localpool.h>
 
 #include <stdio.h>
 #include <mpi.h>
@@ -64,6 +66,40 @@ dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
   return DART_OK;
 }
 
+dart_ret_t dart_gptr_getaddr_shared(const dart_gptr_t gptr, void **addr)
+{
+  dart_team_unit_t myid;
+  dart_team_myid(gptr.teamid, &myid);
+
+  if (myid.id == gptr.unitid) {
+    return dart_gptr_getaddr(gptr, addr);
+  }
+
+  *addr = NULL;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown team %i", gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
+  if (gptr.segid >= 0 && luid.id >= 0) {
+    dart_segment_info_t *seginfo = dart_segment_get_info(
+                                     &team_data->segdata, gptr.segid);
+    if (seginfo == NULL) {
+      DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown segment %i",
+                     gptr.segid);
+      return DART_ERR_INVAL;
+    }
+    if (seginfo->baseptr != NULL && seginfo->baseptr[luid.id] != NULL) {
+      *addr = seginfo->baseptr[luid.id] + gptr.addr_or_offs.offset;
+    }
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return DART_OK;
+}
+
 dart_ret_t dart_gptr_setaddr(dart_gptr_t* gptr, void* addr)
 {
   int16_t segid = gptr->segid;
@@ -134,28 +170,39 @@ dart_ret_t dart_memalloc(
   gptr->flags   = 0;
   gptr->segid   = DART_SEGMENT_LOCAL; /* For local allocation, the segid is marked as '0'. */
   gptr->teamid  = DART_TEAM_ALL;      /* Locally allocated gptr belong to the global team. */
-  gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool, nbytes);
+  gptr->addr_or_offs.offset = dart_slab_alloc(dart_localslabs, nbytes);
+  if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
+    /* Initial region exhausted, grow the pool: */
+    gptr->segid = DART_SEGMENT_LOCAL_EXT;
+    gptr->addr_or_offs.offset = dart__mpi__localpool_ext_alloc(nbytes);
+  }
   if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
     DART_LOG_ERROR("dart_memalloc: Out of bounds "
-                   "(dart_buddy_alloc %zu bytes): global memory exhausted",
+                   "(dart_slab_alloc %zu bytes): global memory exhausted",
                    nbytes);
     *gptr = DART_GPTR_NULL;
     return DART_ERR_OTHER;
   }
-  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu offset:%"PRIu64"",
-                 nbytes, gptr->addr_or_offs.offset);
+  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu segid:%d "
+                 "offset:%"PRIu64"",
+                 nbytes, gptr->segid, gptr->addr_or_offs.offset);
   return DART_OK;
 }
 
 dart_ret_t dart_memfree (dart_gptr_t gptr)
 {
-  if (gptr.segid != DART_SEGMENT_LOCAL || gptr.teamid != DART_TEAM_ALL) {
+  if ((gptr.segid != DART_SEGMENT_LOCAL &&
+       gptr.segid != DART_SEGMENT_LOCAL_EXT) ||
+      gptr.teamid != DART_TEAM_ALL) {
     DART_LOG_ERROR("dart_memfree: invalid segment id:%d or team id:%d",
                    gptr.segid, gptr.teamid);
     return DART_ERR_INVAL;
   }
 
-  if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
+  int ret = (gptr.segid == DART_SEGMENT_LOCAL)
+            ? dart_slab_free(dart_localslabs, gptr.addr_or_offs.offset)
+            : dart__mpi__localpool_ext_free(gptr.addr_or_offs.offset);
+  if (ret == -1) {
     DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
                    "invalid offset: %"PRIu64"",
                    gptr.addr_or_offs.offset);
@@ -166,6 +213,27 @@ dart_ret_t dart_memfree (dart_gptr_t gptr)
   return DART_OK;
 }
 
+MPI_Win dart__mpi__memalloc_win(dart_gptr_t gptr)
+{
+  if (gptr.segid == DART_SEGMENT_LOCAL) {
+    return dart_win_local_alloc;
+  }
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  return team_data->window;
+}
+
+dart_ret_t dart_memalloc_stats(dart_memalloc_stats_t *stats)
+{
+  if (stats == NULL) {
+    DART_LOG_ERROR("dart_memalloc_stats ! stats may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  dart_slab_stats(dart_localslabs, stats);
+  stats->num_regions = 1;
+  dart__mpi__localpool_ext_stats(stats);
+  return DART_OK;
+}
+
 static dart_ret_t
 dart_team_memalloc_aligned_dynamic(
   dart_team_t       teamid,
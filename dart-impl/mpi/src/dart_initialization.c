@@ -14,13 +14,13 @@
 
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_slab.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
-
-#define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
+#include <dash/dart/mpi/dart_localpool.h>
 
 /* Point to the base address of memory region for local allocation. */
 static int _init_by_dart = 0;
@@ -29,7 +29,9 @@ static int _dart_initialized = 0;
 static
 dart_ret_t create_local_alloc(dart_team_data_t *team_data)
 {
-  dart_localpool = dart_buddy_new(DART_LOCAL_ALLOC_SIZE);
+  size_t pool_size = dart__mpi__localpool_initial_size();
+  dart_localpool  = dart_buddy_new(pool_size);
+  dart_localslabs = dart_slab_pool_new(dart_localpool, pool_size);
   MPI_Win dart_sharedmem_win_local_alloc;
   char* *dart_sharedmem_local_baseptr_set = NULL;
 
@@ -40,15 +42,15 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   MPI_Comm sharedmem_comm = team_data->sharedmem_comm;
 
   if (sharedmem_comm != MPI_COMM_NULL) {
-    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%d)",
-                   DART_LOCAL_ALLOC_SIZE);
+    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%zu)",
+                   pool_size);
     MPI_Info win_info;
     MPI_Info_create(&win_info);
     MPI_Info_set(win_info, "alloc_shared_noncontig", "true");
     /* Reserve a free shared memory block for non-collective
      * global memory allocation. */
     int ret = MPI_Win_allocate_shared(
-                DART_LOCAL_ALLOC_SIZE,
+                pool_size,
                 sizeof(char),
                 win_info,
                 sharedmem_comm,
@@ -92,7 +94,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   }
 #else
   MPI_Alloc_mem(
-    DART_LOCAL_ALLOC_SIZE,
+    pool_size,
     MPI_INFO_NULL,
     &dart_mempool_localalloc);
 #endif
@@ -103,7 +105,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
    * Return in dart_win_local_alloc. */
   MPI_Win_create(
     dart_mempool_localalloc,
-    DART_LOCAL_ALLOC_SIZE,
+    pool_size,
     sizeof(char),
     MPI_INFO_NULL,
     DART_COMM_WORLD,
@@ -121,7 +123,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
                                 &team_data->segdata, DART_SEGMENT_LOCAL_ALLOC);
   segment->flags       = 1;
   segment->segid       = 0;
-  segment->size        = DART_LOCAL_ALLOC_SIZE;
+  segment->size        = pool_size;
   segment->baseptr     = dart_sharedmem_local_baseptr_set;
   segment->win         = dart_win_local_alloc;
   segment->shmwin      = dart_sharedmem_win_local_alloc;
@@ -130,6 +132,19 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   segment->disp        = calloc(team_data->size, sizeof(MPI_Aint));
   segment->is_dynamic       = false;
 
+  /* Regions added to the pool on demand are attached to the dynamic
+   * window of DART_TEAM_ALL and addressed by absolute addresses. */
+  segment = dart_segment_alloc(
+              &team_data->segdata, DART_SEGMENT_LOCAL_ALLOC_EXT);
+  segment->flags       = 0;
+  segment->size        = 0;
+  segment->baseptr     = NULL;
+  segment->win         = team_data->window;
+  segment->shmwin      = MPI_WIN_NULL;
+  segment->selfbaseptr = NULL;
+  segment->disp        = NULL;
+  segment->is_dynamic  = true;
+
   return DART_OK;
 }
 
@@ -169,11 +184,6 @@ dart_ret_t do_init()
   MPI_Comm_rank(team_data->comm, &team_data->unitid);
   MPI_Comm_size(team_data->comm, &team_data->size);
 
-  ret = create_local_alloc(team_data);
-  if (ret != DART_OK) {
-    return ret;
-  }
-
   /* Create a dynamic win object for all the dart collective
    * allocation based on MPI_COMM_WORLD. Return in win. */
   MPI_Win win;
@@ -186,6 +196,12 @@ dart_ret_t do_init()
    * collective allocation function through win. */
   MPI_Win_lock_all(0, win);
 
+  /* The local allocation pool grows into the dynamic window. */
+  ret = create_local_alloc(team_data);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
   DART_LOG_DEBUG("dart_init: communication backend initialization finished");
 
   _dart_initialized = 1;
@@ -313,9 +329,11 @@ dart_ret_t dart_exit()
     MPI_Free_mem(dart_mempool_localalloc);
   }
 #endif
+  dart__mpi__localpool_ext_fini();
   MPI_Win_free(&team_data->window);
 
   dart_segment_fini(&team_data->segdata);
+  dart_slab_pool_delete(dart_localslabs);
   dart_buddy_delete(dart_localpool);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 //  free(team_data->sharedmem_tab);
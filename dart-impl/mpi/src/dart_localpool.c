@@ -0,0 +1,269 @@
+/**
+ * \file dart_localpool.c
+ *
+ * Extension regions of the local allocation pool.
+ *
+ * Extension regions are allocated with \c MPI_Alloc_mem and attached to
+ * the dynamic window of \c DART_TEAM_ALL, which does not require
+ * participation of other units. Regions shared by multiple allocations
+ * are managed by a buddy and slab allocator like the initial region and
+ * are kept until \c dart_exit. Allocations too large for a shared
+ * region are served from a dedicated region that is released once the
+ * allocation is freed.
+ */
+
+#include <dash/dart/mpi/dart_localpool.h>
+#include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_slab.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <dash/dart/base/mutex.h>
+#include <dash/dart/base/logging.h>
+
+#include <dash/dart/if/dart_config.h>
+#include <dash/dart/if/dart_team_group.h>
+
+#include <mpi.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+typedef struct dart_localpool_region
+{
+  struct dart_localpool_region * next;
+  char                         * base;
+  size_t                         size;
+  /** Allocators of shared regions, \c NULL for dedicated regions. */
+  struct dart_buddy            * buddy;
+  struct dart_slab_pool        * slabs;
+} dart_localpool_region_t;
+
+static dart_localpool_region_t * regions          = NULL;
+static size_t                    last_region_size = 0;
+static dart_mutex_t              regions_mutex    = DART_MUTEX_INITIALIZER;
+
+static size_t
+round_pow_of_2(size_t x)
+{
+  size_t p = 1;
+  while (p < x) {
+    p <<= 1;
+  }
+  return p;
+}
+
+/**
+ * Parse a size in bytes with an optional suffix K, M or G.
+ */
+static size_t
+parse_size(const char * str)
+{
+  char   * end;
+  unsigned long long value = strtoull(str, &end, 10);
+  if (end == str) {
+    return 0;
+  }
+  switch (*end) {
+    case 'K': value <<= 10; break;
+    case 'M': value <<= 20; break;
+    case 'G': value <<= 30; break;
+    case '\0':              break;
+    default:  return 0;
+  }
+  return (size_t)value;
+}
+
+size_t dart__mpi__localpool_initial_size()
+{
+  dart_config_t * config;
+  dart_config(&config);
+  size_t size = config->local_alloc_size;
+  if (size == 0) {
+    const char * envstr = getenv(DART_LOCAL_ALLOC_SIZE_ENVSTR);
+    if (envstr != NULL) {
+      size = parse_size(envstr);
+      if (size == 0) {
+        DART_LOG_WARN("dart_init: ignoring invalid value of %s: %s",
+                      DART_LOCAL_ALLOC_SIZE_ENVSTR, envstr);
+      }
+    }
+  }
+  if (size == 0) {
+    size = DART_LOCAL_ALLOC_SIZE;
+  }
+  if (size < DART_SLAB_SIZE) {
+    size = DART_SLAB_SIZE;
+  }
+  if (size > DART_LOCAL_ALLOC_SIZE_MAX) {
+    DART_LOG_WARN("dart_init: local allocation pool size %zu exceeds "
+                  "maximum of %d bytes", size, DART_LOCAL_ALLOC_SIZE_MAX);
+    size = DART_LOCAL_ALLOC_SIZE_MAX;
+  }
+  // the buddy allocator manages pools of power-of-two sizes
+  size = round_pow_of_2(size);
+  last_region_size = size;
+  return size;
+}
+
+static dart_localpool_region_t *
+region_new(size_t size, int shared)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  if (team_data == NULL) {
+    return NULL;
+  }
+  dart_localpool_region_t * region = calloc(1, sizeof(*region));
+  if (MPI_Alloc_mem(size, MPI_INFO_NULL, &region->base) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_memalloc: MPI_Alloc_mem(%zu) failed", size);
+    free(region);
+    return NULL;
+  }
+  if (MPI_Win_attach(team_data->window, region->base, size)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_memalloc: MPI_Win_attach(%zu) failed", size);
+    MPI_Free_mem(region->base);
+    free(region);
+    return NULL;
+  }
+  region->size = size;
+  if (shared) {
+    region->buddy = dart_buddy_new(size);
+    region->slabs = dart_slab_pool_new(region->buddy, size);
+  }
+  region->next = regions;
+  regions      = region;
+  DART_LOG_DEBUG("dart_memalloc: added %s region of %zu bytes at %p",
+                 shared ? "shared" : "dedicated", size, region->base);
+  return region;
+}
+
+static void
+region_delete(dart_localpool_region_t * region)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  if (team_data != NULL) {
+    MPI_Win_detach(team_data->window, region->base);
+  }
+  if (region->slabs != NULL) {
+    dart_slab_pool_delete(region->slabs);
+    dart_buddy_delete(region->buddy);
+  }
+  MPI_Free_mem(region->base);
+  free(region);
+}
+
+uint64_t dart__mpi__localpool_ext_alloc(size_t nbytes)
+{
+  uint64_t offset = (uint64_t)(-1);
+  dart__base__mutex_lock(&regions_mutex);
+
+  if (nbytes > DART_LOCAL_ALLOC_EXT_SIZE_MAX / 2) {
+    dart_localpool_region_t * region = region_new(nbytes, 0);
+    if (region != NULL) {
+      offset = (uint64_t)(uintptr_t)region->base;
+    }
+  } else {
+    for (dart_localpool_region_t * region = regions;
+         region != NULL && offset == (uint64_t)(-1);
+         region = region->next) {
+      if (region->slabs == NULL) {
+        continue;
+      }
+      uint64_t region_offset = dart_slab_alloc(region->slabs, nbytes);
+      if (region_offset != (uint64_t)(-1)) {
+        offset = (uint64_t)(uintptr_t)region->base + region_offset;
+      }
+    }
+    if (offset == (uint64_t)(-1)) {
+      // extension regions double in size and hold at least two
+      // allocations of the requested size
+      size_t size = last_region_size * 2;
+      if (size < 2 * round_pow_of_2(nbytes)) {
+        size = 2 * round_pow_of_2(nbytes);
+      }
+      if (size > DART_LOCAL_ALLOC_EXT_SIZE_MAX) {
+        size = DART_LOCAL_ALLOC_EXT_SIZE_MAX;
+      }
+      dart_localpool_region_t * region = region_new(size, 1);
+      if (region != NULL) {
+        last_region_size = size;
+        uint64_t region_offset = dart_slab_alloc(region->slabs, nbytes);
+        if (region_offset != (uint64_t)(-1)) {
+          offset = (uint64_t)(uintptr_t)region->base + region_offset;
+        }
+      }
+    }
+  }
+
+  dart__base__mutex_unlock(&regions_mutex);
+  return offset;
+}
+
+int dart__mpi__localpool_ext_free(uint64_t offset)
+{
+  int ret = -1;
+  char * addr = (char *)(uintptr_t)offset;
+  dart__base__mutex_lock(&regions_mutex);
+
+  dart_localpool_region_t ** prev = &regions;
+  for (dart_localpool_region_t * region = regions;
+       region != NULL;
+       prev = &region->next, region = region->next) {
+    if (addr < region->base || addr >= region->base + region->size) {
+      continue;
+    }
+    if (region->slabs != NULL) {
+      ret = dart_slab_free(region->slabs, addr - region->base);
+    } else if (addr == region->base) {
+      *prev = region->next;
+      region_delete(region);
+      ret = 0;
+    }
+    break;
+  }
+
+  dart__base__mutex_unlock(&regions_mutex);
+  return ret;
+}
+
+void dart__mpi__localpool_ext_stats(dart_memalloc_stats_t * stats)
+{
+  dart__base__mutex_lock(&regions_mutex);
+  for (dart_localpool_region_t * region = regions;
+       region != NULL;
+       region = region->next) {
+    if (region->slabs != NULL) {
+      dart_memalloc_stats_t region_stats;
+      dart_slab_stats(region->slabs, &region_stats);
+      stats->pool_size           += region_stats.pool_size;
+      stats->bytes_used          += region_stats.bytes_used;
+      stats->bytes_reserved      += region_stats.bytes_reserved;
+      stats->bytes_reserved_peak += region_stats.bytes_reserved_peak;
+      stats->num_allocs          += region_stats.num_allocs;
+      stats->num_slabs           += region_stats.num_slabs;
+      if (region_stats.bytes_largest_free > stats->bytes_largest_free) {
+        stats->bytes_largest_free = region_stats.bytes_largest_free;
+      }
+    } else {
+      stats->pool_size           += region->size;
+      stats->bytes_used          += region->size;
+      stats->bytes_reserved      += region->size;
+      stats->bytes_reserved_peak += region->size;
+      stats->num_allocs          += 1;
+    }
+    stats->num_regions += 1;
+  }
+  dart__base__mutex_unlock(&regions_mutex);
+}
+
+void dart__mpi__localpool_ext_fini()
+{
+  dart__base__mutex_lock(&regions_mutex);
+  while (regions != NULL) {
+    dart_localpool_region_t * region = regions;
+    regions = region->next;
+    region_delete(region);
+  }
+  last_region_size = 0;
+  dart__base__mutex_unlock(&regions_mutex);
+}
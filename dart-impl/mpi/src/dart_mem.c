@@ -119,8 +119,8 @@ _mark_parent(struct dart_buddy * self, int index) {
 size_t
 dart_buddy_alloc(struct dart_buddy * self, size_t s) {
   int size;
-  // honor the alignment
-  s >>= DART_MEM_ALIGN_BITS;
+  // honor the alignment, round up to full alignment units
+  s = (s + DART_MEM_ALIGN_BYTES - 1) >> DART_MEM_ALIGN_BITS;
 	if (s == 0) {
 		size = 1;
 	}
@@ -251,22 +251,27 @@ int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
 	return -1;
 }
 
-int buddy_size(struct dart_buddy * self, uint64_t offset)
+size_t dart_buddy_size(struct dart_buddy * self, uint64_t offset)
 {
 	uint64_t left   = 0;
 	int      length = 1 << self->level;
 	int      index  = 0;
 
-  assert(offset < (uint64_t)length);
+	offset >>= DART_MEM_ALIGN_BITS;
+
+	if (offset >= (uint64_t)length) {
+		return 0;
+	}
 
+  dart__base__mutex_lock(&self->mutex);
 	for (;;) {
 		switch (self->tree[index]) {
 		case NODE_USED:
-			assert(offset == left);
-			return length;
+		  dart__base__mutex_unlock(&self->mutex);
+			return (offset == left) ? (size_t)length * DART_MEM_ALIGN_BYTES : 0;
 		case NODE_UNUSED:
-			assert(0);
-			return length;
+		  dart__base__mutex_unlock(&self->mutex);
+			return 0;
 		default:
 			length /= 2;
 			if (offset < left + length) {
@@ -279,9 +284,30 @@ int buddy_size(struct dart_buddy * self, uint64_t offset)
 			break;
 		}
 	}
+}
 
-  // TODO: is this ever reached?
-	return -1;
+static size_t
+_largest_free(struct dart_buddy * self, int index, int length) {
+	switch (self->tree[index]) {
+	case NODE_UNUSED:
+		return length;
+	case NODE_USED:
+	case NODE_FULL:
+		return 0;
+	default: {
+		size_t left  = _largest_free(self, index * 2 + 1, length / 2);
+		size_t right = _largest_free(self, index * 2 + 2, length / 2);
+		return (left > right) ? left : right;
+	}
+	}
+}
+
+size_t dart_buddy_largest_free(struct dart_buddy * self)
+{
+  dart__base__mutex_lock(&self->mutex);
+	size_t largest = _largest_free(self, 0, 1 << self->level);
+  dart__base__mutex_unlock(&self->mutex);
+	return largest * DART_MEM_ALIGN_BYTES;
 }
 
 static void
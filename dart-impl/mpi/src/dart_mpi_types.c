@@ -3,7 +3,9 @@
  *
  * Provide functionality for creating derived data types in DART.
  *
- * Currently implemented: strided types based on basic types.
+ * Currently implemented: strided, indexed, and subarray types based on
+ * basic types, custom types of contiguous bytes, and user-defined reduce
+ * operations.
  */
 
 #include <dash/dart/if/dart_types.h>
@@ -34,6 +36,13 @@ static const char* __dart_base_type_names[DART_TYPE_LAST+1] = {
 
 dart_datatype_struct_t __dart_base_types[DART_TYPE_LAST];
 
+/**
+ * Attribute key of the \c dart_operation_struct_t attached to the MPI type
+ * of user-defined operations, MPI user functions receive the type but no
+ * user data.
+ */
+static int dart__mpi__op_keyval = MPI_KEYVAL_INVALID;
+
 static
 MPI_Datatype
 create_max_datatype(MPI_Datatype mpi_type)
@@ -99,6 +108,14 @@ dart__mpi__datatype_init()
   init_basic_datatype(DART_TYPE_FLOAT, MPI_FLOAT);
   init_basic_datatype(DART_TYPE_DOUBLE, MPI_DOUBLE);
 
+  if (MPI_Type_create_keyval(MPI_TYPE_NULL_COPY_FN,
+                             MPI_TYPE_NULL_DELETE_FN,
+                             &dart__mpi__op_keyval,
+                             NULL) != MPI_SUCCESS) {
+    DART_LOG_ERROR("Failed to create attribute key of DART operations");
+    return DART_ERR_OTHER;
+  }
+
   return DART_OK;
 }
 
@@ -121,6 +138,15 @@ char* dart__mpi__datatype_name(dart_datatype_t dart_type)
       snprintf(buf, DART_TYPE_NAMELEN, "STRIDED(%zu:%i:%s)",
                 dts->num_elem, dts->strided.stride, base_name);
       free(base_name);
+    } else if (dts->kind == DART_KIND_BASIC){
+      buf = malloc(DART_TYPE_NAMELEN);
+      snprintf(buf, DART_TYPE_NAMELEN, "CUSTOM(%zu)", dts->basic.size);
+    } else if (dts->kind == DART_KIND_SUBARRAY){
+      buf = malloc(DART_TYPE_NAMELEN);
+      char *base_name = dart__mpi__datatype_name(dts->base_type);
+      snprintf(buf, DART_TYPE_NAMELEN, "SUBARRAY(%i:%zu:%s)",
+                dts->subarray.ndim, dts->num_elem, base_name);
+      free(base_name);
     } else {
       DART_LOG_ERROR("INVALID data type detected!");
     }
@@ -155,15 +181,14 @@ dart_type_create_strided(
     return DART_ERR_INVAL;
   }
 
-  //MPI_Datatype new_mpi_dtype;
-  //MPI_Type_vector(num_blocks, blocklen, stride, mpi_dtype, &new_mpi_dtype);
-  //MPI_Type_commit(&new_mpi_dtype);
   dart_datatype_struct_t *new_struct;
   new_struct = malloc(sizeof(struct dart_datatype_struct));
-  new_struct->base_type        = basetype_id;
-  new_struct->kind             = DART_KIND_STRIDED;
-  new_struct->num_elem         = blocklen;
-  new_struct->strided.stride   = stride;
+  new_struct->base_type          = basetype_id;
+  new_struct->kind               = DART_KIND_STRIDED;
+  new_struct->num_elem           = blocklen;
+  new_struct->strided.stride     = stride;
+  new_struct->strided.num_cached = 0;
+  dart__base__mutex_init(&new_struct->strided.mutex);
 
   *newtype = (dart_datatype_t)new_struct;
 
@@ -172,14 +197,13 @@ dart_type_create_strided(
   return DART_OK;
 }
 
-
+static
 MPI_Datatype
-dart__mpi__create_strided_mpi(
-  dart_datatype_t dart_type,
-  size_t          num_blocks)
+create_strided_mpi(
+  dart_datatype_struct_t * dts,
+  size_t                   num_blocks)
 {
   MPI_Datatype new_mpi_dtype;
-  dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
   MPI_Type_vector(
     num_blocks,             // the number of blocks
     dts->num_elem,          // the number of elements per block
@@ -190,10 +214,58 @@ dart__mpi__create_strided_mpi(
   return new_mpi_dtype;
 }
 
+MPI_Datatype
+dart__mpi__strided_mpi(
+  dart_datatype_t dart_type,
+  size_t          num_blocks)
+{
+  MPI_Datatype mpi_type   = MPI_DATATYPE_NULL;
+  dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
+
+  dart__base__mutex_lock(&dts->strided.mutex);
+  for (int i = 0; i < dts->strided.num_cached; ++i) {
+    if (dts->strided.cached_num_blocks[i] == num_blocks) {
+      mpi_type = dts->strided.cached_mpi_types[i];
+      break;
+    }
+  }
+  if (mpi_type == MPI_DATATYPE_NULL) {
+    mpi_type = create_strided_mpi(dts, num_blocks);
+    if (dts->strided.num_cached < DART_STRIDED_TYPE_CACHE_SIZE) {
+      int idx = dts->strided.num_cached++;
+      dts->strided.cached_num_blocks[idx] = num_blocks;
+      dts->strided.cached_mpi_types[idx]  = mpi_type;
+      DART_LOG_TRACE("Cached MPI vector type of strided type %p "
+                     "for %zu blocks", dts, num_blocks);
+    }
+  }
+  dart__base__mutex_unlock(&dts->strided.mutex);
+
+  return mpi_type;
+}
+
 void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type)
+dart__mpi__datatype_release_mpi(
+  dart_datatype_t   dart_type,
+  MPI_Datatype    * mpi_type)
 {
-  MPI_Type_free(mpi_type);
+  dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
+  if (dts->kind != DART_KIND_STRIDED) {
+    // basic, indexed, and subarray types own their MPI type
+    return;
+  }
+  bool cached = false;
+  dart__base__mutex_lock(&dts->strided.mutex);
+  for (int i = 0; i < dts->strided.num_cached; ++i) {
+    if (dts->strided.cached_mpi_types[i] == *mpi_type) {
+      cached = true;
+      break;
+    }
+  }
+  dart__base__mutex_unlock(&dts->strided.mutex);
+  if (!cached) {
+    MPI_Type_free(mpi_type);
+  }
 }
 
 dart_ret_t
@@ -274,6 +346,120 @@ dart_type_create_indexed(
   return DART_OK;
 }
 
+dart_ret_t
+dart_type_create_subarray(
+  dart_datatype_t   basetype,
+  int               ndim,
+  const size_t      sizes[],
+  const size_t      subsizes[],
+  const size_t      starts[],
+  dart_datatype_t * newtype)
+{
+  if (newtype == NULL) {
+    DART_LOG_ERROR("newtype pointer may not be NULL!");
+    return DART_ERR_INVAL;
+  }
+
+  *newtype = DART_TYPE_UNDEFINED;
+  dart_datatype_struct_t *basetype_struct = dart__mpi__datatype_struct(basetype);
+  if (basetype_struct->kind != DART_KIND_BASIC) {
+    DART_LOG_ERROR("Only basic data types allowed in subarray datatypes!");
+    return DART_ERR_INVAL;
+  }
+
+  if (ndim <= 0) {
+    DART_LOG_ERROR("dart_type_create_subarray: ndim must be positive");
+    return DART_ERR_INVAL;
+  }
+
+  int *mpi_sizes    = malloc(sizeof(int) * ndim);
+  int *mpi_subsizes = malloc(sizeof(int) * ndim);
+  int *mpi_starts   = malloc(sizeof(int) * ndim);
+
+  size_t num_elem = 1;
+  for (int d = 0; d < ndim; ++d) {
+    if (sizes[d] > INT_MAX || subsizes[d] == 0 ||
+        starts[d] + subsizes[d] > sizes[d]) {
+      DART_LOG_ERROR("dart_type_create_subarray: invalid extents in "
+                     "dimension %i (size %zu, subsize %zu, start %zu)",
+                     d, sizes[d], subsizes[d], starts[d]);
+      free(mpi_sizes);
+      free(mpi_subsizes);
+      free(mpi_starts);
+      return DART_ERR_INVAL;
+    }
+    mpi_sizes[d]    = sizes[d];
+    mpi_subsizes[d] = subsizes[d];
+    mpi_starts[d]   = starts[d];
+    num_elem       *= subsizes[d];
+  }
+
+  MPI_Datatype new_mpi_dtype;
+  int ret = MPI_Type_create_subarray(
+              ndim, mpi_sizes, mpi_subsizes, mpi_starts, MPI_ORDER_C,
+              basetype_struct->basic.mpi_type, &new_mpi_dtype);
+  free(mpi_sizes);
+  free(mpi_subsizes);
+  free(mpi_starts);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_type_create_subarray: failed to create subarray type!");
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Type_commit(&new_mpi_dtype);
+  dart_datatype_struct_t *new_struct;
+  new_struct = malloc(sizeof(struct dart_datatype_struct));
+  new_struct->base_type         = basetype;
+  new_struct->kind              = DART_KIND_SUBARRAY;
+  new_struct->num_elem          = num_elem;
+  new_struct->subarray.mpi_type = new_mpi_dtype;
+  new_struct->subarray.ndim     = ndim;
+
+  *newtype = (dart_datatype_t)new_struct;
+
+  DART_LOG_TRACE("Created new subarray data type %p (mpi_type %p) with %zu elements",
+                 new_struct, new_mpi_dtype, num_elem);
+
+  return DART_OK;
+}
+
+dart_ret_t
+dart_type_create_custom(
+  size_t            num_bytes,
+  dart_datatype_t * newtype)
+{
+  *newtype = DART_TYPE_UNDEFINED;
+
+  if (num_bytes == 0 || num_bytes > INT_MAX) {
+    DART_LOG_ERROR("dart_type_create_custom: invalid size %zu", num_bytes);
+    return DART_ERR_INVAL;
+  }
+
+  MPI_Datatype new_mpi_dtype;
+  if (MPI_Type_contiguous(num_bytes, MPI_BYTE, &new_mpi_dtype)
+        != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_type_create_custom: failed to create custom type!");
+    return DART_ERR_INVAL;
+  }
+  MPI_Type_commit(&new_mpi_dtype);
+
+  dart_datatype_struct_t *new_struct = malloc(sizeof(struct dart_datatype_struct));
+  // custom types are basic types consisting of a single element
+  new_struct->base_type          = (dart_datatype_t)new_struct;
+  new_struct->kind               = DART_KIND_BASIC;
+  new_struct->num_elem           = 1;
+  new_struct->basic.size         = num_bytes;
+  new_struct->basic.mpi_type     = new_mpi_dtype;
+  new_struct->basic.max_type     = create_max_datatype(new_mpi_dtype);
+
+  *newtype = (dart_datatype_t)new_struct;
+
+  DART_LOG_TRACE("Created new custom data type %p (mpi_type %p) of %zu bytes",
+                 new_struct, new_mpi_dtype, num_bytes);
+
+  return DART_OK;
+}
+
 dart_ret_t
 dart_type_destroy(dart_datatype_t *dart_type_ptr)
 {
@@ -281,11 +467,16 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
     return DART_ERR_INVAL;
   }
 
+  if (*dart_type_ptr < DART_TYPE_LAST) {
+    DART_LOG_ERROR("dart_type_destroy: Cannot destroy basic type!");
+    return DART_ERR_INVAL;
+  }
+
   dart_datatype_struct_t *dart_type = dart__mpi__datatype_struct(*dart_type_ptr);
 
   if (dart_type->kind == DART_KIND_BASIC) {
-    DART_LOG_ERROR("dart_type_destroy: Cannot destroy basic type!");
-    return DART_ERR_INVAL;
+    MPI_Type_free(&dart_type->basic.max_type);
+    MPI_Type_free(&dart_type->basic.mpi_type);
   }
 
   if (dart_type->kind == DART_KIND_INDEXED) {
@@ -296,12 +487,107 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
     MPI_Type_free(&dart_type->indexed.mpi_type);
   }
 
+  if (dart_type->kind == DART_KIND_STRIDED) {
+    for (int i = 0; i < dart_type->strided.num_cached; ++i) {
+      MPI_Type_free(&dart_type->strided.cached_mpi_types[i]);
+    }
+    dart_type->strided.num_cached = 0;
+    dart__base__mutex_destroy(&dart_type->strided.mutex);
+  }
+
+  if (dart_type->kind == DART_KIND_SUBARRAY) {
+    MPI_Type_free(&dart_type->subarray.mpi_type);
+  }
+
   free(dart_type);
   *dart_type_ptr = DART_TYPE_UNDEFINED;
 
   return DART_OK;
 }
 
+/**
+ * MPI user function of all user-defined operations, forwards to the DART
+ * operation attached to the MPI type of the operands.
+ */
+static void
+dart__mpi__op_invoke(
+  void         * invec,
+  void         * inoutvec,
+  int          * len,
+  MPI_Datatype * mpi_type)
+{
+  dart_operation_struct_t *op_struct;
+  int                      flag = 0;
+  MPI_Type_get_attr(*mpi_type, dart__mpi__op_keyval, &op_struct, &flag);
+  if (!flag) {
+    DART_LOG_ERROR("dart__mpi__op_invoke: operation invoked on unknown type");
+    dart_abort(-1);
+  }
+  op_struct->op(invec, inoutvec, *len, op_struct->userdata);
+}
+
+dart_ret_t
+dart_op_create(
+  dart_operator_t    op,
+  void             * userdata,
+  bool               commute,
+  dart_datatype_t    dtype,
+  dart_operation_t * new_op)
+{
+  *new_op = DART_OP_UNDEFINED;
+
+  if (op == NULL || !dart__mpi__datatype_isbasic(dtype) ||
+      dtype == DART_TYPE_UNDEFINED) {
+    DART_LOG_ERROR("dart_op_create: invalid operation or non-basic type");
+    return DART_ERR_INVAL;
+  }
+
+  dart_operation_struct_t *op_struct = malloc(sizeof(dart_operation_struct_t));
+  op_struct->dtype    = dtype;
+  op_struct->op       = op;
+  op_struct->userdata = userdata;
+
+  MPI_Datatype mpi_type = dart__mpi__datatype_struct(dtype)->basic.mpi_type;
+  if (MPI_Type_dup(mpi_type, &op_struct->mpi_type) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_op_create: failed to duplicate MPI type");
+    free(op_struct);
+    return DART_ERR_OTHER;
+  }
+  MPI_Type_set_attr(op_struct->mpi_type, dart__mpi__op_keyval, op_struct);
+
+  if (MPI_Op_create(&dart__mpi__op_invoke, commute, &op_struct->mpi_op)
+        != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_op_create: failed to create MPI operation");
+    MPI_Type_free(&op_struct->mpi_type);
+    free(op_struct);
+    return DART_ERR_OTHER;
+  }
+
+  *new_op = (dart_operation_t)op_struct;
+
+  DART_LOG_TRACE("Created new operation %p on type %p",
+                 op_struct, (void *)dtype);
+
+  return DART_OK;
+}
+
+dart_ret_t
+dart_op_destroy(dart_operation_t *op)
+{
+  if (op == NULL || !dart__mpi__op_iscustom(*op)) {
+    DART_LOG_ERROR("dart_op_destroy: Cannot destroy predefined operation!");
+    return DART_ERR_INVAL;
+  }
+
+  dart_operation_struct_t *op_struct = dart__mpi__op_struct(*op);
+  MPI_Op_free(&op_struct->mpi_op);
+  MPI_Type_free(&op_struct->mpi_type);
+  free(op_struct);
+  *op = DART_OP_UNDEFINED;
+
+  return DART_OK;
+}
+
 static void destroy_basic_type(dart_datatype_t dart_type_id)
 {
   dart_datatype_struct_t *dart_type = dart__mpi__datatype_struct(dart_type_id);
@@ -322,5 +608,7 @@ dart__mpi__datatype_fini()
   destroy_basic_type(DART_TYPE_FLOAT);
   destroy_basic_type(DART_TYPE_DOUBLE);
 
+  MPI_Type_free_keyval(&dart__mpi__op_keyval);
+
   return DART_OK;
 }
@@ -1,4 +1,5 @@
 #include <string.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <inttypes.h>
 
@@ -10,75 +11,81 @@
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
-struct dart_seghash_elem {
-  dart_seghash_elem_t *next;
+struct dart_segment_elem {
+  dart_segment_elem_t *next;
   dart_segment_info_t  data;
 };
 
-
-static inline int hash_segid(dart_segid_t segid)
-{
-  /* Simply use the lower bits of the segment ID.
-   * Since segment IDs are allocated continuously, this is likely to cause
-   * collisions starting at (segment number == DART_SEGMENT_HASH_SIZE)
-   * TODO: come up with a random distribution to account for random free'd
-   * segments?
-   * */
-  return (abs(segid) % DART_SEGMENT_HASH_SIZE);
-}
-
-static inline void
-register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
-{
-  int slot = hash_segid(elem->data.segid);
-  elem->next = segdata->hashtab[slot];
-  segdata->hashtab[slot] = elem;
-}
-
-static dart_segment_info_t * get_segment(
-    dart_segmentdata_t *segdata,
-    dart_segid_t        segid)
+/**
+ * Stores \c seginfo at index \c idx of the table \c tab of \c tab_size
+ * entries, growing the table if required.
+ */
+static int
+table_insert(
+  dart_segment_info_t *** tab,
+  int                   * tab_size,
+  int                     idx,
+  dart_segment_info_t   * seginfo)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  while (elem != NULL) {
-    if (elem->data.segid == segid) {
-      break;
+  if (idx >= *tab_size) {
+    int new_size = (*tab_size > 0) ? *tab_size : DART_SEGMENT_TABLE_INIT_SIZE;
+    while (new_size <= idx) {
+      new_size *= 2;
+    }
+    dart_segment_info_t ** new_tab = realloc(
+                                       *tab,
+                                       new_size * sizeof(dart_segment_info_t*));
+    if (new_tab == NULL) {
+      DART_LOG_ERROR("dart_segment: failed to grow segment table to %i "
+                     "entries", new_size);
+      return -1;
     }
-    elem = elem->next;
+    memset(new_tab + *tab_size, 0,
+           (new_size - *tab_size) * sizeof(dart_segment_info_t*));
+    *tab      = new_tab;
+    *tab_size = new_size;
   }
+  (*tab)[idx] = seginfo;
+  return 0;
+}
 
-  if (elem == NULL) {
-    DART_LOG_ERROR("dart_segment__get_segment : "
-                   "Invalid segment ID %i on team %i",
-                   segid, segdata->team_id);
-    return NULL;
+static inline int
+register_segment(dart_segmentdata_t *segdata, dart_segment_elem_t *elem)
+{
+  dart_segid_t segid = elem->data.segid;
+  if (segid >= 0) {
+    return table_insert(&segdata->mem_tab, &segdata->mem_tab_size,
+                        segid, &elem->data);
   }
-
-  return &(elem->data);
+  return table_insert(&segdata->reg_tab, &segdata->reg_tab_size,
+                      -segid, &elem->data);
 }
 
-dart_segment_info_t * dart_segment_get_info(
-  dart_segmentdata_t *segdata,
-  dart_segid_t        segid)
+static inline dart_segment_elem_t *
+elem_of(dart_segment_info_t *seginfo)
 {
-  return get_segment(segdata, segid);
+  return (dart_segment_elem_t *)(
+           (char *)seginfo - offsetof(dart_segment_elem_t, data));
 }
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment tables.
  */
 dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 {
-  memset(segdata->hashtab, 0,
-    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
+  segdata->mem_tab      = calloc(DART_SEGMENT_TABLE_INIT_SIZE,
+                                 sizeof(dart_segment_info_t*));
+  segdata->reg_tab      = calloc(DART_SEGMENT_TABLE_INIT_SIZE,
+                                 sizeof(dart_segment_info_t*));
+  segdata->mem_tab_size = DART_SEGMENT_TABLE_INIT_SIZE;
+  segdata->reg_tab_size = DART_SEGMENT_TABLE_INIT_SIZE;
 
   segdata->team_id = teamid;
   segdata->mem_freelist = NULL;
   segdata->reg_freelist = NULL;
   segdata->memid = 1;
-  segdata->registermemid = -1;
+  // DART_SEGMENT_LOCAL_EXT is reserved
+  segdata->registermemid = DART_SEGMENT_LOCAL_EXT - 1;
 
   return DART_OK;
 }
@@ -95,11 +102,15 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
                  segdata->team_id);
 
   int16_t segid;
-  dart_seghash_elem_t *elem = NULL;
+  dart_segment_elem_t *elem = NULL;
   if (type == DART_SEGMENT_LOCAL_ALLOC) {
     // no need to check for overflow
     segid = DART_SEGMENT_LOCAL;
-    elem = calloc(1, sizeof(dart_seghash_elem_t));
+    elem = calloc(1, sizeof(dart_segment_elem_t));
+    elem->data.segid = segid;
+  } else if (type == DART_SEGMENT_LOCAL_ALLOC_EXT) {
+    segid = DART_SEGMENT_LOCAL_EXT;
+    elem = calloc(1, sizeof(dart_segment_elem_t));
     elem->data.segid = segid;
   } else if (type == DART_SEGMENT_ALLOC) {
     if (segdata->mem_freelist != NULL) {
@@ -114,7 +125,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->memid++;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else if (type == DART_SEGMENT_REGISTER) {
@@ -131,7 +142,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->registermemid--;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else {
@@ -139,7 +150,10 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
     DART_ASSERT(type != DART_SEGMENT_REGISTER && type != DART_SEGMENT_ALLOC);
   }
 
-  register_segment(segdata, elem);
+  if (register_segment(segdata, elem) != 0) {
+    free(elem);
+    return NULL;
+  }
 
   DART_LOG_DEBUG("dart_segment_alloc > segid:%d team_id:%d",
                  segid, segdata->team_id);
@@ -152,7 +166,7 @@ dart_ret_t dart_segment_get_shmwin(
     int16_t              segid,
     MPI_Win            * win)
 {
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("Invalid segment ID %i on team %i", segid, segdata->team_id);
     return DART_ERR_INVAL;
@@ -173,7 +187,7 @@ dart_ret_t dart_segment_get_disp(dart_segmentdata_t * segdata,
   DART_LOG_TRACE("dart_segment_get_disp() "
                  "seq_id:%d rel_unitid:%d", segid, rel_unitid.id);
 
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
 
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_disp ! Invalid segment ID %i on team %i",
@@ -194,7 +208,7 @@ dart_ret_t dart_segment_get_baseptr(
   dart_team_unit_t      rel_unitid,
   char              **  baseptr_s)
 {
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_baseptr ! Invalid segment ID %i on team %i",
                    segid, segdata->team_id);
@@ -212,7 +226,7 @@ dart_ret_t dart_segment_get_selfbaseptr(
   char               ** baseptr)
 {
   *baseptr = NULL;
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_selfbaseptr ! "
                    "Invalid segment ID %i on team %i",
@@ -229,7 +243,7 @@ dart_ret_t dart_segment_get_size(
   int16_t               segid,
   size_t              * size)
 {
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_size ! Invalid segment ID %i", segid);
     return DART_ERR_INVAL;
@@ -245,7 +259,7 @@ dart_ret_t dart_segment_get_flags(
   uint16_t           * flags)
 {
 
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_size ! Invalid segment ID %i", segid);
     return DART_ERR_INVAL;
@@ -261,7 +275,7 @@ dart_ret_t dart_segment_set_flags(
   uint16_t             flags)
 {
 
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_size ! Invalid segment ID %i", segid);
     return DART_ERR_INVAL;
@@ -297,50 +311,34 @@ dart_ret_t dart_segment_free(
   dart_segmentdata_t  * segdata,
   dart_segid_t          segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *pred = NULL;
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  // find the correct entry in this bucket
-  pred = NULL;
-  while (elem != NULL) {
-
-    if (elem->data.segid == segid) {
-      if (pred != NULL) {
-        pred->next = elem->next;
-      } else {
-        segdata->hashtab[slot] = elem->next;
-      }
-      // no need for locking since operations on the same segmentdata
-      // are not thread-safe
-      if (segid > 0) {
-        elem->next            = segdata->mem_freelist;
-        segdata->mem_freelist = elem;
-      } else if (segid < 0){
-        elem->next            = segdata->reg_freelist;
-        segdata->reg_freelist = elem;
-      } else {
-        // This should not happen!
-        DART_ASSERT(segid != 0);
-      }
-      // set the segment ID again
-      elem->data.segid = segid;
-      return DART_OK;
-    }
-
-    pred = elem;
-    elem = elem->next;
+  dart_segment_info_t *seginfo = dart_segment_get_info(segdata, segid);
+  if (seginfo == NULL) {
+    return DART_ERR_INVAL;
   }
-
-  // element not found
-  return DART_ERR_INVAL;
+  dart_segment_elem_t *elem = elem_of(seginfo);
+
+  // no need for locking since operations on the same segmentdata
+  // are not thread-safe
+  if (segid > 0) {
+    segdata->mem_tab[segid] = NULL;
+    elem->next              = segdata->mem_freelist;
+    segdata->mem_freelist   = elem;
+  } else if (segid < 0) {
+    segdata->reg_tab[-segid] = NULL;
+    elem->next               = segdata->reg_freelist;
+    segdata->reg_freelist    = elem;
+  } else {
+    // This should not happen!
+    DART_ASSERT(segid != 0);
+  }
+  return DART_OK;
 }
 
-static void clear_segdata_list(dart_seghash_elem_t *listhead)
+static void clear_segdata_list(dart_segment_elem_t *listhead)
 {
-  dart_seghash_elem_t *elem = listhead;
+  dart_segment_elem_t *elem = listhead;
   while (elem != NULL) {
-    dart_seghash_elem_t *tmp = elem;
+    dart_segment_elem_t *tmp = elem;
     elem = tmp->next;
     tmp->next = NULL;
     // segment info should have been cleared in dart_segment_fini
@@ -352,24 +350,39 @@ static void clear_segdata_list(dart_seghash_elem_t *listhead)
 }
 
 /**
- * @brief Clear the segment data hash table.
+ * @brief Clear the segment tables.
  */
 dart_ret_t dart_segment_fini(
   dart_segmentdata_t  * segdata)
 {
   // only clear up the local allocation segment in DART_TEAM_ALL
   if (segdata->team_id == DART_TEAM_ALL) {
-    dart_segment_info_t *seg = get_segment(
+    dart_segment_info_t *seg = dart_segment_get_info(
                         &(dart_adapt_teamlist_get(DART_TEAM_ALL)->segdata),
                         DART_SEGMENT_LOCAL);
     free_segment_info(seg);
   }
 
-  // clear the remaining hash table
-  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
-    clear_segdata_list(segdata->hashtab[i]);
-    segdata->hashtab[i] = NULL;
+  // clear the remaining segments
+  for (int i = 0; i < segdata->mem_tab_size; i++) {
+    if (segdata->mem_tab[i] != NULL) {
+      elem_of(segdata->mem_tab[i])->next = NULL;
+      clear_segdata_list(elem_of(segdata->mem_tab[i]));
+    }
+  }
+  for (int i = 0; i < segdata->reg_tab_size; i++) {
+    if (segdata->reg_tab[i] != NULL) {
+      elem_of(segdata->reg_tab[i])->next = NULL;
+      clear_segdata_list(elem_of(segdata->reg_tab[i]));
+    }
   }
+  free(segdata->mem_tab);
+  free(segdata->reg_tab);
+  segdata->mem_tab      = NULL;
+  segdata->reg_tab      = NULL;
+  segdata->mem_tab_size = 0;
+  segdata->reg_tab_size = 0;
+
   clear_segdata_list(segdata->mem_freelist);
   segdata->mem_freelist = NULL;
 
@@ -0,0 +1,535 @@
+/**
+ * \file dart_slab.c
+ *
+ * Size-class slab allocator on top of the buddy allocator of the local
+ * allocation pool.
+ *
+ * Every slab is owned by the thread cache that created it. Only the owner
+ * allocates from a slab and maintains its local free list, so the fast
+ * paths of allocation and deallocation are not synchronized. Objects freed
+ * by other threads are pushed to the slab's remote free list using
+ * compare-and-swap and moved to the local free list by the owner once the
+ * local free list is exhausted. As the owner only ever detaches the remote
+ * free list as a whole, the remote free list is not subject to the ABA
+ * problem.
+ *
+ * Slabs that become empty are returned to the buddy allocator so memory
+ * can be reused by other size classes and large allocations. Slabs owned
+ * by exiting threads are abandoned and adopted by the next thread
+ * allocating objects of the same size class.
+ *
+ * Free lists and all other metadata of slabs are stored outside of the
+ * pool. Freeing an object does not modify its memory which may still be
+ * read by other units.
+ */
+
+#include <dash/dart/mpi/dart_slab.h>
+#include <dash/dart/mpi/dart_mem.h>
+
+#include <dash/dart/base/mutex.h>
+#include <dash/dart/base/atomic.h>
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/assert.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define DART_SLAB_NUM_CLASSES  28
+#define DART_SLAB_CLASS_GRAIN  16
+
+/* Free lists store object indices incremented by one, 0 marks the end. */
+#define DART_SLAB_LIST_END      0
+
+#define DART_SLAB_INVALID_OFFSET ((uint64_t)(-1))
+
+/* Four size classes per power of two up to DART_SLAB_MAX_OBJECT bytes */
+static const uint32_t dart_slab_class_sizes[DART_SLAB_NUM_CLASSES] = {
+    16,   32,   48,   64,   80,   96,  112,  128,
+   160,  192,  224,  256,
+   320,  384,  448,  512,
+   640,  768,  896, 1024,
+  1280, 1536, 1792, 2048,
+  2560, 3072, 3584, 4096
+};
+
+/* Size class of allocations by size in units of DART_SLAB_CLASS_GRAIN */
+static uint8_t dart_slab_class_index[
+                 DART_SLAB_MAX_OBJECT / DART_SLAB_CLASS_GRAIN + 1];
+
+struct dart_slab_cache;
+
+struct dart_slab {
+  /* thread cache owning the slab, NULL if the slab is abandoned */
+  struct dart_slab_cache * owner;
+  /* neighbors in the list of slabs of the same size class of the owner */
+  struct dart_slab       * prev;
+  struct dart_slab       * next;
+  /* size class of objects in the slab, -1 if not used as slab */
+  int                      size_class;
+  /* size of objects in bytes */
+  uint32_t                 obj_size;
+  /* number of objects in the slab */
+  uint32_t                 num_obj;
+  /* number of objects handed out and not returned to the owner */
+  uint32_t                 num_used;
+  /* number of objects at the end of the slab never handed out */
+  uint32_t                 num_fresh;
+  /* free list only accessed by the owner */
+  uint32_t                 local_free;
+  /* free list of objects freed by other threads */
+  volatile int32_t         remote_free;
+  /* successors of free objects in the free lists */
+  uint16_t               * links;
+};
+
+struct dart_slab_cache {
+  struct dart_slab_pool  * pool;
+  /* slabs owned by the thread, most recently allocated from first */
+  struct dart_slab       * slabs[DART_SLAB_NUM_CLASSES];
+};
+
+struct dart_slab_pool {
+  struct dart_buddy      * buddy;
+  size_t                   size;
+  /* metadata of all slab-sized regions in the pool */
+  struct dart_slab       * slabs;
+  size_t                   num_regions;
+  /* protects the lists of abandoned slabs */
+  dart_mutex_t             mutex;
+  struct dart_slab       * abandoned[DART_SLAB_NUM_CLASSES];
+#ifdef DART_HAVE_PTHREADS
+  pthread_key_t            cache_key;
+#else
+  struct dart_slab_cache   cache;
+#endif
+  /* statistics, updated atomically */
+  int64_t                  bytes_used;
+  int64_t                  bytes_reserved;
+  int64_t                  bytes_reserved_peak;
+  int64_t                  num_allocs;
+  int64_t                  num_slabs;
+};
+
+struct dart_slab_pool * dart_localslabs;
+
+static void
+init_class_index()
+{
+  int cls = 0;
+  for (size_t i = 0;
+       i <= DART_SLAB_MAX_OBJECT / DART_SLAB_CLASS_GRAIN; ++i) {
+    while (dart_slab_class_sizes[cls] < i * DART_SLAB_CLASS_GRAIN) {
+      cls++;
+    }
+    dart_slab_class_index[i] = cls;
+  }
+}
+
+static inline int
+size_class(size_t nbytes)
+{
+  return dart_slab_class_index[
+           (nbytes + DART_SLAB_CLASS_GRAIN - 1) / DART_SLAB_CLASS_GRAIN];
+}
+
+static inline uint64_t
+slab_offset(const struct dart_slab_pool * pool, const struct dart_slab * slab)
+{
+  return (uint64_t)(slab - pool->slabs) * DART_SLAB_SIZE;
+}
+
+static inline uint16_t *
+obj_link(
+  const struct dart_slab * slab,
+  uint32_t                 idx)
+{
+  return &slab->links[idx];
+}
+
+static inline void
+stats_add(int64_t * counter, int64_t val)
+{
+  DART_FETCH_AND_ADD64(counter, val);
+}
+
+static void
+stats_reserve(struct dart_slab_pool * pool, int64_t nbytes)
+{
+  int64_t reserved = DART_ADD_AND_FETCH64(&pool->bytes_reserved, nbytes);
+  int64_t peak     = pool->bytes_reserved_peak;
+  while (reserved > peak) {
+    int64_t prev = DART_COMPARE_AND_SWAP64(
+                     &pool->bytes_reserved_peak, peak, reserved);
+    if (prev == peak) break;
+    peak = prev;
+  }
+}
+
+/* Returns the thread cache of the calling thread, creates it if requested */
+static struct dart_slab_cache *
+slab_cache(struct dart_slab_pool * pool, bool create)
+{
+#ifdef DART_HAVE_PTHREADS
+  struct dart_slab_cache * cache = pthread_getspecific(pool->cache_key);
+  if (cache == NULL && create) {
+    cache = calloc(1, sizeof(struct dart_slab_cache));
+    cache->pool = pool;
+    pthread_setspecific(pool->cache_key, cache);
+  }
+  return cache;
+#else
+  (void)create;
+  return &pool->cache;
+#endif
+}
+
+static inline void
+slab_unlink(struct dart_slab ** list, struct dart_slab * slab)
+{
+  if (slab->prev != NULL) {
+    slab->prev->next = slab->next;
+  } else {
+    *list = slab->next;
+  }
+  if (slab->next != NULL) {
+    slab->next->prev = slab->prev;
+  }
+  slab->prev = NULL;
+  slab->next = NULL;
+}
+
+static inline void
+slab_push_front(struct dart_slab ** list, struct dart_slab * slab)
+{
+  slab->prev = NULL;
+  slab->next = *list;
+  if (*list != NULL) {
+    (*list)->prev = slab;
+  }
+  *list = slab;
+}
+
+/* Moves objects freed by other threads to the local free list */
+static void
+slab_collect_remote(struct dart_slab_pool * pool, struct dart_slab * slab)
+{
+  int32_t head = slab->remote_free;
+  while (head != DART_SLAB_LIST_END) {
+    int32_t prev = DART_COMPARE_AND_SWAP32(
+                     &slab->remote_free, head, DART_SLAB_LIST_END);
+    if (prev == head) break;
+    head = prev;
+  }
+  if (head == DART_SLAB_LIST_END) {
+    return;
+  }
+  uint32_t tail  = head;
+  uint32_t nfree = 1;
+  while (*obj_link(slab, tail - 1) != DART_SLAB_LIST_END) {
+    tail = *obj_link(slab, tail - 1);
+    nfree++;
+  }
+  *obj_link(slab, tail - 1) = slab->local_free;
+  slab->local_free = head;
+  slab->num_used  -= nfree;
+}
+
+/* Takes an object from a slab owned by the calling thread */
+static uint64_t
+slab_pop(struct dart_slab_pool * pool, struct dart_slab * slab)
+{
+  uint32_t idx;
+  if (slab->local_free == DART_SLAB_LIST_END) {
+    slab_collect_remote(pool, slab);
+  }
+  if (slab->local_free != DART_SLAB_LIST_END) {
+    idx              = slab->local_free - 1;
+    slab->local_free = *obj_link(slab, idx);
+  } else if (slab->num_fresh > 0) {
+    idx              = slab->num_obj - slab->num_fresh;
+    slab->num_fresh--;
+  } else {
+    return DART_SLAB_INVALID_OFFSET;
+  }
+  slab->num_used++;
+  return slab_offset(pool, slab) + (uint64_t)idx * slab->obj_size;
+}
+
+static struct dart_slab *
+slab_new(
+  struct dart_slab_pool  * pool,
+  struct dart_slab_cache * cache,
+  int                      cls)
+{
+  size_t offset = dart_buddy_alloc(pool->buddy, DART_SLAB_SIZE);
+  if (offset == (size_t)(-1)) {
+    return NULL;
+  }
+  struct dart_slab * slab = &pool->slabs[offset / DART_SLAB_SIZE];
+  slab->owner       = cache;
+  slab->size_class  = cls;
+  slab->obj_size    = dart_slab_class_sizes[cls];
+  slab->num_obj     = DART_SLAB_SIZE / slab->obj_size;
+  slab->num_used    = 0;
+  slab->num_fresh   = slab->num_obj;
+  slab->local_free  = DART_SLAB_LIST_END;
+  slab->remote_free = DART_SLAB_LIST_END;
+  slab->links       = malloc(slab->num_obj * sizeof(uint16_t));
+  slab_push_front(&cache->slabs[cls], slab);
+  stats_add(&pool->num_slabs, 1);
+  stats_reserve(pool, DART_SLAB_SIZE);
+  DART_LOG_TRACE("dart_slab: new slab at offset %zu for size class %d",
+                 offset, slab->obj_size);
+  return slab;
+}
+
+/* Returns an empty slab owned by the calling thread to the buddy allocator */
+static void
+slab_release(
+  struct dart_slab_pool  * pool,
+  struct dart_slab      ** list,
+  struct dart_slab       * slab)
+{
+  DART_ASSERT(slab->num_used == 0);
+  slab_unlink(list, slab);
+  slab->owner      = NULL;
+  slab->size_class = -1;
+  free(slab->links);
+  slab->links      = NULL;
+  dart_buddy_free(pool->buddy, slab_offset(pool, slab));
+  stats_add(&pool->num_slabs, -1);
+  stats_add(&pool->bytes_reserved, -DART_SLAB_SIZE);
+}
+
+/* Adopts a slab abandoned by an exited thread */
+static struct dart_slab *
+slab_adopt(
+  struct dart_slab_pool  * pool,
+  struct dart_slab_cache * cache,
+  int                      cls)
+{
+  if (pool->abandoned[cls] == NULL) {
+    return NULL;
+  }
+  dart__base__mutex_lock(&pool->mutex);
+  struct dart_slab * slab = pool->abandoned[cls];
+  if (slab != NULL) {
+    slab_unlink(&pool->abandoned[cls], slab);
+    slab->owner = cache;
+    slab_push_front(&cache->slabs[cls], slab);
+  }
+  dart__base__mutex_unlock(&pool->mutex);
+  return slab;
+}
+
+/* Returns empty slabs of the calling thread to the buddy allocator */
+static void
+slab_cache_trim(struct dart_slab_pool * pool, struct dart_slab_cache * cache)
+{
+  for (int cls = 0; cls < DART_SLAB_NUM_CLASSES; ++cls) {
+    struct dart_slab * slab = cache->slabs[cls];
+    while (slab != NULL) {
+      struct dart_slab * next = slab->next;
+      slab_collect_remote(pool, slab);
+      if (slab->num_used == 0) {
+        slab_release(pool, &cache->slabs[cls], slab);
+      }
+      slab = next;
+    }
+  }
+}
+
+#ifdef DART_HAVE_PTHREADS
+/* Abandons the slabs of an exiting thread */
+static void
+slab_cache_abandon(void * arg)
+{
+  struct dart_slab_cache * cache = (struct dart_slab_cache *)arg;
+  struct dart_slab_pool  * pool  = cache->pool;
+  slab_cache_trim(pool, cache);
+  dart__base__mutex_lock(&pool->mutex);
+  for (int cls = 0; cls < DART_SLAB_NUM_CLASSES; ++cls) {
+    while (cache->slabs[cls] != NULL) {
+      struct dart_slab * slab = cache->slabs[cls];
+      slab_unlink(&cache->slabs[cls], slab);
+      slab->owner = NULL;
+      slab_push_front(&pool->abandoned[cls], slab);
+    }
+  }
+  dart__base__mutex_unlock(&pool->mutex);
+  free(cache);
+}
+#endif
+
+struct dart_slab_pool *
+dart_slab_pool_new(
+  struct dart_buddy * buddy,
+  size_t              size)
+{
+  init_class_index();
+  struct dart_slab_pool * pool = calloc(1, sizeof(struct dart_slab_pool));
+  pool->buddy       = buddy;
+  pool->size        = size;
+  pool->num_regions = size / DART_SLAB_SIZE;
+  pool->slabs       = calloc(pool->num_regions, sizeof(struct dart_slab));
+  for (size_t i = 0; i < pool->num_regions; ++i) {
+    pool->slabs[i].size_class = -1;
+  }
+  dart__base__mutex_init(&pool->mutex);
+#ifdef DART_HAVE_PTHREADS
+  pthread_key_create(&pool->cache_key, &slab_cache_abandon);
+#else
+  pool->cache.pool  = pool;
+#endif
+  return pool;
+}
+
+void
+dart_slab_pool_delete(struct dart_slab_pool * pool)
+{
+#ifdef DART_HAVE_PTHREADS
+  // caches of other threads are not accessible here, their slabs are
+  // released together with the pool
+  free(pthread_getspecific(pool->cache_key));
+  pthread_key_delete(pool->cache_key);
+#endif
+  dart__base__mutex_destroy(&pool->mutex);
+  for (size_t i = 0; i < pool->num_regions; ++i) {
+    free(pool->slabs[i].links);
+  }
+  free(pool->slabs);
+  free(pool);
+}
+
+static uint64_t
+slab_alloc_small(struct dart_slab_pool * pool, int cls)
+{
+  struct dart_slab_cache * cache = slab_cache(pool, true);
+  struct dart_slab      ** list  = &cache->slabs[cls];
+  uint64_t                 offset;
+
+  for (struct dart_slab * slab = *list; slab != NULL; slab = slab->next) {
+    offset = slab_pop(pool, slab);
+    if (offset != DART_SLAB_INVALID_OFFSET) {
+      if (slab != *list) {
+        slab_unlink(list, slab);
+        slab_push_front(list, slab);
+      }
+      return offset;
+    }
+  }
+  // no free objects in slabs of the calling thread
+  struct dart_slab * slab;
+  while ((slab = slab_adopt(pool, cache, cls)) != NULL) {
+    offset = slab_pop(pool, slab);
+    if (offset != DART_SLAB_INVALID_OFFSET) {
+      return offset;
+    }
+  }
+  slab = slab_new(pool, cache, cls);
+  if (slab == NULL) {
+    slab_cache_trim(pool, cache);
+    slab = slab_new(pool, cache, cls);
+  }
+  if (slab == NULL) {
+    return DART_SLAB_INVALID_OFFSET;
+  }
+  return slab_pop(pool, slab);
+}
+
+uint64_t
+dart_slab_alloc(struct dart_slab_pool * pool, size_t nbytes)
+{
+  uint64_t offset;
+  size_t   size;
+  if (nbytes <= DART_SLAB_MAX_OBJECT && pool->num_regions > 0) {
+    int cls = size_class(nbytes);
+    offset  = slab_alloc_small(pool, cls);
+    size    = dart_slab_class_sizes[cls];
+  } else {
+    offset  = dart_buddy_alloc(pool->buddy, nbytes);
+    if (offset == DART_SLAB_INVALID_OFFSET) {
+      struct dart_slab_cache * cache = slab_cache(pool, false);
+      if (cache != NULL) {
+        slab_cache_trim(pool, cache);
+        offset = dart_buddy_alloc(pool->buddy, nbytes);
+      }
+    }
+    size    = dart_buddy_size(pool->buddy, offset);
+    if (offset != DART_SLAB_INVALID_OFFSET) {
+      stats_reserve(pool, size);
+    }
+  }
+  if (offset == DART_SLAB_INVALID_OFFSET) {
+    return offset;
+  }
+  stats_add(&pool->bytes_used, size);
+  stats_add(&pool->num_allocs, 1);
+  return offset;
+}
+
+int
+dart_slab_free(struct dart_slab_pool * pool, uint64_t offset)
+{
+  if (offset >= pool->size) {
+    return -1;
+  }
+  struct dart_slab * slab = (pool->num_regions > 0)
+                            ? &pool->slabs[offset / DART_SLAB_SIZE]
+                            : NULL;
+  if (slab == NULL || slab->size_class < 0) {
+    // large allocation
+    size_t size = dart_buddy_size(pool->buddy, offset);
+    if (size == 0 || dart_buddy_free(pool->buddy, offset) != 0) {
+      return -1;
+    }
+    stats_add(&pool->bytes_used, -(int64_t)size);
+    stats_add(&pool->bytes_reserved, -(int64_t)size);
+    stats_add(&pool->num_allocs, -1);
+    return 0;
+  }
+
+  uint64_t rel_offset = offset - slab_offset(pool, slab);
+  uint32_t obj_size   = slab->obj_size;
+  if (rel_offset % obj_size != 0 || rel_offset / obj_size >= slab->num_obj) {
+    return -1;
+  }
+  uint32_t idx = rel_offset / obj_size;
+  int      cls = slab->size_class;
+  stats_add(&pool->bytes_used, -(int64_t)obj_size);
+  stats_add(&pool->num_allocs, -1);
+
+  struct dart_slab_cache * cache = slab_cache(pool, false);
+  if (cache != NULL && slab->owner == cache) {
+    *obj_link(slab, idx) = slab->local_free;
+    slab->local_free = idx + 1;
+    slab->num_used--;
+    if (slab->num_used == 0 && slab != cache->slabs[cls]) {
+      slab_release(pool, &cache->slabs[cls], slab);
+    }
+  } else {
+    // lock-free push to the remote free list of the slab
+    int32_t head = slab->remote_free;
+    for (;;) {
+      *obj_link(slab, idx) = head;
+      int32_t prev = DART_COMPARE_AND_SWAP32(
+                       &slab->remote_free, head, (int32_t)(idx + 1));
+      if (prev == head) break;
+      head = prev;
+    }
+  }
+  return 0;
+}
+
+void
+dart_slab_stats(struct dart_slab_pool * pool, dart_memalloc_stats_t * stats)
+{
+  stats->pool_size           = pool->size;
+  stats->bytes_used          = DART_FETCH64(&pool->bytes_used);
+  stats->bytes_reserved      = DART_FETCH64(&pool->bytes_reserved);
+  stats->bytes_reserved_peak = DART_FETCH64(&pool->bytes_reserved_peak);
+  stats->bytes_largest_free  = dart_buddy_largest_free(pool->buddy);
+  stats->num_allocs          = DART_FETCH64(&pool->num_allocs);
+  stats->num_slabs           = DART_FETCH64(&pool->num_slabs);
+}
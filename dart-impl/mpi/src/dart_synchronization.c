@@ -2,11 +2,25 @@
  *  \file  dart_synchronization.c
  *
  *  Synchronization operations.
+ *
+ *  Locks are implemented as cohort locks: units located on the same node
+ *  first acquire a node-local ticket lock. The unit owning the node-local
+ *  lock then acquires a global MCS lock in which every node is represented
+ *  by its leader, the unit with node-local rank 0.
+ *  On release, the global lock is handed to the next waiting unit on the
+ *  same node without releasing it to other nodes, up to
+ *  \c DART_LOCK_HANDOFF_MAX consecutive times.
+ *  All spinning is performed on words in the memory of the node leader, so
+ *  waiting units do not generate traffic across nodes.
+ *
+ *  Reader-writer locks count readers in a single word updated with atomic
+ *  operations, writers are ordered by a lock as above.
  */
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
 #include <dash/dart/base/mutex.h>
+#include <dash/dart/base/atomic.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -21,36 +35,373 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <unistd.h>
 #include <malloc.h>
 
+/**
+ * Default for the maximum number of consecutive node-local handoffs of a
+ * lock before it is released to other nodes.
+ * Can be overridden using the environment variable of the same name.
+ */
+#ifndef DART_LOCK_HANDOFF_MAX
+#define DART_LOCK_HANDOFF_MAX 64
+#endif
+
+#define DART_LOCK_HANDOFF_MAX_ENVSTR "DART_LOCK_HANDOFF_MAX"
+
+/**
+ * State of a lock allocated in the memory of every unit.
+ * Only the instance at the leader of a node is used.
+ */
+typedef struct dart_lock_node
+{
+  /** Leader of the node following this node in the global queue. */
+  int32_t mcs_next;
+  /** Non-zero while this node waits for its predecessor node. */
+  int32_t mcs_locked;
+  /** Next ticket to be drawn by a unit on this node. */
+  int32_t ticket;
+  /** Ticket of the unit owning the node-local lock. */
+  int32_t serving;
+  /** Whether this node currently holds the global lock. */
+  int32_t global_held;
+  /** Number of consecutive handoffs on this node. */
+  int32_t handoffs;
+} dart_lock_node_t;
 
 struct dart_lock_struct
 {
   /**
-   * Global memory storing the unit at the tail of lock queue.
-   * Stored in team-unit 0 by default.
+   * Global memory storing the node leader at the tail of the global lock
+   * queue. Stored in team-unit 0 by default.
    */
   dart_gptr_t  gptr_tail;
+  /** The window containing \c gptr_tail. */
+  MPI_Win      tail_win;
   /**
-   * Pointer to the current unit's successor in the waiting list,
-   * to which we send a release message.
+   * Team-aligned global memory containing a \c dart_lock_node_t
+   * instance at every unit.
    */
-  dart_gptr_t  gptr_list;
+  dart_gptr_t  gptr_node;
   /**
    * Local mutex to ensure mutual exclusion between threads.
    */
   dart_mutex_t mutex;
   dart_team_t teamid;
+  /** The leader of the node of this unit. */
+  dart_team_unit_t leader;
+  /** The ticket drawn by this unit while holding the lock. */
+  int32_t ticket;
+  /** Maximum number of consecutive handoffs on the node. */
+  int32_t handoff_max;
   /** Whether this unit has acquired the lock. */
   int32_t is_acquired;
 };
 
+#define DART_LOCK_FIELD(field) offsetof(dart_lock_node_t, field)
+
+static dart_ret_t
+lock_node_target(
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  size_t             field_offset,
+  MPI_Win          * win,
+  MPI_Aint         * disp)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_lock: Unknown team %i!", lock->teamid);
+    return DART_ERR_INVAL;
+  }
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata),
+                                   lock->gptr_node.segid);
+  if (seginfo == NULL) {
+    DART_LOG_ERROR("dart_lock: Unknown segment %i!", lock->gptr_node.segid);
+    return DART_ERR_INVAL;
+  }
+  *win  = seginfo->win;
+  *disp = dart_segment_disp(seginfo, unit) + field_offset;
+  return DART_OK;
+}
+
+/**
+ * Atomically applies \c op with \c value to a field of the lock state at
+ * \c unit and returns the previous value in \c result.
+ */
+static dart_ret_t
+lock_node_fetch_and_op(
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  size_t             field_offset,
+  int32_t            value,
+  MPI_Op             op,
+  int32_t          * result)
+{
+  MPI_Win  win;
+  MPI_Aint disp;
+  dart_ret_t ret = lock_node_target(lock, unit, field_offset, &win, &disp);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value,
+      result,
+      MPI_INT32_T,
+      unit.id,
+      disp,
+      op,
+      win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(unit.id, win),
+    MPI_SUCCESS);
+  return DART_OK;
+}
+
+static dart_ret_t
+lock_node_compare_and_swap(
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  size_t             field_offset,
+  int32_t            value,
+  int32_t            compare,
+  int32_t          * result)
+{
+  MPI_Win  win;
+  MPI_Aint disp;
+  dart_ret_t ret = lock_node_target(lock, unit, field_offset, &win, &disp);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &value,
+      &compare,
+      result,
+      MPI_INT32_T,
+      unit.id,
+      disp,
+      win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(unit.id, win),
+    MPI_SUCCESS);
+  return DART_OK;
+}
+
+static inline dart_ret_t
+lock_node_read(
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  size_t             field_offset,
+  int32_t          * result)
+{
+  return lock_node_fetch_and_op(
+           lock, unit, field_offset, 0, MPI_NO_OP, result);
+}
+
+static inline dart_ret_t
+lock_node_write(
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  size_t             field_offset,
+  int32_t            value)
+{
+  int32_t result;
+  return lock_node_fetch_and_op(
+           lock, unit, field_offset, value, MPI_REPLACE, &result);
+}
+
+/**
+ * Spin until the field of the lock state at \c unit equals \c value
+ * (\c until_equal is non-zero) or differs from \c value (\c until_equal
+ * is zero). The last value read is returned in \c result.
+ */
+static dart_ret_t
+lock_node_wait(
+  dart_lock_t        lock,
+  dart_team_unit_t   unit,
+  size_t             field_offset,
+  int32_t            value,
+  int                until_equal,
+  int32_t          * result)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+  do {
+    // trigger progress
+    int flag;
+    MPI_Iprobe(
+      MPI_ANY_SOURCE, MPI_ANY_TAG,
+      team_data->comm, &flag, MPI_STATUS_IGNORE);
+    dart_ret_t ret = lock_node_read(lock, unit, field_offset, result);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  } while ((*result == value) != (until_equal != 0));
+  return DART_OK;
+}
+
+/**
+ * Determine the leader of this unit's node, i.e. the unit in \c team_data
+ * with node-local rank 0.
+ */
+static dart_team_unit_t
+lock_node_leader(
+  dart_team_data_t * team_data,
+  dart_team_unit_t   unitid)
+{
+  dart_team_unit_t leader = unitid;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  for (int u = 0;
+       team_data->sharedmem_tab != NULL && u < team_data->size; ++u) {
+    if (team_data->sharedmem_tab[u].id == 0) {
+      leader = DART_TEAM_UNIT_ID(u);
+      break;
+    }
+  }
+#else
+  (void)team_data;
+#endif
+  return leader;
+}
+
+static int32_t
+lock_handoff_max()
+{
+  const char *envstr = getenv(DART_LOCK_HANDOFF_MAX_ENVSTR);
+  if (envstr != NULL) {
+    char *end;
+    long  value = strtol(envstr, &end, 10);
+    if (end != envstr && value >= 0 && value <= INT32_MAX) {
+      return (int32_t)value;
+    }
+    DART_LOG_WARN("dart_team_lock_init: ignoring invalid value of %s: %s",
+                  DART_LOCK_HANDOFF_MAX_ENVSTR, envstr);
+  }
+  return DART_LOCK_HANDOFF_MAX;
+}
+
+/**
+ * Enqueue the node of this unit in the global MCS lock and wait until the
+ * predecessor node released the lock.
+ */
+static dart_ret_t
+lock_global_acquire(dart_lock_t lock)
+{
+  dart_team_unit_t leader = lock->leader;
+  uint64_t    tail_offset = lock->gptr_tail.addr_or_offs.offset;
+  dart_unit_t tail_unit   = lock->gptr_tail.unitid;
+  int32_t     predecessor;
+
+  DART_ASSERT_RETURNS(
+    lock_node_write(lock, leader, DART_LOCK_FIELD(mcs_next), -1),
+    DART_OK);
+  DART_ASSERT_RETURNS(
+    lock_node_write(lock, leader, DART_LOCK_FIELD(mcs_locked), 1),
+    DART_OK);
+
+  /* Fetch the current tail and make this node the new tail */
+  DART_LOG_TRACE(
+    "dart_lock_acquire: MPI_Fetch_and_op to set tail to unit %i on "
+    "tail_unit %i with offset %lu",
+    leader.id, tail_unit, tail_offset);
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &leader.id,
+      &predecessor,
+      MPI_INT32_T,
+      tail_unit,
+      tail_offset,
+      MPI_REPLACE,
+      lock->tail_win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+      MPI_Win_flush(tail_unit, lock->tail_win),
+      MPI_SUCCESS);
+
+  DART_LOG_TRACE("dart_lock_acquire: predecessor: %i leader: %i",
+    predecessor, leader.id);
+
+  /* If there was a previous tail (predecessor), update the previous tail's
+   * next pointer and wait until the predecessor clears our locked flag.
+   */
+  if (predecessor != -1) {
+    int32_t locked;
+    DART_ASSERT_RETURNS(
+      lock_node_write(
+        lock, DART_TEAM_UNIT_ID(predecessor), DART_LOCK_FIELD(mcs_next),
+        leader.id),
+      DART_OK);
+
+    DART_LOG_DEBUG("dart_lock_acquire: waiting for node of unit %d "
+                   "in team %d", predecessor, lock->teamid);
+    DART_ASSERT_RETURNS(
+      lock_node_wait(
+        lock, leader, DART_LOCK_FIELD(mcs_locked), 0, 1, &locked),
+      DART_OK);
+  }
+  return DART_OK;
+}
+
+/**
+ * Release the global MCS lock held by the node of this unit.
+ */
+static dart_ret_t
+lock_global_release(dart_lock_t lock)
+{
+  dart_team_unit_t leader = lock->leader;
+  uint64_t    tail_offset = lock->gptr_tail.addr_or_offs.offset;
+  dart_unit_t tail_unit   = lock->gptr_tail.unitid;
+  int32_t     result;
+  int32_t     reset = -1;
+
+  /* Check if we are at the tail of this lock queue and reset the tail pointer
+   * if we are. If that is the case we are done.
+   * Otherwise, the reset fails and we need to notify the next node. */
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &reset,
+      &leader.id,
+      &result,
+      MPI_INT32_T,
+      tail_unit,
+      tail_offset,
+      lock->tail_win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(tail_unit, lock->tail_win),
+    MPI_SUCCESS);
+
+  if (result != leader.id) {
+    /* We are not at the tail of this lock queue. */
+    int32_t next;
+    DART_LOG_DEBUG("dart_lock_release: waiting for next pointer "
+                   "(tail = %d) in team %d",
+                   result, lock->teamid);
+    DART_ASSERT_RETURNS(
+      lock_node_wait(
+        lock, leader, DART_LOCK_FIELD(mcs_next), -1, 0, &next),
+      DART_OK);
+
+    DART_LOG_DEBUG("dart_lock_release: notifying node of unit %d "
+                   "in team %d", next, lock->teamid);
+    DART_ASSERT_RETURNS(
+      lock_node_write(
+        lock, DART_TEAM_UNIT_ID(next), DART_LOCK_FIELD(mcs_locked), 0),
+      DART_OK);
+  }
+  return DART_OK;
+}
+
 dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 {
   int ret;
   dart_gptr_t gptr_tail;
-  dart_gptr_t gptr_list;
+  dart_gptr_t gptr_node;
   dart_team_unit_t unitid;
 
   *lock = NULL;
@@ -78,26 +429,32 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 
     /* Local store is safe and effective followed by the sync call. */
     *tail_ptr = -1;
-    MPI_Win_sync(dart_win_local_alloc);
+    MPI_Win_sync(dart__mpi__memalloc_win(gptr_tail));
   }
 
   /* Create a global memory region across the team.
-   * Every local memory segment holds the next unit
-   * waiting on the lock. */
-  ret = dart_team_memalloc_aligned(teamid, 1, DART_TYPE_INT, &gptr_list);
+   * Every local memory segment holds the lock state of a node,
+   * only the instances at node leaders are used. */
+  ret = dart_team_memalloc_aligned(
+          teamid, sizeof(dart_lock_node_t), DART_TYPE_BYTE, &gptr_node);
   if (ret != DART_OK) {
     DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
     return ret;
   }
 
-  int32_t *list_ptr;
-  dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                    &(team_data->segdata), gptr_list.segid);
-  MPI_Win win = list_seginfo->win; // window object used for atomic operations
-
-  dart_gptr_setunit(&gptr_list, unitid);
-  dart_gptr_getaddr(gptr_list, (void*)&list_ptr);
-  *list_ptr = -1;
+  dart_lock_node_t    *node_ptr;
+  dart_segment_info_t *node_seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), gptr_node.segid);
+  MPI_Win win = node_seginfo->win; // window object used for atomic operations
+
+  dart_gptr_setunit(&gptr_node, unitid);
+  dart_gptr_getaddr(gptr_node, (void*)&node_ptr);
+  node_ptr->mcs_next    = -1;
+  node_ptr->mcs_locked  = 0;
+  node_ptr->ticket      = 0;
+  node_ptr->serving     = 0;
+  node_ptr->global_held = 0;
+  node_ptr->handoffs    = 0;
   MPI_Win_sync(win);
 
   // communicate tail pointer
@@ -112,17 +469,29 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
     return ret;
   }
 
+  // make sure the lock state is initialized at all node leaders
+  ret = dart_barrier(teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to synchronize team!", __FUNCTION__);
+    return ret;
+  }
 
   *lock = malloc(sizeof(struct dart_lock_struct));
   (*lock)->gptr_tail   = gptr_tail;
-  (*lock)->gptr_list   = gptr_list;
+  (*lock)->tail_win    = dart__mpi__memalloc_win(gptr_tail);
+  (*lock)->gptr_node   = gptr_node;
   (*lock)->teamid      = teamid;
+  (*lock)->leader      = lock_node_leader(team_data, unitid);
+  (*lock)->ticket      = -1;
+  (*lock)->handoff_max = lock_handoff_max();
   (*lock)->is_acquired = 0;
   DART_ASSERT_RETURNS(
     dart__base__mutex_init_recursive(&(*lock)->mutex),
     DART_OK);
 
-  DART_LOG_DEBUG("dart_team_lock_init: INIT - done");
+  DART_LOG_DEBUG("dart_team_lock_init: INIT - done (leader: %d, "
+                 "handoff_max: %d)",
+                 (*lock)->leader.id, (*lock)->handoff_max);
 
   return DART_OK;
 }
@@ -139,87 +508,37 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
-  if (team_data == NULL) {
-    DART_LOG_ERROR("dart_lock_acquire ! failed: Unknown team %i!",
-                   lock->teamid);
-    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
-    return DART_ERR_INVAL;
-  }
+  dart_team_unit_t leader = lock->leader;
+  int32_t          ticket;
+  int32_t          serving;
+  int32_t          global_held;
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
-  dart_unit_t tail_unit   = gptr_tail.unitid;
-
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
-
-  int32_t predecessor;
-
-  /* Fetch the current unit's tail and make this unit the new tail */
-  DART_LOG_TRACE(
-    "dart_lock_acquire: MPI_Fetch_and_op to set tail to unit %i on "
-    "tail_unit %i with offset %lu",
-    unitid.id, tail_unit, tail_offset);
+  /* Draw a ticket of the node-local lock and wait for our turn */
   DART_ASSERT_RETURNS(
-    MPI_Fetch_and_op(
-      &unitid.id,
-      &predecessor,
-      MPI_INT32_T,
-      tail_unit,
-      tail_offset,
-      MPI_REPLACE,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
+    lock_node_fetch_and_op(
+      lock, leader, DART_LOCK_FIELD(ticket), 1, MPI_SUM, &ticket),
+    DART_OK);
+  DART_LOG_TRACE("dart_lock_acquire: drew ticket %d at leader %d",
+                 ticket, leader.id);
   DART_ASSERT_RETURNS(
-      MPI_Win_flush(tail_unit, dart_win_local_alloc),
-      MPI_SUCCESS);
-
-  DART_LOG_TRACE("dart_lock_acquire: predecessor: %i unitid.id: %i",
-    predecessor, unitid.id);
-
-  /* If there was a previous tail (predecessor), update the previous tail's
-   * next pointer with unitid and wait for notification from its predecessor.
-   */
-  if (predecessor != -1) {
-    int32_t    result;
-    MPI_Status status;
-    int16_t    seg_id = gptr_list.segid;
-
-    dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                      &(team_data->segdata), gptr_list.segid);
-    MPI_Win  win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(
-                            list_seginfo, DART_TEAM_UNIT_ID(predecessor));
-
-    /* Atomicity: Update its predecessor's next pointer */
-    DART_ASSERT_RETURNS(
-      MPI_Fetch_and_op(
-        &unitid.id,
-        &result,
-        MPI_INT32_T,
-        predecessor,
-        disp_list,
-        MPI_REPLACE,
-        win),
-      MPI_SUCCESS);
+    lock_node_wait(
+      lock, leader, DART_LOCK_FIELD(serving), ticket, 1, &serving),
+    DART_OK);
 
+  /* The global lock may have been handed over by a unit on our node */
+  DART_ASSERT_RETURNS(
+    lock_node_read(lock, leader, DART_LOCK_FIELD(global_held), &global_held),
+    DART_OK);
+  if (!global_held) {
+    DART_ASSERT_RETURNS(lock_global_acquire(lock), DART_OK);
     DART_ASSERT_RETURNS(
-      MPI_Win_flush(predecessor, win),
+      lock_node_write(lock, leader, DART_LOCK_FIELD(global_held), 1),
       DART_OK);
-
-    /* Waiting for notification from its predecessor*/
-    DART_LOG_DEBUG("dart_lock_acquire: waiting for notification from "
-                   "%d in team %d",
-                   predecessor, lock->teamid);
-
-    MPI_Recv(NULL, 0, MPI_INT, predecessor, 0, team_data->comm,
-        &status);
   }
 
-  DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d", lock->teamid);
+  DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d%s",
+                 lock->teamid, global_held ? " (handoff)" : "");
+  lock->ticket      = ticket;
   lock->is_acquired = 1;
   return DART_OK;
 }
@@ -241,40 +560,69 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
     return DART_ERR_INVAL;
   }
 
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
-
-  int32_t result;
-  int32_t compare = -1;
+  dart_team_unit_t leader = lock->leader;
+  int32_t          serving;
+  int32_t          ticket;
+  int32_t          global_held;
 
+  *is_acquired = 0;
 
-  dart_gptr_t gptr_tail   = lock->gptr_tail;
-  dart_unit_t tail_unit   = gptr_tail.unitid;
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
-
-  /* Atomicity: Check if the lock is available and claim it if it is. */
+  /* Atomicity: Draw a ticket only if the node-local lock is available. */
   DART_ASSERT_RETURNS(
-    MPI_Compare_and_swap(
-      &unitid.id,
-      &compare,
-      &result,
-      MPI_INT32_T,
-      tail_unit,
-      tail_offset,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
+    lock_node_read(lock, leader, DART_LOCK_FIELD(serving), &serving),
+    DART_OK);
   DART_ASSERT_RETURNS(
-    MPI_Win_flush (tail_unit, dart_win_local_alloc),
-    MPI_SUCCESS);
+    lock_node_compare_and_swap(
+      lock, leader, DART_LOCK_FIELD(ticket), serving + 1, serving, &ticket),
+    DART_OK);
 
-  /* If the old predecessor was -1, we have claimed the lock,
-   * otherwise, do nothing. */
-  if (result == -1)
-  {
+  if (ticket == serving) {
+    DART_ASSERT_RETURNS(
+      lock_node_read(
+        lock, leader, DART_LOCK_FIELD(global_held), &global_held),
+      DART_OK);
+    if (global_held) {
+      *is_acquired = 1;
+    } else {
+      /* Atomicity: Check if the global lock is available and claim it if
+       * it is. */
+      int32_t result;
+      int32_t compare = -1;
+      DART_ASSERT_RETURNS(
+        lock_node_write(lock, leader, DART_LOCK_FIELD(mcs_next), -1),
+        DART_OK);
+      DART_ASSERT_RETURNS(
+        MPI_Compare_and_swap(
+          &leader.id,
+          &compare,
+          &result,
+          MPI_INT32_T,
+          lock->gptr_tail.unitid,
+          lock->gptr_tail.addr_or_offs.offset,
+          lock->tail_win),
+        MPI_SUCCESS);
+      DART_ASSERT_RETURNS(
+        MPI_Win_flush(lock->gptr_tail.unitid, lock->tail_win),
+        MPI_SUCCESS);
+      if (result == -1) {
+        DART_ASSERT_RETURNS(
+          lock_node_write(lock, leader, DART_LOCK_FIELD(global_held), 1),
+          DART_OK);
+        *is_acquired = 1;
+      } else {
+        /* Return our ticket to the next unit on the node */
+        DART_ASSERT_RETURNS(
+          lock_node_fetch_and_op(
+            lock, leader, DART_LOCK_FIELD(serving), 1, MPI_SUM, &serving),
+          DART_OK);
+      }
+    }
+  }
+
+  if (*is_acquired) {
+    lock->ticket      = ticket;
     lock->is_acquired = 1;
-    *is_acquired = 1;
   } else {
-    *is_acquired = 0;
     /* unlock the local mutex if we have not acqcuired the global lock */
     DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
   }
@@ -292,82 +640,47 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
+  dart_team_unit_t leader = lock->leader;
+  int32_t          ticket;
+  int32_t          handoffs;
+  int32_t          serving;
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
-  DART_ASSERT(team_data != NULL);
-
-  uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
-  dart_unit_t   tail        = gptr_tail.unitid;
-  int32_t     * addr;
-  DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr_list, (void *)&addr), DART_OK);
-
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
-
-  int32_t result;
-  int32_t reset = -1;
-
-  /* Check if we are at the tail of this lock queue and reset the tail pointer
-   * if we are. If that is the case we are done.
-   * Otherwise, the reset fails and we need to send notification. */
+  /* Units on our node waiting for the node-local lock */
   DART_ASSERT_RETURNS(
-    MPI_Compare_and_swap(
-      &reset,
-      &unitid.id,
-      &result,
-      MPI_INT32_T,
-      tail,
-      offset_tail,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
+    lock_node_read(lock, leader, DART_LOCK_FIELD(ticket), &ticket),
+    DART_OK);
+  int32_t num_waiting = (int32_t)((uint32_t)ticket -
+                                  (uint32_t)lock->ticket - 1);
+
   DART_ASSERT_RETURNS(
-    MPI_Win_flush(tail, dart_win_local_alloc),
-    MPI_SUCCESS);
+    lock_node_read(lock, leader, DART_LOCK_FIELD(handoffs), &handoffs),
+    DART_OK);
 
-  if (result != unitid.id) {
-    /* We are not at the tail of this lock queue. */
-    int32_t  next;
-    DART_LOG_DEBUG("dart_lock_release: waiting for next pointer "
-                   "(tail = %d) in team %d",
-                   result, (lock -> teamid));
-
-    dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                      &(team_data->segdata), gptr_list.segid);
-    MPI_Win win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(list_seginfo, unitid);
-
-    /* Wait for the update of our next pointer. */
-    do {
-      // trigger progress
-      int flag;
-      MPI_Iprobe(
-        MPI_ANY_SOURCE, MPI_ANY_TAG,
-        team_data->comm, &flag, MPI_STATUS_IGNORE);
-      DART_ASSERT_RETURNS(
-        MPI_Fetch_and_op(
-          NULL,
-          &next,
-          MPI_INT,
-          unitid.id,
-          disp_list,
-          MPI_NO_OP,
-          win),
-        MPI_SUCCESS);
-      DART_ASSERT_RETURNS(
-        MPI_Win_flush(unitid.id, win),
-        MPI_SUCCESS);
-    } while (next == -1);
+  if (num_waiting > 0 && handoffs < lock->handoff_max) {
+    /* Keep the global lock on this node for the next local unit */
+    DART_LOG_DEBUG("dart_lock_release: handing lock to %d waiting units "
+                   "on node (handoff %d) in team %d",
+                   num_waiting, handoffs + 1, lock->teamid);
+    DART_ASSERT_RETURNS(
+      lock_node_write(lock, leader, DART_LOCK_FIELD(handoffs), handoffs + 1),
+      DART_OK);
+  } else {
+    DART_ASSERT_RETURNS(lock_global_release(lock), DART_OK);
+    DART_ASSERT_RETURNS(
+      lock_node_write(lock, leader, DART_LOCK_FIELD(global_held), 0),
+      DART_OK);
+    DART_ASSERT_RETURNS(
+      lock_node_write(lock, leader, DART_LOCK_FIELD(handoffs), 0),
+      DART_OK);
+  }
 
-    DART_LOG_DEBUG("dart_lock_release: notifying %d in team %d", next,
-                   (lock->teamid));
+  /* Pass the node-local lock to the next ticket */
+  DART_ASSERT_RETURNS(
+    lock_node_fetch_and_op(
+      lock, leader, DART_LOCK_FIELD(serving), 1, MPI_SUM, &serving),
+    DART_OK);
 
-    /* Notifying the next unit waiting on the lock queue. */
-    MPI_Send(NULL, 0, MPI_INT, next, 0, team_data->comm);
-    *addr = -1;
-    MPI_Win_sync(win);
-  }
+  lock->ticket      = -1;
   lock->is_acquired = 0;
   DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
   DART_LOG_DEBUG("dart_lock_release: release lock in team %d",
@@ -380,7 +693,7 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
   dart_ret_t ret;
   dart_team_unit_t unitid;
   dart_gptr_t gptr_tail = (*lock)->gptr_tail;
-  dart_gptr_t gptr_list = (*lock)->gptr_list;
+  dart_gptr_t gptr_node = (*lock)->gptr_node;
   dart_team_t teamid    = (*lock)->teamid;
 
   dart_team_myid(teamid, &unitid);
@@ -394,13 +707,13 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
       return ret;
     }
   }
-  ret = dart_team_memfree(gptr_list);
+  ret = dart_team_memfree(gptr_node);
   if (ret != DART_OK) {
     DART_LOG_ERROR("Failed to free global mmeory");
     return ret;
   }
   (*lock)->gptr_tail = DART_GPTR_NULL;
-  (*lock)->gptr_list = DART_GPTR_NULL;
+  (*lock)->gptr_node = DART_GPTR_NULL;
   (*lock)->teamid    = DART_TEAM_NULL;
   dart__base__mutex_destroy(&(*lock)->mutex);
   DART_LOG_DEBUG("dart_team_lock_free: done in team %d", teamid);
@@ -410,5 +723,334 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 }
 
 
+/**
+ * Flag in the state of a reader-writer lock that is set while a writer
+ * holds or waits for the lock. The remaining bits contain the number of
+ * readers holding the lock.
+ */
+#define DART_RWLOCK_WRITER ((int32_t)1 << 30)
+
+struct dart_rwlock_struct
+{
+  /**
+   * Global memory storing the state of the lock.
+   * Stored in team-unit 0 by default.
+   */
+  dart_gptr_t  gptr_state;
+  /** The window containing \c gptr_state. */
+  MPI_Win      state_win;
+  /**
+   * Lock establishing the order of writers.
+   */
+  dart_lock_t  writer_lock;
+  dart_team_t  teamid;
+  /** Number of threads of this unit holding the lock for reading. */
+  int32_t      num_readers;
+};
+
+/**
+ * Atomically applies \c op with \c value to the state of \c lock and
+ * returns the previous state in \c result.
+ */
+static dart_ret_t
+rwlock_state_fetch_and_op(
+  dart_rwlock_t   lock,
+  int32_t         value,
+  MPI_Op          op,
+  int32_t       * result)
+{
+  dart_unit_t state_unit   = lock->gptr_state.unitid;
+  uint64_t    state_offset = lock->gptr_state.addr_or_offs.offset;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value,
+      result,
+      MPI_INT32_T,
+      state_unit,
+      state_offset,
+      op,
+      lock->state_win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(state_unit, lock->state_win),
+    MPI_SUCCESS);
+  return DART_OK;
+}
+
+/**
+ * Spin until the state of \c lock satisfies
+ * <tt>(state & mask) == value</tt>.
+ */
+static dart_ret_t
+rwlock_state_wait(
+  dart_rwlock_t   lock,
+  int32_t         mask,
+  int32_t         value)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+  int32_t state;
+  do {
+    // trigger progress
+    int flag;
+    MPI_Iprobe(
+      MPI_ANY_SOURCE, MPI_ANY_TAG,
+      team_data->comm, &flag, MPI_STATUS_IGNORE);
+    DART_ASSERT_RETURNS(
+      rwlock_state_fetch_and_op(lock, 0, MPI_NO_OP, &state),
+      DART_OK);
+  } while ((state & mask) != value);
+  return DART_OK;
+}
+
+dart_ret_t dart_team_rwlock_init(dart_team_t teamid, dart_rwlock_t* lock)
+{
+  int ret;
+  dart_gptr_t gptr_state;
+  dart_team_unit_t unitid;
+  dart_lock_t writer_lock;
+
+  *lock = NULL;
+
+  if (dart_adapt_teamlist_get(teamid) == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_myid(teamid, &unitid);
+
+  /* Unit 0 is the process holding the lock state by default. */
+  if (unitid.id == 0) {
+    int32_t *state_ptr;
+    ret = dart_memalloc(1, DART_TYPE_INT, &gptr_state);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+      return ret;
+    }
+    DART_ASSERT_RETURNS(
+      dart_gptr_getaddr(gptr_state, (void*)&state_ptr),
+      DART_OK);
+
+    /* Local store is safe and effective followed by the sync call. */
+    *state_ptr = 0;
+    MPI_Win_sync(dart__mpi__memalloc_win(gptr_state));
+  }
+
+  ret = dart_team_lock_init(teamid, &writer_lock);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to initialize writer lock!", __FUNCTION__);
+    return ret;
+  }
+
+  // communicate state pointer
+  ret = dart_bcast(
+    &gptr_state,
+    sizeof(dart_gptr_t),
+    DART_TYPE_BYTE,
+    DART_TEAM_UNIT_ID(0),
+    teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to broadcast lock information!", __FUNCTION__);
+    return ret;
+  }
+
+  *lock = malloc(sizeof(struct dart_rwlock_struct));
+  (*lock)->gptr_state  = gptr_state;
+  (*lock)->state_win   = dart__mpi__memalloc_win(gptr_state);
+  (*lock)->writer_lock = writer_lock;
+  (*lock)->teamid      = teamid;
+  (*lock)->num_readers = 0;
 
+  DART_LOG_DEBUG("dart_team_rwlock_init: INIT - done");
 
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire_read(dart_rwlock_t lock)
+{
+  int32_t state;
+
+  /* Register as reader unless a writer holds or waits for the lock,
+   * otherwise back off and wait for the writer to release the lock */
+  for (;;) {
+    DART_ASSERT_RETURNS(
+      rwlock_state_fetch_and_op(lock, 1, MPI_SUM, &state),
+      DART_OK);
+    if (!(state & DART_RWLOCK_WRITER)) {
+      break;
+    }
+    DART_ASSERT_RETURNS(
+      rwlock_state_fetch_and_op(lock, -1, MPI_SUM, &state),
+      DART_OK);
+    DART_LOG_TRACE("dart_rwlock_acquire_read: waiting for writer "
+                   "in team %d", lock->teamid);
+    DART_ASSERT_RETURNS(
+      rwlock_state_wait(lock, DART_RWLOCK_WRITER, 0),
+      DART_OK);
+  }
+  DART_FETCH_AND_INC32(&lock->num_readers);
+
+  DART_LOG_DEBUG("dart_rwlock_acquire_read: lock acquired in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire_read(dart_rwlock_t lock, int32_t *result)
+{
+  int32_t state;
+
+  DART_ASSERT_RETURNS(
+    rwlock_state_fetch_and_op(lock, 1, MPI_SUM, &state),
+    DART_OK);
+  if (state & DART_RWLOCK_WRITER) {
+    DART_ASSERT_RETURNS(
+      rwlock_state_fetch_and_op(lock, -1, MPI_SUM, &state),
+      DART_OK);
+    *result = 0;
+  } else {
+    DART_FETCH_AND_INC32(&lock->num_readers);
+    *result = 1;
+  }
+
+  DART_LOG_DEBUG("dart_rwlock_try_acquire_read: trylock %s in team %d",
+                 (*result) ? "succeeded" : "failed",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release_read(dart_rwlock_t lock)
+{
+  int32_t state;
+
+  if (DART_FETCH_AND_DEC32(&lock->num_readers) <= 0) {
+    DART_FETCH_AND_INC32(&lock->num_readers);
+    DART_LOG_ERROR("dart_rwlock_release_read: LOCK has not been acquired "
+                   "for reading before\n");
+    return DART_ERR_INVAL;
+  }
+
+  DART_ASSERT_RETURNS(
+    rwlock_state_fetch_and_op(lock, -1, MPI_SUM, &state),
+    DART_OK);
+
+  DART_LOG_DEBUG("dart_rwlock_release_read: release lock in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire_write(dart_rwlock_t lock)
+{
+  int32_t state;
+
+  /* Wait for writers queued before this unit */
+  dart_ret_t ret = dart_lock_acquire(lock->writer_lock);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  /* Keep new readers out and wait for active readers to finish */
+  DART_ASSERT_RETURNS(
+    rwlock_state_fetch_and_op(lock, DART_RWLOCK_WRITER, MPI_SUM, &state),
+    DART_OK);
+  if (state != 0) {
+    DART_LOG_TRACE("dart_rwlock_acquire_write: waiting for %d readers "
+                   "in team %d", state, lock->teamid);
+    DART_ASSERT_RETURNS(
+      rwlock_state_wait(lock, ~0, DART_RWLOCK_WRITER),
+      DART_OK);
+  }
+
+  DART_LOG_DEBUG("dart_rwlock_acquire_write: lock acquired in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire_write(dart_rwlock_t lock, int32_t *result)
+{
+  int32_t acquired;
+
+  *result = 0;
+
+  dart_ret_t ret = dart_lock_try_acquire(lock->writer_lock, &acquired);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  if (acquired) {
+    /* Atomicity: Claim the lock only if there are no readers. */
+    int32_t state;
+    int32_t compare = 0;
+    int32_t value   = DART_RWLOCK_WRITER;
+    DART_ASSERT_RETURNS(
+      MPI_Compare_and_swap(
+        &value,
+        &compare,
+        &state,
+        MPI_INT32_T,
+        lock->gptr_state.unitid,
+        lock->gptr_state.addr_or_offs.offset,
+        lock->state_win),
+      MPI_SUCCESS);
+    DART_ASSERT_RETURNS(
+      MPI_Win_flush(lock->gptr_state.unitid, lock->state_win),
+      MPI_SUCCESS);
+    if (state == 0) {
+      *result = 1;
+    } else {
+      DART_ASSERT_RETURNS(dart_lock_release(lock->writer_lock), DART_OK);
+    }
+  }
+
+  DART_LOG_DEBUG("dart_rwlock_try_acquire_write: trylock %s in team %d",
+                 (*result) ? "succeeded" : "failed",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release_write(dart_rwlock_t lock)
+{
+  int32_t state;
+
+  if (!lock->writer_lock->is_acquired) {
+    DART_LOG_ERROR("dart_rwlock_release_write: LOCK has not been acquired "
+                   "for writing before\n");
+    return DART_ERR_INVAL;
+  }
+
+  DART_ASSERT_RETURNS(
+    rwlock_state_fetch_and_op(lock, -DART_RWLOCK_WRITER, MPI_SUM, &state),
+    DART_OK);
+  dart_ret_t ret = dart_lock_release(lock->writer_lock);
+
+  DART_LOG_DEBUG("dart_rwlock_release_write: release lock in team %d",
+                 lock->teamid);
+  return ret;
+}
+
+dart_ret_t dart_team_rwlock_destroy(dart_rwlock_t* lock)
+{
+  dart_ret_t ret;
+  dart_team_unit_t unitid;
+  dart_gptr_t gptr_state = (*lock)->gptr_state;
+  dart_team_t teamid     = (*lock)->teamid;
+
+  dart_team_myid(teamid, &unitid);
+
+  /* Unit 0 is the process holding the lock state by default. */
+  if (unitid.id == 0) {
+    ret = dart_memfree(gptr_state);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("Failed to free global memory");
+      return ret;
+    }
+  }
+  ret = dart_team_lock_destroy(&(*lock)->writer_lock);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("Failed to destroy writer lock");
+    return ret;
+  }
+  (*lock)->gptr_state = DART_GPTR_NULL;
+  (*lock)->teamid     = DART_TEAM_NULL;
+  DART_LOG_DEBUG("dart_team_rwlock_destroy: done in team %d", teamid);
+  free(*lock);
+  *lock = NULL;
+  return DART_OK;
+}
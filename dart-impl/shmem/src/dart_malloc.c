@@ -7,6 +7,8 @@
 #include <dash/dart/shmem/dart_teams_impl.h>
 #include <dash/dart/shmem/shmem_logger.h>
 
+#include <dash/dart/base/logging.h>
+
 /* TO IMPLEMENT */
 /*
 dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void *addr);
@@ -38,6 +40,13 @@ dart_ret_t dart_gptr_getaddr(
   return DART_OK;
 }
 
+dart_ret_t dart_gptr_getaddr_shared(
+  const dart_gptr_t gptr,
+  void **addr) {
+  (*addr) = NULL;
+  return DART_ERR_OTHER;
+}
+
 dart_ret_t dart_gptr_setaddr(
   dart_gptr_t *gptr,
   void *addr) {
@@ -173,6 +182,13 @@ dart_ret_t dart_memfree(
   return DART_OK;
 }
 
+dart_ret_t dart_memalloc_stats(
+  dart_memalloc_stats_t *stats) {
+  memset(stats, 0, sizeof(dart_memalloc_stats_t));
+  DART_LOG_ERROR("dart_memalloc_stats: not supported by the shmem backend");
+  return DART_ERR_OTHER;
+}
+
 dart_ret_t dart_team_memfree(
   dart_team_t teamid,
   dart_gptr_t gptr) {
@@ -126,6 +126,39 @@ dart_ret_t dart_put_handle(
   return DART_ERR_OTHER;
 }
 
+dart_ret_t dart_accumulate_handle(
+  dart_gptr_t      ptr,
+  const void     * values,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_handle_t  * handle)
+{
+  return DART_ERR_OTHER;
+}
+
+dart_ret_t dart_fetch_and_op_handle(
+  dart_gptr_t      ptr,
+  const void     * value,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_handle_t  * handle)
+{
+  return DART_ERR_OTHER;
+}
+
+dart_ret_t dart_bcast_handle(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle)
+{
+  return DART_ERR_OTHER;
+}
+
 dart_ret_t dart_flush(
   dart_gptr_t gptr)
 {
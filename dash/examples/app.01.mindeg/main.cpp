@@ -31,6 +31,7 @@ bool operator<(const node_t & x, const node_t & y)
 }
 
 typedef dash::Array<node_t> nodearray_t;
+typedef dash::ReadCache<nodearray_t> nodecache_t;
 
 std::ostream & operator<<(std::ostream & os, const node_t & n)
 {
@@ -63,7 +64,7 @@ int init_nodes(
 #endif
 
 void get_reach(
-  nodearray_t & nodes,
+  nodecache_t & nodes,
   int min_node_id,            // 1-based
   int elim_step,
   std::vector<int> & reach_set);
@@ -121,6 +122,9 @@ int main(int argc, char * argv[])
   }
 #endif
 
+  // Nodes are read repeatedly when computing reachable sets, the cache
+  // is invalidated at the barriers between elimination steps:
+  nodecache_t node_cache(nodes);
 
   for (size_t step = 1; step <= nodes.size(); ++step) {
     dash::barrier();
@@ -142,7 +146,7 @@ int main(int argc, char * argv[])
 
     dash::barrier();
     std::vector<int> reach;
-    get_reach(nodes, min_id, step, reach);
+    get_reach(node_cache, min_id, step, reach);
 
     for (auto it = reach.begin(); it != reach.end(); ++it) {
       int nghb_id = *it;
@@ -153,7 +157,7 @@ int main(int argc, char * argv[])
       // vector<node_t *> nghb_reach;
       std::vector<int> nghb_reach;
 
-      get_reach(nodes, nghb_id, step + 1, nghb_reach);
+      get_reach(node_cache, nghb_id, step + 1, nghb_reach);
       nodes[nghb_id - 1].member(&node_t::degree) = nghb_reach.size();
     }
     schedule.push_back(min_id);
@@ -358,7 +362,7 @@ int find_min_degree_node(nodearray_t & nodes)
 }
 
 void get_reach(
-  nodearray_t & nodes,
+  nodecache_t & nodes,
   int min_node_id,
   int elim_step,
   std::vector<int> & reach_set)
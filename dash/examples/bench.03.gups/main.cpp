@@ -45,6 +45,7 @@ typedef struct benchmark_params_t {
   size_t num_updates;
   size_t rep_base;
   bool   verify;
+  bool   async;
 } benchmark_params;
 
 using std::cout;
@@ -102,6 +103,17 @@ void RandomAccessUpdate(const benchmark_params & params)
   uint64_t ran = starts(params.num_updates / dash::size() * dash::myid());
   auto     table_size = params.size_base;
 
+  if (params.async) {
+    // Atomic updates, kept in flight in batches of up to
+    // dash::internal::AsyncOps::Capacity operations until flush:
+    for (i = dash::myid(); i < params.num_updates; i += dash::size()) {
+      ran           = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
+      int64_t g_idx = static_cast<int64_t>(ran & (table_size-1));
+      Table.async[g_idx].op(dash::bit_xor<value_t>(), ran);
+    }
+    Table.async.flush();
+    return;
+  }
   for (i = dash::myid(); i < params.num_updates; i += dash::size()) {
     ran           = (ran << 1) ^ (((int64_t) ran < 0) ? POLY : 0);
     int64_t g_idx = static_cast<int64_t>(ran & (table_size-1));
@@ -283,6 +295,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.num_updates = NUPDATE;
   params.rep_base    = 1;
   params.verify      = false;
+  params.async       = false;
 
   for (auto i = 1; i < argc; i += 2) {
     std::string flag = argv[i];
@@ -293,6 +306,9 @@ benchmark_params parse_args(int argc, char * argv[])
     } else if (flag == "-verify") {
       params.verify    = true;
       --i;
+    } else if (flag == "-async") {
+      params.async     = true;
+      --i;
     }
   }
   return params;
@@ -310,6 +326,7 @@ void print_params(
   bench_cfg.print_param("-sb",     "size base",    params.size_base);
   bench_cfg.print_param("-rb",     "rep. base",    params.rep_base);
   bench_cfg.print_param("-verify", "verification", params.verify);
+  bench_cfg.print_param("-async",  "async atomic", params.async);
   bench_cfg.print_section_end();
 }
 
@@ -0,0 +1,205 @@
+/**
+ * Measures the throughput of dash::sort on arrays of uniformly
+ * distributed random keys for increasing array sizes.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef int sort_key_t;
+
+typedef struct benchmark_params_t {
+  long   size_base;
+  long   size_max;
+  int    num_reps;
+  long   max_key;
+} benchmark_params;
+
+typedef struct measurement_t {
+  long        local_size;
+  double      time_s;
+  double      keys_s_unit;
+  bool        sorted;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate(
+              long size,
+              benchmark_params params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  measurement res;
+
+  dash::util::BenchmarkParams bench_params("bench.04.sort");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  for (long size = params.size_base; size <= params.size_max; size *= 4) {
+    res = evaluate(size, params);
+    print_measurement_record(bench_cfg, res, params);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(long size, benchmark_params params)
+{
+  measurement mes;
+  auto myid   = dash::myid();
+  auto nunits = dash::size();
+
+  dash::Array<sort_key_t> keys(size * nunits, dash::BLOCKED);
+
+  std::mt19937 rng(myid);
+  std::uniform_int_distribution<sort_key_t> key_dist(0, params.max_key);
+
+  double time_s = 0;
+  bool   sorted = true;
+  for (int rep = 0; rep < params.num_reps; ++rep) {
+    for (auto lit = keys.lbegin(); lit != keys.lend(); ++lit) {
+      *lit = key_dist(rng);
+    }
+    keys.barrier();
+
+    auto ts_start = Timer::Now();
+    dash::sort(keys.begin(), keys.end());
+    time_s += Timer::ElapsedSince(ts_start) / (1000 * 1000);
+
+    // Validate local order and order at the lower block boundary:
+    sorted = sorted && std::is_sorted(keys.lbegin(), keys.lend());
+    if (myid > 0 && size > 0) {
+      sorted = sorted &&
+               static_cast<sort_key_t>(keys[myid * size - 1]) <= keys.local[0];
+    }
+  }
+  dash::barrier();
+
+  mes.local_size  = size;
+  mes.time_s      = time_s / params.num_reps;
+  mes.keys_s_unit = size / mes.time_s;
+  mes.sorted      = sorted;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "l.size"     << ","
+         << std::setw(12) << "g.size"     << ","
+         << std::setw( 6) << "reps"       << ","
+         << std::setw(10) << "time.s"     << ","
+         << std::setw(14) << "keys/s/unit" << ","
+         << std::setw( 7) << "sorted"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5)  << dash::size()                  << ","
+         << std::setw(9)  << mpi_impl                      << ","
+         << std::setw(12) << mes.local_size                << ","
+         << std::setw(12) << mes.local_size * dash::size() << ","
+         << std::setw(6)  << params.num_reps               << ","
+         << std::fixed << setprecision(4) << setw(10) << mes.time_s << ","
+         << std::fixed << setprecision(2) << setw(13)
+         << (mes.keys_s_unit / 1000 / 1000) << "M,"
+         << std::setw(7)  << (mes.sorted ? "yes" : "no")
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_base = 1000;
+  params.size_max  = 16 * 1024 * 1024;
+  params.num_reps  = 3;
+  params.max_key   = std::numeric_limits<sort_key_t>::max();
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-sb") {
+      params.size_base = atol(argv[i+1]);
+    }
+    if (flag == "-smax") {
+      params.size_max  = atol(argv[i+1]);
+    }
+    if (flag == "-r") {
+      params.num_reps  = atoi(argv[i+1]);
+    }
+    if (flag == "-k") {
+      params.max_key   = atol(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-sb",   "initial local array size", params.size_base);
+  bench_cfg.print_param("-smax", "maximum local array size", params.size_max);
+  bench_cfg.print_param("-r",    "repetitions per size",     params.num_reps);
+  bench_cfg.print_param("-k",    "maximum key value",        params.max_key);
+  bench_cfg.print_section_end();
+}
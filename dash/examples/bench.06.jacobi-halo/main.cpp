@@ -0,0 +1,318 @@
+/**
+ * Jacobi iteration on 2-D and 3-D matrices with halo exchange.
+ *
+ * Compares variants of every iteration:
+ *
+ * - blocking: all halo regions are updated before the stencil is applied
+ *   to the inner and boundary elements.
+ * - overlap:  \c dash::StencilOperator applies the stencil to the inner
+ *   elements while the halo regions are in flight and completes the
+ *   boundary elements as the regions arrive.
+ * - shared:   like overlap, halo regions of units on the same node are
+ *   read in place (\c dash::HaloUpdateMode::SHARED).
+ * - push:     like overlap, owners put boundary elements to the halo
+ *   buffers of their neighbors (\c dash::HaloUpdateMode::PUSH).
+ * - deep-k:   halo regions are k times as wide as the stencil, updated
+ *   once every k iterations (\c dash::StencilOperator::apply_sweeps).
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <utility>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef struct benchmark_params_t {
+  long   size_2d;
+  long   size_3d;
+  int    iterations;
+} benchmark_params;
+
+/**
+ * Jacobi update, the new value of an element is the mean of its
+ * neighbors.
+ */
+template <int NumStencilPoints>
+struct JacobiKernel {
+  double* out;
+
+  template <typename IteratorT>
+  void operator()(IteratorT& it) const {
+    double sum = 0;
+    for(int i = 0; i < NumStencilPoints; ++i)
+      sum += it.value_at(i);
+    out[it.lpos()] = sum / NumStencilPoints;
+  }
+};
+
+/**
+ * Jacobi update of an element that may lie in a halo region, returns the
+ * new value.
+ */
+template <int NumStencilPoints>
+struct JacobiSweepKernel {
+  template <typename IteratorT>
+  double operator()(IteratorT& it) const {
+    double sum = 0;
+    for(int i = 0; i < NumStencilPoints; ++i)
+      sum += it.value_at(i);
+    return sum / NumStencilPoints;
+  }
+};
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(const benchmark_params & params);
+
+void print_measurement(
+  const std::string & name,
+  const std::string & variant,
+  long                size,
+  int                 iterations,
+  double              time_us);
+
+typedef struct variant_t {
+  const char           * name;
+  bool                   overlap;
+  dash::HaloUpdateMode   mode;
+  uint16_t               depth;
+} variant;
+
+const variant variants[] = {
+  { "blocking", false, dash::HaloUpdateMode::GET,    1 },
+  { "overlap",  true,  dash::HaloUpdateMode::GET,    1 },
+  { "shared",   true,  dash::HaloUpdateMode::SHARED, 1 },
+  { "push",     true,  dash::HaloUpdateMode::PUSH,   1 },
+  { "deep-2",   false, dash::HaloUpdateMode::GET,    2 },
+  { "deep-4",   false, dash::HaloUpdateMode::GET,    4 }
+};
+
+template <typename MatrixT, typename StencilSpecT, typename CycleSpecT>
+double run_jacobi(
+  MatrixT            & matrix_a,
+  MatrixT            & matrix_b,
+  const StencilSpecT & stencil_spec,
+  const CycleSpecT   & cycle_spec,
+  int                  iterations,
+  const variant      & var);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  auto params = parse_args(argc, argv);
+  print_params(params);
+
+  if (dash::myid() == 0) {
+    cout << setw(8)  << "dims"
+         << setw(10) << "variant"
+         << setw(10) << "extent"
+         << setw(8)  << "iter"
+         << setw(14) << "time/it [ms]"
+         << setw(12) << "MLUPS"
+         << endl;
+  }
+
+  {
+    typedef dash::Pattern<2>       pattern_t;
+    typedef dash::Matrix<double, 2, dash::default_index_t, pattern_t>
+                                    matrix_t;
+    typedef dash::StencilSpec<2, 4> stencil_spec_t;
+    typedef dash::Stencil<2>        stencil_t;
+
+    dash::TeamSpec<2> teamspec;
+    teamspec.balance_extents();
+    pattern_t         pattern(
+                        dash::SizeSpec<2>(params.size_2d, params.size_2d),
+                        dash::DistributionSpec<2>(dash::BLOCKED,
+                                                  dash::BLOCKED),
+                        teamspec);
+    matrix_t matrix_a(pattern);
+    matrix_t matrix_b(pattern);
+    stencil_spec_t stencil_spec({
+      stencil_t(-1, 0), stencil_t(1, 0), stencil_t(0, -1), stencil_t(0, 1)
+    });
+    dash::CycleSpec<2> cycle_spec(dash::Cycle::CYCLIC, dash::Cycle::CYCLIC);
+
+    for (const auto & var : variants) {
+      auto time_us = run_jacobi(matrix_a, matrix_b, stencil_spec, cycle_spec,
+                                params.iterations, var);
+      print_measurement("2", var.name, params.size_2d, params.iterations,
+                        time_us);
+    }
+  }
+
+  {
+    typedef dash::Pattern<3>       pattern_t;
+    typedef dash::Matrix<double, 3, dash::default_index_t, pattern_t>
+                                    matrix_t;
+    typedef dash::StencilSpec<3, 6> stencil_spec_t;
+    typedef dash::Stencil<3>        stencil_t;
+
+    dash::TeamSpec<3> teamspec;
+    teamspec.balance_extents();
+    pattern_t         pattern(
+                        dash::SizeSpec<3>(params.size_3d, params.size_3d,
+                                          params.size_3d),
+                        dash::DistributionSpec<3>(dash::BLOCKED,
+                                                  dash::BLOCKED,
+                                                  dash::BLOCKED),
+                        teamspec);
+    matrix_t matrix_a(pattern);
+    matrix_t matrix_b(pattern);
+    stencil_spec_t stencil_spec({
+      stencil_t(-1, 0, 0), stencil_t(1, 0, 0),
+      stencil_t( 0,-1, 0), stencil_t(0, 1, 0),
+      stencil_t( 0, 0,-1), stencil_t(0, 0, 1)
+    });
+    dash::CycleSpec<3> cycle_spec(dash::Cycle::CYCLIC, dash::Cycle::CYCLIC,
+                                  dash::Cycle::CYCLIC);
+
+    for (const auto & var : variants) {
+      auto time_us = run_jacobi(matrix_a, matrix_b, stencil_spec, cycle_spec,
+                                params.iterations, var);
+      print_measurement("3", var.name, params.size_3d, params.iterations,
+                        time_us);
+    }
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+template <typename MatrixT, typename StencilSpecT, typename CycleSpecT>
+double run_jacobi(
+  MatrixT            & matrix_a,
+  MatrixT            & matrix_b,
+  const StencilSpecT & stencil_spec,
+  const CycleSpecT   & cycle_spec,
+  int                  iterations,
+  const variant      & var)
+{
+  typedef dash::HaloMatrixWrapper<MatrixT, StencilSpecT> halo_wrapper_t;
+  typedef dash::StencilOperator<halo_wrapper_t>          stencil_op_t;
+  typedef JacobiKernel<StencilSpecT::num_stencil_points()> kernel_t;
+  typedef JacobiSweepKernel<StencilSpecT::num_stencil_points()>
+                                                          sweep_kernel_t;
+
+  dash::fill(matrix_a.begin(), matrix_a.end(), 1.0);
+  dash::fill(matrix_b.begin(), matrix_b.end(), 1.0);
+  if (dash::myid() == 0) {
+    matrix_a.lbegin()[0] = 1000.0;
+  }
+
+  halo_wrapper_t halo_a(matrix_a, stencil_spec, cycle_spec, var.mode,
+                        var.depth);
+  halo_wrapper_t halo_b(matrix_b, stencil_spec, cycle_spec, var.mode,
+                        var.depth);
+  stencil_op_t   op_a(halo_a);
+  stencil_op_t   op_b(halo_b);
+
+  auto * src_halo = &halo_a;
+  auto * src_op   = &op_a;
+  auto * dst      = &matrix_b;
+
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (int i = 0; i < iterations; i += var.depth) {
+    kernel_t kernel{ dst->lbegin() };
+    if (var.depth > 1) {
+      src_op->apply_sweeps(src_halo == &halo_a ? halo_b : halo_a,
+                           sweep_kernel_t());
+    } else if (var.overlap) {
+      src_op->apply(kernel);
+    } else {
+      src_halo->update();
+      auto it_iend = src_halo->iend();
+      for (auto it = src_halo->ibegin(); it != it_iend; ++it) {
+        kernel(it);
+      }
+      auto it_bend = src_halo->bend();
+      for (auto it = src_halo->bbegin(); it != it_bend; ++it) {
+        kernel(it);
+      }
+    }
+    // Halos of the destination matrix are read in the next iteration:
+    dash::barrier();
+
+    if (var.depth % 2 == 0) {
+      // Result of the last sweep is stored in the source matrix
+      continue;
+    }
+    bool a_is_src = (src_halo == &halo_a);
+    src_halo = a_is_src ? &halo_b : &halo_a;
+    src_op   = a_is_src ? &op_b   : &op_a;
+    dst      = a_is_src ? &matrix_a : &matrix_b;
+  }
+  // Deep halo variants compute a multiple of their depth of iterations
+  int num_iter = ((iterations + var.depth - 1) / var.depth) * var.depth;
+  return Timer::ElapsedSince(ts_start) / num_iter;
+}
+
+void print_measurement(
+  const std::string & name,
+  const std::string & variant,
+  long                size,
+  int                 iterations,
+  double              time_us)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  long nelem = size * size;
+  if (name == "3") {
+    nelem *= size;
+  }
+  cout << setw(8)  << name
+       << setw(10) << variant
+       << setw(10) << size
+       << setw(8)  << iterations
+       << setw(14) << std::fixed << std::setprecision(3) << time_us * 1.0e-3
+       << setw(12) << std::fixed << std::setprecision(2) << nelem / time_us
+       << endl;
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_2d    = 4096;
+  params.size_3d    = 256;
+  params.iterations = 50;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (i + 1 >= argc) {
+      break;
+    }
+    if (flag == "-s2") {
+      params.size_2d    = atol(argv[i+1]);
+    } else if (flag == "-s3") {
+      params.size_3d    = atol(argv[i+1]);
+    } else if (flag == "-i") {
+      params.iterations = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(const benchmark_params & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  cout << "---------------------------------" << endl
+       << "-- DASH benchmark bench.06.jacobi-halo" << endl
+       << "-- parameters:" << endl
+       << "--   -s2: extent of 2-D matrix = " << params.size_2d    << endl
+       << "--   -s3: extent of 3-D matrix = " << params.size_3d    << endl
+       << "--   -i:  iterations           = " << params.iterations << endl
+       << "---------------------------------" << endl;
+}
@@ -81,6 +81,12 @@ measurement copy_block_to_local(
   const benchmark_params & params,
   local_copy_method        l_copy_method = DASH_COPY);
 
+measurement copy_range_to_local(
+  size_t                   size,
+  size_t                   num_repeats,
+  index_t                  target_unit_id,
+  const benchmark_params & params);
+
 void print_measurement_header();
 void print_measurement_record(
   const std::string      & scenario,
@@ -242,6 +248,43 @@ int main(int argc, char** argv)
   }
 #endif
 
+#if 1
+  // Copy the full range spanning all units to a single unit:
+  //   serial:  at most one get request in flight, equivalent to copying
+  //            the range one unit after another
+  //   pipe:    get requests to all units in flight at once
+  //   pipe.oc: like pipe, node-local segments are copied by the
+  //            destination unit (owner computes)
+  const std::vector<std::string> all_variants { "serial", "pipe", "pipe.oc" };
+  for (const auto & variant : all_variants) {
+    dash::util::Config::set("DASH_COPY_MAX_REQUESTS",
+                            (variant == "serial") ? 1 : 0);
+    dash::util::Config::set("DASH_COPY_OWNER_COMPUTES",
+                            (variant == "pipe.oc") ? 1 : 0);
+    num_repeats = params.num_repeats;
+    for (size_t i = 0; i < num_iterations && num_repeats > 0;
+         ++i, num_repeats /= params.rep_base)
+    {
+      auto block_size = std::pow(params.size_base,i) * size_inc;
+      auto size       = block_size * dash::size();
+
+      num_repeats     = std::max<size_t>(num_repeats, params.min_repeats);
+
+      u_src    = 0;
+      u_dst    = u_loc;
+      u_init   = u_loc;
+      ts_start = Timer::Now();
+      res      = copy_range_to_local(size, num_repeats, u_dst, params);
+      time_s   = Timer::ElapsedSince(ts_start) * 1.0e-06;
+      print_measurement_record("all.units", "copy." + variant, bench_cfg,
+                               u_src, u_dst, u_init, size, num_repeats,
+                               time_s, res, params);
+    }
+  }
+  dash::util::Config::set("DASH_COPY_MAX_REQUESTS",   0);
+  dash::util::Config::set("DASH_COPY_OWNER_COMPUTES", 0);
+#endif
+
   if( dash::myid()==0 ) {
     cout << "Benchmark finished" << endl;
   }
@@ -471,6 +514,102 @@ measurement copy_block_to_local(
   return result;
 }
 
+measurement copy_range_to_local(
+  size_t                   size,
+  size_t                   num_repeats,
+  index_t                  target_unit_id,
+  const benchmark_params & params)
+{
+  measurement result;
+  auto myid        = dash::myid();
+  // Copy the global range excluding the block of the target unit, so all
+  // copied elements are remote:
+  Array_t global_array(size, dash::BLOCKED);
+  auto &  pattern      = global_array.pattern();
+  auto    tgt_block    = pattern.block(target_unit_id);
+  size_t  range_size   = size - tgt_block.size();
+  size_t  range_bytes  = range_size * sizeof(ElementType);
+  index_t range_offset = (tgt_block.offset(0) + tgt_block.size()) % size;
+
+  dash::Shared<double> time_copy_us;
+  dash::Shared<double> time_copy_min_us;
+  dash::Shared<double> time_copy_max_us;
+  dash::Shared<double> time_copy_med_us;
+  dash::Shared<double> time_copy_sdv_us;
+
+  for (size_t l = 0; l < global_array.lsize(); ++l) {
+    global_array.local[l] = (l+1) * (myid+1);
+  }
+
+  ElementType * local_array = nullptr;
+  if (myid == target_unit_id) {
+    local_array = new ElementType[range_size];
+  }
+
+  std::vector<double> history_copy_us;
+  double total_copy_us = 0;
+  dash::barrier();
+  for (size_t r = 0; r < num_repeats; ++r) {
+    if (myid == target_unit_id) {
+      auto ts_copy_start = Timer::Now();
+      // Copy range succeeding the target unit's block and the range
+      // preceding it:
+      auto out_first  = local_array;
+      auto num_tail   = std::min<size_t>(size - range_offset, range_size);
+      out_first = dash::copy(global_array.begin() + range_offset,
+                             global_array.begin() + range_offset + num_tail,
+                             out_first);
+      if (num_tail < range_size) {
+        out_first = dash::copy(global_array.begin(),
+                               global_array.begin() + (range_size - num_tail),
+                               out_first);
+      }
+      auto copy_us   = Timer::ElapsedSince(ts_copy_start);
+      total_copy_us += copy_us;
+      history_copy_us.push_back(copy_us);
+
+      if (params.verify) {
+        for (size_t l = 0; l < range_size; ++l) {
+          ElementType expected = global_array[(range_offset + l) % size];
+          if (local_array[l] != expected) {
+            DASH_THROW(dash::exception::RuntimeError,
+                       "copy_range_to_local: Validation failed " <<
+                       "for copied element at offset " << l << ": " <<
+                       "expected: " << expected << " " <<
+                       "actual: "   << local_array[l]);
+          }
+        }
+      }
+    }
+  }
+
+  if (myid == target_unit_id) {
+    delete[] local_array;
+
+    time_copy_us.set(total_copy_us);
+    std::sort(history_copy_us.begin(), history_copy_us.end());
+    time_copy_med_us.set(history_copy_us[history_copy_us.size() / 2]);
+    time_copy_sdv_us.set(dash::math::sigma(history_copy_us.begin(),
+                                           history_copy_us.end()));
+    time_copy_min_us.set(history_copy_us.front());
+    time_copy_max_us.set(history_copy_us.back());
+  }
+  dash::barrier();
+
+  double mb_copied   = static_cast<double>(range_bytes * num_repeats)
+                       / 1024.0 / 1024.0;
+
+  result.time_init_s      = 0;
+  result.time_copy_s      = time_copy_us.get() * 1.0e-6;
+  result.time_copy_min_us = time_copy_min_us.get();
+  result.time_copy_max_us = time_copy_max_us.get();
+  result.time_copy_med_us = time_copy_med_us.get();
+  result.time_copy_sdv_us = time_copy_sdv_us.get();
+  result.mb_per_s         = mb_copied / result.time_copy_s;
+
+  return result;
+}
+
 void print_measurement_header()
 {
   if (dash::myid() == 0) {
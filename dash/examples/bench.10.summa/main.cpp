@@ -107,6 +107,7 @@ typedef struct benchmark_params_t {
   float       cpu_gflops_peak;
   bool        mkl_dyn;
   bool        verify;
+  int         pipeline_depth;
 } benchmark_params;
 
 template<typename MatrixType>
@@ -135,6 +136,11 @@ std::pair<double, double> test_blas(
   unsigned                 repeat,
   const benchmark_params & params);
 
+std::pair<double, double> test_builtin(
+  extent_t                 sb,
+  unsigned                 repeat,
+  const benchmark_params & params);
+
 std::pair<double, double> test_plasma(
   extent_t                 sb,
   unsigned                 repeat,
@@ -253,7 +259,13 @@ int main(int argc, char* argv[])
         repeats = 1;
       }
 
-      perform_test(variant, extent_run, exp, repeats, params);
+      if (variant == "cmp") {
+        // Compare the built-in local GEMM kernel with BLAS:
+        perform_test("blas",    extent_run, exp, repeats, params);
+        perform_test("builtin", extent_run, exp, repeats, params);
+      } else {
+        perform_test(variant, extent_run, exp, repeats, params);
+      }
 
       repeats /= rep_base;
       if      (exp < 1) extent_base += 1;
@@ -404,10 +416,21 @@ void perform_test(
   std::pair<double, double> t_mmult;
   if (variant == "mkl" || variant == "blas") {
     t_mmult = test_blas(n, num_repeats, params);
+  } else if (variant == "builtin") {
+    t_mmult = test_builtin(n, num_repeats, params);
   } else if (variant == "plasma") {
     t_mmult = test_plasma(n, num_repeats, params, tilesize);
   } else if (variant == "pblas") {
     t_mmult = test_pblas(n, num_repeats, params);
+  } else if (variant == "dash-bcast") {
+    // Same tiling, blocks mapped round-robin to the process grid:
+    typedef dash::TilePattern<2, dash::ROW_MAJOR, index_t> tile_pattern_t;
+    tile_pattern_t tile_pattern(size_spec,
+                                dash::DistributionSpec<2>(
+                                  dash::TILE(tilesize),
+                                  dash::TILE(tilesize)),
+                                team_spec);
+    t_mmult = test_dash(n, num_repeats, params, tile_pattern);
   } else {
     t_mmult = test_dash(n, num_repeats, params, pattern);
   }
@@ -526,7 +549,11 @@ std::pair<double, double> test_dash(
       dash::util::TraceStore::on();
     }
 
-    dash::summa(matrix_a, matrix_b, matrix_c);
+    if (params.variant == "dash-bcast") {
+      dash::summa_bcast(matrix_a, matrix_b, matrix_c, params.pipeline_depth);
+    } else {
+      dash::summa(matrix_a, matrix_b, matrix_c);
+    }
 
     if (i == 0) {
       dash::util::TraceStore::off();
@@ -681,6 +708,50 @@ std::pair<double, double> test_blas(
 #endif
 }
 
+/**
+ * Returns pair of durations (init_secs, multiply_secs) of the built-in
+ * local GEMM kernel used by dash::summa if neither MKL nor BLAS is
+ * available.
+ *
+ */
+std::pair<double, double> test_builtin(
+  extent_t sb,
+  unsigned repeat,
+  const benchmark_params & params)
+{
+  std::pair<double, double> time;
+
+  if (dash::size() != 1) {
+    time.first  = 0;
+    time.second = 0;
+    return time;
+  }
+
+  std::vector<value_t> l_matrix_a(sb * sb);
+  std::vector<value_t> l_matrix_b(sb * sb);
+  std::vector<value_t> l_matrix_c(sb * sb);
+
+  auto ts_init_start = Timer::Now();
+  init_values(l_matrix_a.data(), l_matrix_b.data(), l_matrix_c.data(), sb,
+              params);
+  time.first = Timer::ElapsedSince(ts_init_start);
+
+  auto ts_multiply_start = Timer::Now();
+  for (auto i = 0; i < repeat; ++i) {
+    dash::internal::gemm_local(
+        l_matrix_a.data(),
+        l_matrix_b.data(),
+        l_matrix_c.data(),
+        sb,
+        sb,
+        sb,
+        dash::ROW_MAJOR);
+  }
+  time.second = Timer::ElapsedSince(ts_multiply_start);
+
+  return time;
+}
+
 /**
  * Returns pair of durations (init_secs, multiply_secs).
  *
@@ -1060,6 +1131,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.cpu_gflops_peak    = 41.4;
   params.mkl_dyn            = false;
   params.verify             = false;
+  params.pipeline_depth     = 2;
 
   extent_t size_base        = 0;
   extent_t num_units_inc    = 0;
@@ -1095,6 +1167,8 @@ benchmark_params parse_args(int argc, char * argv[])
       params.mkl_dyn  = atoi(argv[i+1]) == 1;
     } else if (flag == "-verify") {
       params.verify   = atoi(argv[i+1]) == 1;
+    } else if (flag == "-pd") {
+      params.pipeline_depth = atoi(argv[i+1]);
     } else if (flag == "-tb") {
       params.tilesize_base = static_cast<extent_t>(atoi(argv[i+1]));
     } else if (flag == "-tf") {
@@ -1173,6 +1247,7 @@ void print_params(
   conf.print_param("-nt",     "threads/proc",       params.threads);
   conf.print_param("-mkldyn", "MKL dynamic",        params.mkl_dyn);
   conf.print_param("-verify", "run test iteration", params.verify);
+  conf.print_param("-pd",     "pipeline depth",     params.pipeline_depth);
   conf.print_param("-ninc",   "units inc.",         params.units_inc);
   conf.print_param("-nmax",   "max. units",         params.units_max);
   conf.print_section_end();
@@ -0,0 +1,257 @@
+/**
+ * Measures the throughput and latency of key lookups in
+ * dash::UnorderedMap for increasing map sizes.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef long map_key_t;
+typedef long map_mapped_t;
+
+/**
+ * Maps keys to units in round-robin order.
+ */
+template<typename Key>
+struct HashCyclic
+{
+  typedef Key                argument_type;
+  typedef dash::team_unit_t  result_type;
+
+  HashCyclic()
+  : _nunits(0)
+  { }
+
+  HashCyclic(dash::Team & team)
+  : _nunits(team.size())
+  { }
+
+  result_type operator()(const argument_type & key) const
+  {
+    return result_type(key % _nunits);
+  }
+
+private:
+  long _nunits;
+};
+
+typedef dash::UnorderedMap<
+          map_key_t, map_mapped_t, HashCyclic<map_key_t> >
+  map_t;
+
+typedef struct benchmark_params_t {
+  long   size_base;
+  long   size_max;
+  long   num_lookups;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  long        local_size;
+  double      time_insert_s;
+  double      time_find_s;
+  double      lookups_s;
+  double      latency_us;
+  long        hits;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate(
+              long size,
+              std::string testcase,
+              benchmark_params params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  measurement res;
+
+  dash::util::BenchmarkParams bench_params("bench.13.unordered-map");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  std::array<std::string, 3> testcases {{
+                            "map.local.find",
+                            "map.find.local",
+                            "map.find.global" }};
+
+  for (long size = params.size_base; size <= params.size_max; size *= 4) {
+    for (auto testcase : testcases) {
+      res = evaluate(size, testcase, params);
+      print_measurement_record(bench_cfg, res, params);
+    }
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(long size, std::string testcase, benchmark_params params)
+{
+  measurement mes;
+  auto myid   = dash::myid();
+  auto nunits = dash::size();
+
+  map_t map(size * nunits);
+
+  // Insert keys mapped to the local unit:
+  auto ts_insert_start = Timer::Now();
+  for (long i = 0; i < size; ++i) {
+    map_key_t key = i * nunits + myid;
+    map.local.insert(std::make_pair(key, key));
+  }
+  map.barrier();
+  mes.time_insert_s = Timer::ElapsedSince(ts_insert_start) / (1000 * 1000);
+
+  std::mt19937 rng(myid);
+  std::uniform_int_distribution<long> key_dist(0, size * nunits - 1);
+  std::uniform_int_distribution<long> lkey_dist(0, size - 1);
+
+  long hits = 0;
+  dash::barrier();
+  auto ts_find_start = Timer::Now();
+  if (testcase == "map.local.find") {
+    for (long l = 0; l < params.num_lookups; ++l) {
+      map_key_t key = lkey_dist(rng) * nunits + myid;
+      if (map.local.find(key) != map.local.end()) { ++hits; }
+    }
+  } else if (testcase == "map.find.local") {
+    for (long l = 0; l < params.num_lookups; ++l) {
+      map_key_t key = lkey_dist(rng) * nunits + myid;
+      if (map.find(key) != map.end()) { ++hits; }
+    }
+  } else if (testcase == "map.find.global") {
+    for (long l = 0; l < params.num_lookups; ++l) {
+      map_key_t key = key_dist(rng);
+      if (map.find(key) != map.end()) { ++hits; }
+    }
+  }
+  mes.time_find_s = Timer::ElapsedSince(ts_find_start) / (1000 * 1000);
+  dash::barrier();
+
+  mes.testcase    = testcase;
+  mes.local_size  = size;
+  mes.hits        = hits;
+  mes.lookups_s   = params.num_lookups / mes.time_find_s;
+  mes.latency_us  = (mes.time_find_s * 1000 * 1000) / params.num_lookups;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(10) << "l.size"     << ","
+         << std::setw(18) << "impl"       << ","
+         << std::setw(10) << "lookups"    << ","
+         << std::setw(10) << "hits"       << ","
+         << std::setw(10) << "insert.s"   << ","
+         << std::setw(10) << "find.s"     << ","
+         << std::setw(13) << "lookups/s"  << ","
+         << std::setw(12) << "latency.us"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5)  << dash::size()       << ","
+         << std::setw(9)  << mpi_impl           << ","
+         << std::setw(10) << mes.local_size     << ","
+         << std::setw(18) << mes.testcase       << ","
+         << std::setw(10) << params.num_lookups << ","
+         << std::setw(10) << mes.hits           << ","
+         << std::fixed << setprecision(4) << setw(10) << mes.time_insert_s << ","
+         << std::fixed << setprecision(4) << setw(10) << mes.time_find_s   << ","
+         << std::fixed << setprecision(2) << setw(12)
+         << (mes.lookups_s / 1000) << "k,"
+         << std::fixed << setprecision(3) << setw(12) << mes.latency_us
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_base   = 1000;
+  params.size_max    = 256000;
+  params.num_lookups = 10000;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-sb") {
+      params.size_base   = atol(argv[i+1]);
+    }
+    if (flag == "-smax") {
+      params.size_max    = atol(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.num_lookups = atol(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-sb",   "initial local map size", params.size_base);
+  bench_cfg.print_param("-smax", "maximum local map size", params.size_max);
+  bench_cfg.print_param("-n",    "lookups per unit",       params.num_lookups);
+  bench_cfg.print_section_end();
+}
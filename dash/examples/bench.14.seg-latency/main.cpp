@@ -0,0 +1,156 @@
+/**
+ * Measures the latency of single-element blocking reads and writes to a
+ * neighbor unit in dependence of the number of live global memory
+ * segments.
+ *
+ * Every access resolves the segment of the global pointer in the segment
+ * table of the team, accesses are distributed round-robin over all live
+ * segments.
+ *
+ * Note that MPI implementations may limit the number of memory regions
+ * attached to a dynamic window, e.g. with OpenMPI use
+ * \c --mca osc_rdma_max_attach 16384 to run with 10k segments.
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+typedef dash::Array<int>                                   array_t;
+
+typedef struct benchmark_params_t {
+  int  max_segments;
+  int  repeat;
+} benchmark_params;
+
+typedef struct measurement_t {
+  double get_us;
+  double put_us;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(const benchmark_params & params);
+
+measurement measure(
+  std::vector<std::unique_ptr<array_t>> & arrays,
+  int                                     repeat);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  auto params = parse_args(argc, argv);
+  print_params(params);
+
+  if (dash::myid() == 0) {
+    cout << setw(10) << "segments"
+         << setw(10) << "repeat"
+         << setw(14) << "get [us]"
+         << setw(14) << "put [us]"
+         << endl;
+  }
+
+  std::vector<std::unique_ptr<array_t>> arrays;
+  for (int nseg = 1; nseg <= params.max_segments; nseg *= 10) {
+    while (static_cast<int>(arrays.size()) < nseg) {
+      arrays.emplace_back(new array_t(dash::size()));
+    }
+    auto res = measure(arrays, params.repeat);
+    if (dash::myid() == 0) {
+      cout << setw(10) << nseg
+           << setw(10) << params.repeat
+           << setw(14) << std::fixed << std::setprecision(3) << res.get_us
+           << setw(14) << std::fixed << std::setprecision(3) << res.put_us
+           << endl;
+    }
+  }
+
+  arrays.clear();
+  dash::finalize();
+  return 0;
+}
+
+measurement measure(
+  std::vector<std::unique_ptr<array_t>> & arrays,
+  int                                     repeat)
+{
+  measurement res;
+  auto nseg   = arrays.size();
+  auto target = (dash::myid() + 1) % dash::size();
+
+  // Global pointers are resolved once so only the cost of the accesses
+  // is measured:
+  std::vector<dart_gptr_t> gptrs;
+  gptrs.reserve(nseg);
+  for (auto & arr : arrays) {
+    gptrs.push_back((*arr)[target].dart_gptr());
+  }
+
+  int value = dash::myid();
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for (int r = 0; r < repeat; ++r) {
+    DASH_ASSERT_RETURNS(
+      dart_put_blocking(gptrs[r % nseg], &value, 1,
+                        DART_TYPE_INT, DART_TYPE_INT),
+      DART_OK);
+  }
+  res.put_us = Timer::ElapsedSince(ts_start) / repeat;
+  dash::barrier();
+
+  ts_start = Timer::Now();
+  for (int r = 0; r < repeat; ++r) {
+    DASH_ASSERT_RETURNS(
+      dart_get_blocking(&value, gptrs[r % nseg], 1,
+                        DART_TYPE_INT, DART_TYPE_INT),
+      DART_OK);
+  }
+  res.get_us = Timer::ElapsedSince(ts_start) / repeat;
+  dash::barrier();
+
+  return res;
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.max_segments = 10000;
+  params.repeat       = 100000;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (i + 1 >= argc) {
+      break;
+    }
+    if (flag == "-s") {
+      params.max_segments = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.repeat       = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(const benchmark_params & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  cout << "---------------------------------" << endl
+       << "-- DASH benchmark bench.14.seg-latency" << endl
+       << "-- parameters:" << endl
+       << "--   -s: max. number of segments = " << params.max_segments << endl
+       << "--   -r: accesses per measurement = " << params.repeat       << endl
+       << "---------------------------------" << endl;
+}
@@ -0,0 +1,178 @@
+/**
+ * Prefix sums on a distributed array.
+ *
+ * Compares variants of a scan of all elements:
+ *
+ * - local:     \c std::partial_sum of the local range of every unit, the
+ *              memory bandwidth bound of a scan without communication.
+ * - inclusive: \c dash::inclusive_scan to a second array.
+ * - exclusive: \c dash::exclusive_scan to a second array.
+ * - in-place:  \c dash::inclusive_scan with identical input and output.
+ *
+ * Bandwidth is reported for reading the input and writing the output once
+ * per element.
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include <string>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef long                        ElementType;
+typedef dash::Array<ElementType>    ArrayType;
+
+typedef struct benchmark_params_t {
+  long   size_min;
+  int    num_iterations;
+  int    num_repeats;
+} benchmark_params;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(const benchmark_params & params);
+
+void print_measurement(
+  const std::string & variant,
+  long                size,
+  int                 repeats,
+  double              time_us);
+
+double run_scan(
+  ArrayType         & arr_in,
+  ArrayType         & arr_out,
+  const std::string & variant,
+  int                 repeats);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  auto params = parse_args(argc, argv);
+  print_params(params);
+
+  if (dash::myid() == 0) {
+    cout << setw(11) << "variant"
+         << setw(12) << "size"
+         << setw(8)  << "repeats"
+         << setw(14) << "time [ms]"
+         << setw(12) << "GB/s"
+         << endl;
+  }
+
+  const char * variants[] = { "local", "inclusive", "exclusive", "in-place" };
+
+  long size = params.size_min;
+  for (int i = 0; i < params.num_iterations; ++i, size *= 2) {
+    ArrayType arr_in(size, dash::BLOCKED);
+    ArrayType arr_out(size, dash::BLOCKED);
+    for (const auto & variant : variants) {
+      auto time_us = run_scan(arr_in, arr_out, variant, params.num_repeats);
+      print_measurement(variant, size, params.num_repeats, time_us);
+    }
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+double run_scan(
+  ArrayType         & arr_in,
+  ArrayType         & arr_out,
+  const std::string & variant,
+  int                 repeats)
+{
+  double min_time_us = 0;
+  for (int r = 0; r < repeats; ++r) {
+    for (auto li = 0; li < arr_in.lsize(); ++li) {
+      arr_in.local[li] = 1 + (arr_in.pattern().global(li) % 7);
+    }
+    dash::barrier();
+
+    auto ts_start = Timer::Now();
+    if (variant == "local") {
+      std::partial_sum(arr_in.lbegin(), arr_in.lend(), arr_out.lbegin());
+    } else if (variant == "inclusive") {
+      dash::inclusive_scan(arr_in.begin(), arr_in.end(), arr_out.begin());
+    } else if (variant == "exclusive") {
+      dash::exclusive_scan(arr_in.begin(), arr_in.end(), arr_out.begin(),
+                           ElementType(0));
+    } else {
+      dash::inclusive_scan(arr_in.begin(), arr_in.end(), arr_in.begin());
+    }
+    dash::barrier();
+    double time_us = Timer::ElapsedSince(ts_start);
+
+    if (r == 0 || time_us < min_time_us) {
+      min_time_us = time_us;
+    }
+  }
+  return min_time_us;
+}
+
+void print_measurement(
+  const std::string & variant,
+  long                size,
+  int                 repeats,
+  double              time_us)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  double gbytes = 2.0 * size * sizeof(ElementType) * 1.0e-9;
+  cout << setw(11) << variant
+       << setw(12) << size
+       << setw(8)  << repeats
+       << setw(14) << std::fixed << std::setprecision(3) << time_us * 1.0e-3
+       << setw(12) << std::fixed << std::setprecision(2)
+                   << gbytes / (time_us * 1.0e-6)
+       << endl;
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_min       = 1 << 20;
+  params.num_iterations = 6;
+  params.num_repeats    = 10;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (i + 1 >= argc) {
+      break;
+    }
+    if (flag == "-smin") {
+      params.size_min       = atol(argv[i+1]);
+    } else if (flag == "-i") {
+      params.num_iterations = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.num_repeats    = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(const benchmark_params & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  cout << "---------------------------------" << endl
+       << "-- DASH benchmark bench.15.scan" << endl
+       << "-- parameters:" << endl
+       << "--   -smin: initial number of elements = " << params.size_min
+       << endl
+       << "--   -i:    iterations, doubling size  = " << params.num_iterations
+       << endl
+       << "--   -r:    repeats, minimum reported  = " << params.num_repeats
+       << endl
+       << "---------------------------------" << endl;
+}
@@ -0,0 +1,181 @@
+/**
+ * Contention on a dash::Mutex.
+ *
+ * All units repeatedly acquire the same mutex and increment a shared
+ * counter in the critical section. The measurement is repeated for
+ * different bounds of node-local handoffs of the lock:
+ *
+ * - 0:   the lock is passed to the next node after every critical section,
+ *        corresponding to a flat queue lock.
+ * - >0:  the lock is handed to waiting units on the same node up to the
+ *        given number of times before it is passed to the next node.
+ *
+ * Throughput is reported in acquisitions per second over all units.
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef struct benchmark_params_t {
+  int    num_acquire;
+  int    cs_length;
+  int    num_repeats;
+} benchmark_params;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(const benchmark_params & params);
+
+void print_measurement(
+  int                 handoff_max,
+  int                 num_acquire,
+  int                 repeats,
+  double              time_us);
+
+double run_mutex(
+  const benchmark_params & params,
+  int                      handoff_max);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  auto params = parse_args(argc, argv);
+  print_params(params);
+
+  if (dash::myid() == 0) {
+    cout << setw(10) << "handoffs"
+         << setw(10) << "units"
+         << setw(10) << "acquire"
+         << setw(8)  << "repeats"
+         << setw(14) << "time [ms]"
+         << setw(14) << "acquire/s"
+         << endl;
+  }
+
+  std::vector<int> handoff_bounds = { 0, 1, 8, 64 };
+  for (auto handoff_max : handoff_bounds) {
+    auto time_us = run_mutex(params, handoff_max);
+    print_measurement(handoff_max, params.num_acquire,
+                      params.num_repeats, time_us);
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+double run_mutex(
+  const benchmark_params & params,
+  int                      handoff_max)
+{
+  // The bound is read by DART when the mutex is created:
+  setenv("DART_LOCK_HANDOFF_MAX", std::to_string(handoff_max).c_str(), 1);
+  dash::Mutex mx;
+  unsetenv("DART_LOCK_HANDOFF_MAX");
+
+  dash::Shared<long> counter;
+  if (dash::myid() == 0) {
+    counter.set(0);
+  }
+
+  double min_time_us = 0;
+  for (int r = 0; r < params.num_repeats; ++r) {
+    dash::barrier();
+
+    auto ts_start = Timer::Now();
+    for (int i = 0; i < params.num_acquire; ++i) {
+      std::lock_guard<dash::Mutex> lg(mx);
+      for (int c = 0; c < params.cs_length; ++c) {
+        counter.set(counter.get() + 1);
+      }
+    }
+    dash::barrier();
+    double time_us = Timer::ElapsedSince(ts_start);
+
+    if (r == 0 || time_us < min_time_us) {
+      min_time_us = time_us;
+    }
+  }
+
+  long expected = static_cast<long>(params.num_repeats) *
+                  params.num_acquire * params.cs_length * dash::size();
+  if (dash::myid() == 0 && counter.get() != expected) {
+    std::cerr << "Invalid counter value: " << counter.get()
+              << ", expected " << expected << endl;
+  }
+  dash::barrier();
+  return min_time_us;
+}
+
+void print_measurement(
+  int                 handoff_max,
+  int                 num_acquire,
+  int                 repeats,
+  double              time_us)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  double num_total = static_cast<double>(num_acquire) * dash::size();
+  cout << setw(10) << handoff_max
+       << setw(10) << dash::size()
+       << setw(10) << num_acquire
+       << setw(8)  << repeats
+       << setw(14) << std::fixed << std::setprecision(3) << time_us * 1.0e-3
+       << setw(14) << std::fixed << std::setprecision(0)
+                   << num_total / (time_us * 1.0e-6)
+       << endl;
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.num_acquire = 1000;
+  params.cs_length   = 1;
+  params.num_repeats = 5;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (i + 1 >= argc) {
+      break;
+    }
+    if (flag == "-n") {
+      params.num_acquire = atoi(argv[i+1]);
+    } else if (flag == "-cs") {
+      params.cs_length   = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.num_repeats = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(const benchmark_params & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  cout << "---------------------------------" << endl
+       << "-- DASH benchmark bench.16.mutex" << endl
+       << "-- parameters:" << endl
+       << "--   -n:  acquisitions per unit       = " << params.num_acquire
+       << endl
+       << "--   -cs: counter updates per lock    = " << params.cs_length
+       << endl
+       << "--   -r:  repeats, minimum reported   = " << params.num_repeats
+       << endl
+       << "---------------------------------" << endl;
+}
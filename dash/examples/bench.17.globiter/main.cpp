@@ -0,0 +1,228 @@
+/**
+ * Per-element cost of sequential traversals with dash::GlobIter.
+ *
+ * Every unit traverses the full global index range of a matrix and
+ * resolves the global reference of every element in three variants:
+ *
+ * - index: subscript with global index, resolving unit and local offset
+ *          from the pattern for every element.
+ * - incr:  dereference after increment, following unit and local offset
+ *          incrementally within runs of contiguous local elements.
+ * - lrun:  reads local elements on native pointers to the runs of
+ *          contiguous elements obtained from \c GlobIter::lrun.
+ *
+ * The measurement is repeated for BlockPattern, TilePattern and
+ * SeqTilePattern.
+ */
+
+#include <libdash.h>
+
+#include <dash/internal/Annotation.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <algorithm>
+#include <numeric>
+#include <cstdlib>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef double                   value_t;
+typedef dash::default_index_t    index_t;
+
+typedef struct benchmark_params_t {
+  index_t extent;
+  index_t tile;
+  int     num_repeats;
+} benchmark_params;
+
+typedef struct measurement_t {
+  double  index_us;
+  double  incr_us;
+  double  lrun_us;
+} measurement;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(const benchmark_params & params);
+
+void print_measurement(
+  const std::string      & pattern,
+  index_t                  nelem,
+  const measurement      & m);
+
+template <class MatrixT>
+measurement run_traversal(
+  MatrixT                & matrix,
+  const benchmark_params & params);
+
+int main(int argc, char * argv[])
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  auto params    = parse_args(argc, argv);
+  auto num_units = dash::size();
+  print_params(params);
+
+  if (dash::myid() == 0) {
+    cout << setw(16) << "pattern"
+         << setw(12) << "elements"
+         << setw(14) << "index [ns]"
+         << setw(14) << "incr [ns]"
+         << setw(14) << "lrun [ns]"
+         << endl;
+  }
+
+  dash::SizeSpec<2> sizespec(params.extent, params.extent);
+  dash::TeamSpec<2> teamspec(num_units, 1);
+  teamspec.balance_extents();
+
+  {
+    dash::Matrix<value_t, 2, index_t, dash::BlockPattern<2>> matrix(
+      sizespec,
+      dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+      dash::Team::All(), teamspec);
+    print_measurement("BlockPattern", matrix.size(),
+                      run_traversal(matrix, params));
+  }
+  {
+    dash::Matrix<value_t, 2, index_t, dash::TilePattern<2>> matrix(
+      sizespec,
+      dash::DistributionSpec<2>(dash::TILE(params.tile),
+                                dash::TILE(params.tile)),
+      dash::Team::All(), teamspec);
+    print_measurement("TilePattern", matrix.size(),
+                      run_traversal(matrix, params));
+  }
+  {
+    dash::Matrix<value_t, 2, index_t, dash::SeqTilePattern<2>> matrix(
+      sizespec,
+      dash::DistributionSpec<2>(dash::TILE(params.tile),
+                                dash::TILE(params.tile)),
+      dash::Team::All(), teamspec);
+    print_measurement("SeqTilePattern", matrix.size(),
+                      run_traversal(matrix, params));
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+template <class MatrixT>
+measurement run_traversal(
+  MatrixT                & matrix,
+  const benchmark_params & params)
+{
+  std::fill(matrix.lbegin(), matrix.lend(), 1.0);
+  matrix.barrier();
+
+  auto    begin = matrix.begin();
+  auto    end   = matrix.end();
+  index_t nelem = matrix.size();
+
+  measurement m { 0, 0, 0 };
+  // Accumulated to prevent elimination of the measured loops:
+  uint64_t sink  = 0;
+  value_t  lsum  = 0;
+
+  for (int r = 0; r < params.num_repeats; ++r) {
+    auto ts_start = Timer::Now();
+    for (index_t i = 0; i < nelem; ++i) {
+      sink += begin[i].dart_gptr().addr_or_offs.offset;
+    }
+    double index_us = Timer::ElapsedSince(ts_start);
+
+    ts_start = Timer::Now();
+    for (auto it = begin; it != end; ++it) {
+      sink += (*it).dart_gptr().addr_or_offs.offset;
+    }
+    double incr_us = Timer::ElapsedSince(ts_start);
+
+    ts_start = Timer::Now();
+    for (auto it = begin; it != end; ) {
+      auto n = std::min(it.lrun(), end - it);
+      if (auto lptr = it.local()) {
+        lsum = std::accumulate(lptr, lptr + n, lsum);
+      }
+      it += n;
+    }
+    double lrun_us = Timer::ElapsedSince(ts_start);
+
+    if (r == 0 || index_us < m.index_us) { m.index_us = index_us; }
+    if (r == 0 || incr_us  < m.incr_us)  { m.incr_us  = incr_us;  }
+    if (r == 0 || lrun_us  < m.lrun_us)  { m.lrun_us  = lrun_us;  }
+  }
+
+  auto lsize = matrix.lend() - matrix.lbegin();
+  if (lsum != static_cast<value_t>(lsize * params.num_repeats)) {
+    std::cerr << "Invalid local sum: " << lsum << ", expected "
+              << lsize * params.num_repeats << endl;
+  }
+  dash::prevent_opt_elimination(sink);
+
+  matrix.barrier();
+  return m;
+}
+
+void print_measurement(
+  const std::string      & pattern,
+  index_t                  nelem,
+  const measurement      & m)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  cout << setw(16) << pattern
+       << setw(12) << nelem
+       << std::fixed << std::setprecision(2)
+       << setw(14) << m.index_us * 1.0e3 / nelem
+       << setw(14) << m.incr_us  * 1.0e3 / nelem
+       << setw(14) << m.lrun_us  * 1.0e3 / nelem
+       << endl;
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.extent      = 1024;
+  params.tile        = 32;
+  params.num_repeats = 5;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (i + 1 >= argc) {
+      break;
+    }
+    if (flag == "-n") {
+      params.extent      = atoi(argv[i+1]);
+    } else if (flag == "-t") {
+      params.tile        = atoi(argv[i+1]);
+    } else if (flag == "-r") {
+      params.num_repeats = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(const benchmark_params & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  cout << "---------------------------------" << endl
+       << "-- DASH benchmark bench.17.globiter" << endl
+       << "-- parameters:" << endl
+       << "--   -n:  matrix extent per dimension = " << params.extent
+       << endl
+       << "--   -t:  tile extent per dimension   = " << params.tile
+       << endl
+       << "--   -r:  repeats, minimum reported   = " << params.num_repeats
+       << endl
+       << "---------------------------------" << endl;
+}
@@ -17,6 +17,8 @@
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/Scan.h>
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
@@ -24,6 +26,7 @@
 #include <dash/algorithm/AnyOf.h>
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
+#include <dash/algorithm/Sort.h>
 
 #include <dash/algorithm/SUMMA.h>
 
@@ -382,6 +382,8 @@ public:
   inline void flush() const {
     // could also call _array->flush();
     _array->m_globmem->flush();
+    // Release operands of completed atomic operations:
+    dash::internal::AsyncOps::get().wait_local();
   }
 
   /**
@@ -391,6 +393,7 @@ public:
   inline void flush(dash::team_unit_t target) const {
     // could also call _array->flush();
     _array->m_globmem->flush(target);
+    dash::internal::AsyncOps::get().wait_local();
   }
 
   /**
@@ -400,6 +403,7 @@ public:
   inline void flush_local() const {
     // could also call _array->flush_local();
     _array->m_globmem->flush_local();
+    dash::internal::AsyncOps::get().wait_local();
   }
 
   /**
@@ -409,6 +413,7 @@ public:
   inline void flush_local(dash::team_unit_t target) const {
     // could also call _array->flush_local();
     _array->m_globmem->flush_local(target);
+    dash::internal::AsyncOps::get().wait_local();
   }
 
 };
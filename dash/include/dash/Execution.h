@@ -0,0 +1,317 @@
+#ifndef DASH__EXECUTION_H__INCLUDED
+#define DASH__EXECUTION_H__INCLUDED
+
+#include <dash/Init.h>
+#include <dash/Future.h>
+#include <dash/LaunchPolicy.h>
+
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/internal/Logging.h>
+
+#include <cstddef>
+#include <future>
+#include <type_traits>
+
+
+namespace dash {
+
+/**
+ * Execution policies of DASH algorithms, corresponding to the execution
+ * policies of the C++17 parallel algorithms.
+ *
+ * Policies specify the execution of the local phase of an algorithm at
+ * every unit. Communication between units is not affected.
+ *
+ * - \c seq:       local elements are processed by the calling thread.
+ * - \c par:       local elements are processed in chunks by the threads
+ *                 available to the unit if OpenMP is enabled.
+ * - \c par_unseq: like \c par, loops over elements in a chunk may also be
+ *                 vectorized. Reductions are executed as with \c par.
+ *
+ * Parallel policies carry the number of threads, the number of elements
+ * per chunk and the assignment of chunks to threads:
+ *
+ * \code
+ *   dash::for_each(dash::execution::par.with_threads(4)
+ *                                      .with_chunk_size(4096),
+ *                  array.begin(), array.end(), func);
+ * \endcode
+ *
+ * Any policy can be combined with a \c dash::launch policy by
+ * \c dash::execution::async, algorithms then return a \c dash::Future.
+ *
+ * \ingroup  DashAlgorithms
+ */
+namespace execution {
+
+/**
+ * Execution policy of algorithms processing local elements in order on
+ * the calling thread.
+ */
+class sequenced_policy
+{
+public:
+  constexpr sequenced_policy() { }
+
+  constexpr int num_threads() const {
+    return 1;
+  }
+
+  constexpr std::ptrdiff_t chunk_size() const {
+    return 0;
+  }
+
+  constexpr dash::internal::parallel_config config() const {
+    return dash::internal::parallel_config(1);
+  }
+};
+
+/**
+ * Execution policy of algorithms processing chunks of local elements
+ * concurrently on several threads.
+ *
+ * \tparam  Unsequenced  Whether loops over the elements in a chunk may be
+ *                       vectorized.
+ */
+template <bool Unsequenced>
+class basic_parallel_policy
+{
+private:
+  typedef basic_parallel_policy<Unsequenced> self_t;
+
+public:
+  constexpr basic_parallel_policy()
+  : _config(0, 0, dash::internal::parallel_schedule::static_chunks,
+            Unsequenced)
+  { }
+
+  /**
+   * Policy with the given number of threads, 0 for all threads available
+   * to the unit.
+   */
+  constexpr self_t with_threads(int nthreads) const {
+    return self_t(dash::internal::parallel_config(
+                    nthreads, _config.chunk_size, _config.schedule,
+                    Unsequenced));
+  }
+
+  /**
+   * Policy with the given number of elements per chunk, 0 for one chunk
+   * per thread.
+   */
+  constexpr self_t with_chunk_size(std::ptrdiff_t nchunk) const {
+    return self_t(dash::internal::parallel_config(
+                    _config.num_threads, nchunk, _config.schedule,
+                    Unsequenced));
+  }
+
+  /**
+   * Policy with the given assignment of chunks to threads.
+   */
+  constexpr self_t with_schedule(
+    dash::internal::parallel_schedule schedule) const {
+    return self_t(dash::internal::parallel_config(
+                    _config.num_threads, _config.chunk_size, schedule,
+                    Unsequenced));
+  }
+
+  constexpr int num_threads() const {
+    return _config.num_threads;
+  }
+
+  constexpr std::ptrdiff_t chunk_size() const {
+    return _config.chunk_size;
+  }
+
+  constexpr dash::internal::parallel_config config() const {
+    return _config;
+  }
+
+private:
+  constexpr explicit basic_parallel_policy(
+    const dash::internal::parallel_config & config)
+  : _config(config)
+  { }
+
+private:
+  dash::internal::parallel_config _config;
+};
+
+typedef basic_parallel_policy<false> parallel_policy;
+typedef basic_parallel_policy<true>  parallel_unsequenced_policy;
+
+/**
+ * Execution policy of algorithms launched as specified by a
+ * \c dash::launch policy, the local phase of the algorithm is executed as
+ * specified by the base policy.
+ *
+ * With \c dash::launch::async, the algorithm is executed by a separate
+ * thread if DASH has been initialized with thread support, and is
+ * executed before returning otherwise.
+ * As the algorithm still is a collective operation, units must not call
+ * other collective operations on the team before waiting for the returned
+ * \c dash::Future.
+ */
+template <class BasePolicy>
+class async_policy
+{
+public:
+  typedef BasePolicy base_policy;
+
+public:
+  constexpr async_policy(
+    const BasePolicy & base,
+    dash::launch       launch_policy)
+  : _base(base),
+    _launch(launch_policy)
+  { }
+
+  constexpr const BasePolicy & base() const {
+    return _base;
+  }
+
+  constexpr dash::launch launch_policy() const {
+    return _launch;
+  }
+
+  constexpr int num_threads() const {
+    return _base.num_threads();
+  }
+
+  constexpr std::ptrdiff_t chunk_size() const {
+    return _base.chunk_size();
+  }
+
+  constexpr dash::internal::parallel_config config() const {
+    return _base.config();
+  }
+
+private:
+  BasePolicy   _base;
+  dash::launch _launch;
+};
+
+constexpr sequenced_policy            seq{};
+constexpr parallel_policy             par{};
+constexpr parallel_unsequenced_policy par_unseq{};
+
+/**
+ * Combines an execution policy with a launch policy.
+ */
+template <class BasePolicy>
+constexpr async_policy<BasePolicy> async(
+  const BasePolicy & base,
+  dash::launch       launch_policy = dash::launch::async)
+{
+  return async_policy<BasePolicy>(base, launch_policy);
+}
+
+/**
+ * Type trait to identify execution policies in overloads of DASH
+ * algorithms.
+ */
+template <class T>
+struct is_execution_policy : std::false_type { };
+
+template <>
+struct is_execution_policy<sequenced_policy> : std::true_type { };
+
+template <bool Unsequenced>
+struct is_execution_policy<basic_parallel_policy<Unsequenced>>
+: std::true_type { };
+
+template <class BasePolicy>
+struct is_execution_policy<async_policy<BasePolicy>> : std::true_type { };
+
+} // namespace execution
+
+namespace internal {
+
+/**
+ * Result type of an algorithm with result type \c ResultT executed with
+ * execution policy \c PolicyT.
+ */
+template <class PolicyT, class ResultT>
+struct execution_result {
+  typedef ResultT type;
+};
+
+template <class BasePolicy, class ResultT>
+struct execution_result<dash::execution::async_policy<BasePolicy>, ResultT> {
+  typedef dash::Future<ResultT> type;
+};
+
+/**
+ * Enables overloads of algorithms for execution policies.
+ */
+template <class PolicyT, class ResultT>
+using enable_if_execution_policy_t =
+  typename std::enable_if<
+    dash::execution::is_execution_policy<
+      typename std::decay<PolicyT>::type >::value,
+    typename execution_result<
+      typename std::decay<PolicyT>::type, ResultT >::type
+  >::type;
+
+/**
+ * Executes \c task(config) with the configuration of a synchronous
+ * execution policy.
+ */
+template <class ResultT, class PolicyT, class TaskT>
+ResultT execute(const PolicyT & policy, TaskT && task)
+{
+  return task(policy.config());
+}
+
+template <class ResultT>
+struct execute_ready {
+  template <class TaskT>
+  static dash::Future<ResultT> run(
+    TaskT                         & task,
+    const parallel_config         & config)
+  {
+    ResultT result = task(config);
+    return dash::Future<ResultT>([=]() { return result; });
+  }
+};
+
+template <>
+struct execute_ready<void> {
+  template <class TaskT>
+  static dash::Future<void> run(
+    TaskT                         & task,
+    const parallel_config         & config)
+  {
+    task(config);
+    dash::Future<void> fut([]() { });
+    fut.wait();
+    return fut;
+  }
+};
+
+/**
+ * Executes \c task(config) as specified by an asynchronous execution
+ * policy.
+ */
+template <class ResultT, class BasePolicy, class TaskT>
+dash::Future<ResultT> execute(
+  const dash::execution::async_policy<BasePolicy> & policy,
+  TaskT                                          && task)
+{
+  parallel_config config = policy.config();
+  if (policy.launch_policy() == dash::launch::async &&
+      dash::is_multithreaded()) {
+    DASH_LOG_TRACE("dash::internal::execute", "launching thread");
+    std::shared_future<ResultT> fut =
+      std::async(std::launch::async, task, config).share();
+    return dash::Future<ResultT>([fut]() { return fut.get(); });
+  }
+  DASH_LOG_TRACE("dash::internal::execute", "executing synchronously");
+  return execute_ready<ResultT>::run(task, config);
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__EXECUTION_H__INCLUDED
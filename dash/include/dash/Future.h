@@ -95,6 +95,62 @@ public:
 
 }; // class Future
 
+/**
+ * Specialization of \c dash::Future for operations without result.
+ */
+template<>
+class Future<void>
+{
+private:
+  typedef Future<void>               self_t;
+  typedef std::function<void (void)> func_t;
+
+private:
+  func_t    _func;
+  bool      _ready     = false;
+  bool      _has_func  = false;
+
+public:
+  Future()
+  : _ready(false),
+    _has_func(false)
+  { }
+
+  Future(const func_t & func)
+  : _func(func),
+    _ready(false),
+    _has_func(true)
+  { }
+
+  void wait()
+  {
+    DASH_LOG_TRACE_VAR("Future<void>.wait()", _ready);
+    if (_ready) {
+      return;
+    }
+    if (!_has_func) {
+      DASH_LOG_ERROR("Future<void>.wait()", "No function");
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Future not initialized with function");
+    }
+    _func();
+    _ready = true;
+    DASH_LOG_TRACE_VAR("Future<void>.wait >", _ready);
+  }
+
+  bool test() const
+  {
+    return _ready;
+  }
+
+  void get()
+  {
+    wait();
+  }
+
+}; // class Future<void>
+
 template<typename ResultT>
 std::ostream & operator<<(
   std::ostream & os,
@@ -4,6 +4,8 @@
 #include <dash/GlobPtr.h>
 #include <dash/Allocator.h>
 #include <dash/memory/GlobStaticMem.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/atomic/internal/AsyncOps.h>
 
 #include <iostream>
 
@@ -143,8 +145,17 @@ public:
 
   /**
    * Unlike native reference types, global reference types are moveable.
+   * Waits for local completion of a pending operation of the moved
+   * reference as it might still access the moved operand buffer.
    */
-  GlobAsyncRef(self_t && other)      = default;
+  GlobAsyncRef(self_t && other)
+  : _gptr(other._gptr)
+  {
+    if (other._handle != DART_HANDLE_NULL) {
+      dart_wait_local(&other._handle);
+    }
+    _value = other._value;
+  }
 
   /**
    * Whether the referenced element is located in local memory.
@@ -257,6 +268,74 @@ public:
     return *this;
   }
 
+  /**
+   * Asynchronously apply the reduce operation \c binary_op with operand
+   * \c value to the referenced element, e.g. \c dash::plus.
+   * Updates are atomic with respect to other accumulate operations on the
+   * element.
+   * This operation is guaranteed to be complete after a call to \ref flush,
+   * but the value referenced by \c value can be re-used immediately.
+   */
+  template<typename BinaryOp>
+  void op(
+    BinaryOp           binary_op,
+    const_value_type & value)
+  {
+    DASH_LOG_TRACE_VAR("GlobAsyncRef.op()", value);
+    DASH_LOG_TRACE_VAR("GlobAsyncRef.op()", _gptr);
+    // Operand buffer is kept until local completion of the operation, the
+    // reference can be released before:
+    dash::internal::AsyncOps::get().start(
+      static_cast<nonconst_value_type>(value),
+      [&](const nonconst_value_type * operand, dart_handle_t * handle) {
+        return dart_accumulate_handle(
+                 _gptr,
+                 operand,
+                 1,
+                 dash::dart_punned_datatype<nonconst_value_type>::value,
+                 binary_op.dart_operation(),
+                 handle);
+      });
+  }
+
+  /**
+   * Asynchronously add \c value to the referenced element.
+   *
+   * \see op
+   */
+  void add(const_value_type & value)
+  {
+    op(dash::plus<nonconst_value_type>(), value);
+  }
+
+  /**
+   * Asynchronously apply the reduce operation \c binary_op with operand
+   * \c value to the referenced element and write its value before the
+   * operation into \c result.
+   * This operation is guaranteed to be complete after a call to \ref flush,
+   * at which point the value in \c result can be used.
+   */
+  template<typename BinaryOp>
+  void fetch_op(
+    BinaryOp              binary_op,
+    const_value_type    & value,
+    nonconst_value_type * result)
+  {
+    DASH_LOG_TRACE_VAR("GlobAsyncRef.fetch_op()", value);
+    DASH_LOG_TRACE_VAR("GlobAsyncRef.fetch_op()", _gptr);
+    dash::internal::AsyncOps::get().start(
+      static_cast<nonconst_value_type>(value),
+      [&](const nonconst_value_type * operand, dart_handle_t * handle) {
+        return dart_fetch_and_op_handle(
+                 _gptr,
+                 operand,
+                 result,
+                 dash::dart_punned_datatype<nonconst_value_type>::value,
+                 binary_op.dart_operation(),
+                 handle);
+      });
+  }
+
   /**
    * Returns the underlying DART global pointer.
    */
@@ -278,6 +357,7 @@ public:
    */
   void flush()
   {
+    dash::internal::AsyncOps::get().wait_local();
     DASH_ASSERT_RETURNS(
       dart_flush(_gptr),
       DART_OK
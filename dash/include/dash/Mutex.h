@@ -14,6 +14,10 @@ namespace dash {
  * Behaves similar to \c std::mutex and is used to ensure mutual exclusion
  * within a dash team.
  * 
+ * The mutex is node-aware: units on the same node are served before
+ * the mutex is passed to units on other nodes, up to a bound that keeps
+ * other nodes from starving (see \c dart_lock_t).
+ *
  * \note This works properly with \c std::lock_guard
  * \note Mutex cannot be placed in DASH containers
  * 
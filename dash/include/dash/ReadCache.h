@@ -0,0 +1,294 @@
+#ifndef DASH__READ_CACHE_H__INCLUDED
+#define DASH__READ_CACHE_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Onesided.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace dash {
+
+/**
+ * Software cache for reading elements of a container in global memory.
+ *
+ * Reading a remote element through \c dash::GlobRef transfers a single
+ * element on every access. Access patterns that read the same remote
+ * elements repeatedly, like traversals of graphs stored in a
+ * \c dash::Array, can instead read through a \c ReadCache that fetches
+ * lines of \c line_size consecutive elements in the local memory of a
+ * remote unit on a miss and serves subsequent reads of elements in the
+ * line from local memory.
+ *
+ * Consistency is relaxed: writes to cached elements are not visible in
+ * the cache until it is invalidated. Cached lines are invalidated on
+ * \c flush and when the container's team passed a barrier since the
+ * lines were fetched, so values read in a synchronization epoch are
+ * those at the start of the epoch.
+ * Local elements are read from local memory and are not cached.
+ *
+ * Accessing a cache instance is not thread-safe.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<node_t> nodes(n);
+ *   dash::ReadCache<dash::Array<node_t>> cache(nodes);
+ *   // ...
+ *   node_t node = cache[node_id];
+ *   // ...
+ *   dash::barrier(); // invalidates cached elements
+ * \endcode
+ *
+ * \tparam  ContainerType  Container of elements with trivially copyable
+ *                         type, iterated by \c dash::GlobIter.
+ */
+template <class ContainerType>
+class ReadCache
+{
+private:
+  typedef ReadCache<ContainerType> self_t;
+
+public:
+  typedef typename std::remove_const<
+            typename ContainerType::value_type>::type      value_type;
+  typedef typename ContainerType::index_type               index_type;
+  typedef typename ContainerType::size_type                 size_type;
+  typedef typename ContainerType::pattern_type           pattern_type;
+  typedef typename ContainerType::iterator                   iterator;
+
+  /// Default size of a cache line in bytes.
+  static const size_type DefaultLineBytes = 4096;
+  /// Default number of cache lines.
+  static const size_type DefaultNumLines  = 256;
+
+private:
+  typedef typename pattern_type::local_index_t           local_pos_t;
+
+  static const uint64_t InvalidKey = static_cast<uint64_t>(-1);
+
+public:
+  /**
+   * Creates a cache for reading elements of the given container.
+   * Not a collective operation.
+   */
+  ReadCache(
+    /// The container to read from.
+    ContainerType & container,
+    /// Number of consecutive elements in a unit's local memory that are
+    /// fetched on a miss, by default \c DefaultLineBytes bytes.
+    size_type       line_size = 0,
+    /// Maximum number of lines held in the cache, the least recently
+    /// fetched line is evicted if exceeded.
+    size_type       num_lines = DefaultNumLines)
+  : _container(&container),
+    _begin(container.begin()),
+    _team(&container.team()),
+    _myid(container.team().myid()),
+    _lbegin(container.lbegin()),
+    _line_size(line_size > 0
+               ? line_size
+               : std::max<size_type>(1, DefaultLineBytes / sizeof(value_type))),
+    _num_lines(std::max<size_type>(1, num_lines)),
+    _data(_line_size * _num_lines),
+    _slot_keys(_num_lines, InvalidKey),
+    _epoch(_team->num_barriers())
+  {
+    static_assert(std::is_trivially_copyable<value_type>::value,
+                  "dash::ReadCache requires trivially copyable elements");
+  }
+
+  ReadCache(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)   = delete;
+
+  /**
+   * Value of the element at the given global index.
+   */
+  value_type get(index_type g_index)
+  {
+    local_pos_t l_pos = _begin.pattern().local(g_index);
+    return get(l_pos.unit, l_pos.index);
+  }
+
+  /**
+   * Value of the element at the given global index.
+   */
+  inline value_type operator[](index_type g_index)
+  {
+    return get(g_index);
+  }
+
+  /**
+   * Value of the element referenced by the given global iterator on the
+   * cached container.
+   */
+  template <class GlobIterT>
+  typename std::enable_if<
+    !std::is_integral<GlobIterT>::value,
+    value_type
+  >::type
+  get(const GlobIterT & it)
+  {
+    local_pos_t l_pos = it.lpos();
+    return get(l_pos.unit, l_pos.index);
+  }
+
+  /**
+   * Value of the element at the given local offset of the given unit.
+   */
+  value_type get(team_unit_t unit, index_type l_index)
+  {
+    if (unit == _myid) {
+      return _lbegin[l_index];
+    }
+    if (_team->num_barriers() != _epoch) {
+      flush();
+    }
+    index_type line   = l_index / _line_size;
+    index_type phase  = l_index - (line * _line_size);
+    uint64_t   key    = line_key(unit, line);
+    auto       cached = _slots.find(key);
+    if (cached != _slots.end()) {
+      ++_num_hits;
+      return _data[cached->second * _line_size + phase];
+    }
+    ++_num_misses;
+    size_type slot = fetch(unit, line, key);
+    return _data[slot * _line_size + phase];
+  }
+
+  /**
+   * Discards all cached elements.
+   */
+  void flush()
+  {
+    DASH_LOG_TRACE("ReadCache.flush()", "lines:", _slots.size());
+    _slots.clear();
+    std::fill(_slot_keys.begin(), _slot_keys.end(), InvalidKey);
+    _next_slot = 0;
+    _epoch     = _team->num_barriers();
+  }
+
+  /**
+   * Synchronizes units in the container's team and discards all cached
+   * elements.
+   * Collective operation.
+   */
+  void barrier()
+  {
+    _container->barrier();
+    flush();
+  }
+
+  /**
+   * Number of reads of remote elements served from the cache.
+   */
+  constexpr size_type hits() const noexcept
+  {
+    return _num_hits;
+  }
+
+  /**
+   * Number of reads of remote elements that fetched a cache line.
+   */
+  constexpr size_type misses() const noexcept
+  {
+    return _num_misses;
+  }
+
+  /**
+   * Resets the hit and miss counters.
+   */
+  void reset_stats() noexcept
+  {
+    _num_hits   = 0;
+    _num_misses = 0;
+  }
+
+  /**
+   * Number of elements in the cached container.
+   */
+  inline size_type size() const noexcept
+  {
+    return _container->size();
+  }
+
+  /**
+   * Number of consecutive elements fetched on a miss.
+   */
+  constexpr size_type line_size() const noexcept
+  {
+    return _line_size;
+  }
+
+  /**
+   * Maximum number of lines held in the cache.
+   */
+  constexpr size_type num_lines() const noexcept
+  {
+    return _num_lines;
+  }
+
+private:
+  static inline uint64_t line_key(team_unit_t unit, index_type line)
+  {
+    return (static_cast<uint64_t>(unit.id) << 40) |
+           static_cast<uint64_t>(line);
+  }
+
+  /**
+   * Fetches the line at the given index in local memory of the given
+   * unit into the next slot, evicting the line previously stored in the
+   * slot.
+   */
+  size_type fetch(team_unit_t unit, index_type line, uint64_t key)
+  {
+    size_type slot = _next_slot;
+    _next_slot     = (_next_slot + 1) % _num_lines;
+    if (_slot_keys[slot] != InvalidKey) {
+      _slots.erase(_slot_keys[slot]);
+    }
+    index_type l_offset = line * _line_size;
+    index_type l_size   = _begin.pattern().local_size(unit);
+    size_type  nelem    = std::min<size_type>(_line_size, l_size - l_offset);
+    DASH_LOG_TRACE("ReadCache.fetch()",
+                   "unit:", unit, "offset:", l_offset, "nelem:", nelem);
+    dart_gptr_t gptr = _begin.globmem().at(unit, l_offset).dart_gptr();
+    dash::internal::get_blocking(gptr, &_data[slot * _line_size], nelem);
+    _slot_keys[slot] = key;
+    _slots[key]      = slot;
+    return slot;
+  }
+
+private:
+  ContainerType                         * _container;
+  iterator                                _begin;
+  const dash::Team                      * _team;
+  team_unit_t                             _myid;
+  const value_type                      * _lbegin;
+  size_type                               _line_size;
+  size_type                               _num_lines;
+  /// Element values of cached lines, by slot.
+  std::vector<value_type>                 _data;
+  /// Key of the line stored in a slot.
+  std::vector<uint64_t>                   _slot_keys;
+  /// Slot of a cached line, by key.
+  std::unordered_map<uint64_t, size_type> _slots;
+  /// Slot receiving the next fetched line.
+  size_type                               _next_slot  = 0;
+  /// Number of barriers in the team when the cache was last flushed.
+  size_t                                  _epoch;
+  size_type                               _num_hits   = 0;
+  size_type                               _num_misses = 0;
+
+}; // class ReadCache
+
+} // namespace dash
+
+#endif // DASH__READ_CACHE_H__INCLUDED
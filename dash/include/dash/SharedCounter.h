@@ -1,89 +1,209 @@
 #ifndef DASH__SHARED_COUNTER_H_
 #define DASH__SHARED_COUNTER_H_
 
+#include <dash/Types.h>
+#include <dash/Team.h>
 #include <dash/Array.h>
+#include <dash/Exception.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <cstdint>
+#include <type_traits>
 
 namespace dash {
 
 /**
- * A simple shared counter that allows atomic increment-
- * and decrement operations.
+ * Consistency modes of \c dash::SharedCounter.
+ */
+enum class counter_mode : uint16_t {
+/// Increments are applied to the shared counter immediately
+atomic   = 0x1,
+/// Increments are buffered locally until the next \c flush
+relaxed  = 0x2
+};
+
+/**
+ * A shared counter that allows atomic increment- and decrement
+ * operations.
+ *
+ * The counter value is stored in a single location at the first unit of
+ * the team and updated with \c dart_accumulate, so reading the counter
+ * value requires a single one-sided operation independent of the number
+ * of units.
  *
- * TODO: Should probably be based on MPI_ACCUMULATE.
+ * In mode \c counter_mode::relaxed, increments are accumulated in a local
+ * buffer and only applied to the shared counter on \c flush, reducing
+ * the number of atomic operations on the shared location to one per
+ * flush.
  */
 template<typename ValueType = int>
 class SharedCounter {
+  static_assert(std::is_arithmetic<ValueType>::value,
+                "dash::SharedCounter: value type must be arithmetic to be "
+                "accumulated with DART_OP_SUM");
+
 private:
   typedef SharedCounter<ValueType> self_t;
 
+public:
+  typedef ValueType value_type;
+
 public:
   /**
-   * Constructor.
+   * Constructor, allocates a shared counter for all units.
+   * Collective operation.
    */
-  SharedCounter()
-  : _num_units(dash::Team::All().size()),
-    _myid(dash::Team::All().myid()),
-    _local_counts(_num_units)
-  {
-    _local_counts.local[0] = 0;
-    _local_counts.barrier();
-  }
+  SharedCounter(
+    counter_mode   mode = counter_mode::atomic)
+  : SharedCounter(dash::Team::All(), mode)
+  { }
 
-  SharedCounter(dash::Team& team)
-  : _num_units(team.size()),
-    _myid(team.myid()),
-    _local_counts(_num_units, team)
+  /**
+   * Constructor, allocates a shared counter for units in the specified
+   * team.
+   * Collective operation.
+   */
+  SharedCounter(
+    dash::Team   & team,
+    counter_mode   mode = counter_mode::atomic)
+  : _team(&team),
+    _mode(mode),
+    _count(1, team)
   {
-    _local_counts.local[0] = 0;
-    _local_counts.barrier();
+    if (_team->myid() == 0) {
+      _count.local[0] = 0;
+    }
+    _count.barrier();
   }
 
+  SharedCounter(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
   /**
    * Increment the shared counter value, atomic operation.
+   * In relaxed mode, the increment is buffered until the next \c flush.
    */
   void inc(
     /// Increment value
     ValueType increment)
   {
-    _local_counts[_myid] += increment;
+    if (_mode == counter_mode::relaxed) {
+      _lbuffer += increment;
+    } else {
+      accumulate(increment);
+    }
   }
 
   /**
    * Decrement the shared counter value, atomic operation.
+   * In relaxed mode, the decrement is buffered until the next \c flush.
    */
   void dec(
     /// Decrement value
-    ValueType increment)
+    ValueType decrement)
   {
-    _local_counts[_myid] -= increment;
+    inc(ValueType(0) - decrement);
+  }
+
+  /**
+   * Applies increments buffered at the calling unit to the shared counter
+   * in a single atomic operation.
+   * Not collective, has no effect in atomic mode.
+   */
+  void flush()
+  {
+    if (_lbuffer != ValueType(0)) {
+      accumulate(_lbuffer);
+      _lbuffer = ValueType(0);
+    }
+  }
+
+  /**
+   * Applies buffered increments of all units and synchronizes them.
+   * Collective operation.
+   */
+  void barrier()
+  {
+    flush();
+    _team->barrier();
   }
 
   /**
    * Read the current value of the shared counter.
-   * Accumulates increment/decrement values of every unit.
-   * Reading a shared is not atomic, use Team::barrier() to synchronize.
+   * Increments buffered at units in relaxed mode are not included before
+   * they have been flushed.
+   * Reading the counter is atomic, use \c barrier() to synchronize with
+   * increments of other units.
    *
-   * \complexity  O(u) for \c u units in the associated team
+   * \complexity  O(1)
    */
   ValueType get() const
   {
-    ValueType acc = 0;
-    for (team_unit_t i{0}; i < _num_units; ++i) {
-      // use local access on own counter value:
-      acc += (i == _myid
-                ? _local_counts.local[0]
-                : _local_counts[i]);
-    }
-    return acc;
+    ValueType nothing = 0;
+    ValueType result;
+    dart_gptr_t gptr = _count.begin().dart_gptr();
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(
+        gptr,
+        &nothing,
+        &result,
+        dash::dart_punned_datatype<ValueType>::value,
+        DART_OP_NO_OP),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_flush_local(gptr),
+      DART_OK);
+    DASH_LOG_TRACE_VAR("SharedCounter.get >", result);
+    return result;
+  }
+
+  /**
+   * Increments buffered at the calling unit that have not been flushed
+   * yet.
+   */
+  inline ValueType buffered() const noexcept
+  {
+    return _lbuffer;
+  }
+
+  /**
+   * The consistency mode of the counter.
+   */
+  inline counter_mode mode() const noexcept
+  {
+    return _mode;
+  }
+
+private:
+  void accumulate(ValueType increment)
+  {
+    DASH_LOG_TRACE_VAR("SharedCounter.accumulate()", increment);
+    dart_gptr_t gptr = _count.begin().dart_gptr();
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(
+        gptr,
+        &increment,
+        1,
+        dash::dart_punned_datatype<ValueType>::value,
+        DART_OP_SUM),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_flush(gptr),
+      DART_OK);
   }
 
 private:
-  /// The number of units interacting with the counter
-  size_t                 _num_units;
-  /// The DART id of the unit that created this local counter intance
-  team_unit_t            _myid;
-  /// Buffer containing counter increments/decrements of every unit
-  dash::Array<ValueType> _local_counts;
+  /// Team of units interacting with the counter
+  dash::Team             * _team;
+  /// Consistency mode of the counter
+  counter_mode             _mode;
+  /// Single shared counter value, located at the first unit in the team
+  dash::Array<ValueType>   _count;
+  /// Increments at the calling unit not applied to the shared counter yet
+  ValueType                _lbuffer = 0;
 };
 
 } // namespace dash
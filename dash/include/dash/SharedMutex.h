@@ -0,0 +1,105 @@
+#ifndef DASH__SHARED_MUTEX_H__INCLUDED
+#define DASH__SHARED_MUTEX_H__INCLUDED
+
+#include <dash/Team.h>
+
+#include <dash/dart/if/dart_synchronization.h>
+
+
+namespace dash {
+
+/**
+ * Behaves similar to \c std::shared_mutex and is used to ensure mutual
+ * exclusion of writers within a dash team while readers in any units of
+ * the team may hold the mutex concurrently.
+ *
+ * Writers take priority over readers: units calling \c lock_shared()
+ * while a writer holds or waits for the mutex are blocked until the
+ * writer released it.
+ *
+ * \note This works properly with \c std::lock_guard, \c std::unique_lock
+ *       and \c std::shared_lock
+ * \note SharedMutex cannot be placed in DASH containers
+ *
+ * \code
+ * dash::SharedMutex mx; // mutex for dash::Team::All();
+ * dash::UnorderedMap<int, int> map;
+ * {
+ *    std::shared_lock<dash::SharedMutex> sl(mx);
+ *    auto it = map.find(key);
+ *    // ...
+ * }
+ * {
+ *    std::lock_guard<dash::SharedMutex> lg(mx);
+ *    map.insert(std::make_pair(key, value));
+ * }
+ * \endcode
+ *
+ * \see dash::Mutex
+ */
+class SharedMutex {
+private:
+  using self_t = SharedMutex;
+
+public:
+  /**
+   * DASH SharedMutex is only valid for a dash team. If no team is passed,
+   * team all is used.
+   *
+   * This function is not thread-safe
+   * @param team team for mutual exclusive accesses
+   */
+  explicit SharedMutex(Team & team = dash::Team::All());
+
+  SharedMutex(const SharedMutex & other)   = delete;
+  SharedMutex(SharedMutex && other)        = default;
+
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Collective destructor to destruct a DART reader-writer lock.
+   *
+   * This function is not thread-safe
+   */
+  ~SharedMutex();
+
+  /**
+   * Block until the lock was acquired for exclusive access.
+   */
+  void lock();
+
+  /**
+   * Try to acquire the lock for exclusive access and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock();
+
+  /**
+   * Release the lock acquired through \c lock() or \c try_lock().
+   */
+  void unlock();
+
+  /**
+   * Block until the lock was acquired for shared access.
+   */
+  void lock_shared();
+
+  /**
+   * Try to acquire the lock for shared access and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock_shared();
+
+  /**
+   * Release the lock acquired through \c lock_shared() or
+   * \c try_lock_shared().
+   */
+  void unlock_shared();
+
+private:
+  dart_rwlock_t   _mutex;
+}; // class SharedMutex
+
+} // namespace dash
+
+#endif // DASH__SHARED_MUTEX_H__INCLUDED
@@ -145,6 +145,7 @@ public:
       _num_siblings = t._num_siblings;
       _myid         = t._myid;
       _size         = t._size;
+      _num_barriers = t._num_barriers;
     }
   }
 
@@ -166,6 +167,7 @@ public:
       _num_siblings = t._num_siblings;
       _myid         = t._myid;
       _size         = t._size;
+      _num_barriers = t._num_barriers;
     }
     return *this;
   }
@@ -464,9 +466,19 @@ public:
       DASH_ASSERT_RETURNS(
         dart_barrier(_dartid),
         DART_OK);
+      ++_num_barriers;
     }
   }
 
+  /**
+   * The number of barriers the calling unit has passed in this team,
+   * allows to detect the end of synchronization epochs.
+   */
+  inline size_t num_barriers() const
+  {
+    return _num_barriers;
+  }
+
   inline team_unit_t myid() const
   {
     if (_myid == -1 && dash::is_initialized() && _dartid != DART_TEAM_NULL) {
@@ -595,6 +607,7 @@ private:
   mutable team_unit_t     _myid         = UNDEFINED_TEAM_UNIT_ID;
   mutable bool            _has_group    = false;
   mutable dart_group_t    _group        = DART_GROUP_NULL;
+  mutable size_t          _num_barriers = 0;
 
   /// Deallocation list for freeing memory acquired via
   /// team-aligned allocation
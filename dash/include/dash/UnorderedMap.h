@@ -128,6 +128,10 @@ namespace dash {
 /**
  * A dynamic map container with support for workload balancing.
  *
+ * The hash function \c Hash maps keys to their owner unit. Elements in
+ * a unit's local memory are resolved by a hash index using
+ * \c std::hash<Key>, which must be specialized for the key type.
+ *
  * \concept{DashUnorderedMapConcept}
  */
 template<
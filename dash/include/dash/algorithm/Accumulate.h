@@ -1,19 +1,313 @@
 #ifndef DASH__ALGORITHM__ACCUMULATE_H__
 #define DASH__ALGORITHM__ACCUMULATE_H__
 
-#include <dash/Array.h>
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Execution.h>
+#include <dash/Allocator.h>
+#include <dash/Exception.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <limits>
+#include <numeric>
+#include <type_traits>
 
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Type trait providing the identity element of a reduce operation,
+ * used as contribution of units with an empty local range in reductions
+ * on native DART types.
+ * Reductions with operations that do not specify an identity element are
+ * performed by a user-defined DART operation on partial results.
+ */
+template<class BinaryOperation, typename ValueType>
+struct accumulate_identity {
+  static constexpr bool defined = false;
+};
+
+template<typename ValueType>
+struct accumulate_identity<dash::plus<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(0); }
+};
+
+template<typename ValueType>
+struct accumulate_identity<dash::multiply<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() { return ValueType(1); }
+};
+
+template<typename ValueType>
+struct accumulate_identity<dash::min<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() { return std::numeric_limits<ValueType>::max(); }
+};
+
+template<typename ValueType>
+struct accumulate_identity<dash::max<ValueType>, ValueType> {
+  static constexpr bool defined = true;
+  static ValueType value() {
+    return std::numeric_limits<ValueType>::lowest();
+  }
+};
+
+/**
+ * Partial result of an accumulation, \c valid is \c false if no elements
+ * have been accumulated.
+ */
+template<typename ValueType>
+struct accumulate_partial {
+  ValueType val;
+  bool      valid;
+};
+
+/**
+ * Accumulates values in the local range \c [l_first, l_last) without
+ * initial value. Elements are combined in their order in the range.
+ *
+ * The range is partitioned in contiguous chunks that are accumulated by
+ * the threads specified in \c config.
+ *
+ * \returns  \c false if the local range is empty, in which case \c result
+ *           is not modified.
+ */
+template <
+  class ElementType,
+  class ValueType,
+  class BinaryOperation >
+bool accumulate_local(
+  const ElementType     * l_first,
+  const ElementType     * l_last,
+  BinaryOperation         binary_op,
+  ValueType             & result,
+  const parallel_config & config = parallel_config())
+{
+  if (l_first == nullptr || l_first == l_last) {
+    return false;
+  }
+  DASH_LOG_TRACE_VAR("dash::accumulate", l_last - l_first);
+  // Results of chunks are combined in order of chunks, which preserves the
+  // order of elements:
+  return dash::internal::parallel_reduce(
+           l_last - l_first,
+           config,
+           [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+             return std::accumulate(l_first + c_first + 1, l_first + c_last,
+                                    ValueType(l_first[c_first]), binary_op);
+           },
+           [&](const ValueType & lhs, const ValueType & rhs) {
+             return binary_op(lhs, rhs);
+           },
+           result);
+}
+
+/**
+ * Combines partial results of all units in the team to the accumulated
+ * result using the DART reduce operation of \c binary_op on the native
+ * DART type of \c ValueType.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+ValueType accumulate_combine(
+  const accumulate_partial<ValueType> & l_partial,
+  ValueType                             init,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team,
+  bool                                  allreduce,
+  std::true_type                        /* native DART reduction */)
+{
+  ValueType l_result = l_partial.valid
+                       ? l_partial.val
+                       : accumulate_identity<BinaryOperation, ValueType>::value();
+  ValueType g_result = l_result;
+  if (allreduce) {
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &l_result,
+        &g_result,
+        1,
+        dash::dart_datatype<ValueType>::value,
+        binary_op.dart_operation(),
+        team.dart_id()),
+      DART_OK);
+  } else {
+    DASH_ASSERT_RETURNS(
+      dart_reduce(
+        &l_result,
+        &g_result,
+        1,
+        dash::dart_datatype<ValueType>::value,
+        binary_op.dart_operation(),
+        dash::team_unit_t(0),
+        team.dart_id()),
+      DART_OK);
+    if (team.myid() != 0) {
+      return init;
+    }
+  }
+  return binary_op(init, g_result);
+}
+
+/**
+ * Combines partial results with \c binary_op, partial results without
+ * accumulated elements are ignored.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+struct accumulate_partial_op {
+  typedef accumulate_partial<ValueType> partial_t;
+
+  BinaryOperation binary_op;
+
+  partial_t operator()(
+    const partial_t & lhs,
+    const partial_t & rhs) const {
+    if (!lhs.valid) {
+      return rhs;
+    }
+    if (!rhs.valid) {
+      return lhs;
+    }
+    partial_t result;
+    result.val   = binary_op(lhs.val, rhs.val);
+    result.valid = true;
+    return result;
+  }
+};
+
+/**
+ * Reduces partial results of all units in the team with \c binary_op
+ * registered as user-defined DART reduce operation.
+ * The result is only valid at unit 0 unless \c allreduce is set.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+accumulate_partial<ValueType> accumulate_reduce_partials(
+  const accumulate_partial<ValueType> & l_partial,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team,
+  bool                                  allreduce,
+  bool                                  commutative)
+{
+  typedef accumulate_partial<ValueType>                      partial_t;
+  typedef accumulate_partial_op<ValueType, BinaryOperation>  partial_op_t;
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::accumulate requires trivially copyable value type");
+
+  dash::internal::CustomReduceOperation<partial_t, partial_op_t> op(
+    partial_op_t { binary_op }, commutative);
+
+  partial_t g_partial = l_partial;
+  if (allreduce) {
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &l_partial,
+        &g_partial,
+        1,
+        op.dart_type(),
+        op.dart_operation(),
+        team.dart_id()),
+      DART_OK);
+  } else {
+    DASH_ASSERT_RETURNS(
+      dart_reduce(
+        &l_partial,
+        &g_partial,
+        1,
+        op.dart_type(),
+        op.dart_operation(),
+        dash::team_unit_t(0),
+        team.dart_id()),
+      DART_OK);
+  }
+  return g_partial;
+}
+
+/**
+ * Combines partial results of all units in the team to the accumulated
+ * result with \c binary_op registered as user-defined DART reduce
+ * operation. Partial results are combined in order of unit ids.
+ * Used for reduce operations without DART equivalent and value types
+ * without native DART type.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+ValueType accumulate_combine(
+  const accumulate_partial<ValueType> & l_partial,
+  ValueType                             init,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team,
+  bool                                  allreduce,
+  std::false_type                       /* native DART reduction */)
+{
+  auto g_partial = accumulate_reduce_partials(
+                     l_partial, binary_op, team, allreduce, false);
+  if (!allreduce && team.myid() != 0) {
+    return init;
+  }
+  return g_partial.valid ? binary_op(init, g_partial.val) : init;
+}
+
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation >
+ValueType accumulate(
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  ValueType               init,
+  BinaryOperation         binary_op,
+  bool                    allreduce,
+  const parallel_config & config = parallel_config())
+{
+  typedef std::integral_constant<
+            bool,
+            accumulate_identity<BinaryOperation, ValueType>::defined &&
+            dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED >
+    native_reduce;
+
+  auto & team        = in_first.team();
+  auto   index_range = dash::local_range(in_first, in_last);
+
+  accumulate_partial<ValueType> l_partial;
+  l_partial.val   = init;
+  l_partial.valid = accumulate_local(index_range.begin, index_range.end,
+                                     binary_op, l_partial.val, config);
+  DASH_LOG_TRACE("dash::accumulate", "local partial result valid:",
+                 l_partial.valid);
+  return accumulate_combine(l_partial, init, binary_op, team, allreduce,
+                            native_reduce());
+}
+
+} // namespace internal
+
 /**
  * Accumulate values in range \c [first, last) as the sum of all values
  * in the range.
  *
+ * Collective operation, the result is only valid at unit 0. Other units
+ * return \c init.
+ *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
  *
@@ -21,6 +315,7 @@ namespace dash {
  *
  *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
  *
+ * \see      dash::accumulate_all
  * \see      dash::transform
  *
  * \ingroup  DashAlgorithms
@@ -33,34 +328,22 @@ ValueType accumulate(
   GlobInputIt     in_last,
   ValueType       init)
 {
-  typedef typename GlobInputIt::index_type index_t;
-
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
-
-  team.barrier();
-
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result += l_results[i];
-    }
-  }
-  return result;
+  return dash::internal::accumulate(
+           in_first, in_last, init, dash::plus<ValueType>(), false);
 }
 
 /**
  * Accumulate values in range \c [first, last) using the given binary
  * reduce function \c op.
  *
- * Collective operation.
+ * Collective operation, the result is only valid at unit 0. Other units
+ * return \c init.
+ *
+ * Partial results of units are reduced with a single \c dart_reduce if
+ * \c op is a DASH reduce operation and the value type has a native DART
+ * type. Otherwise, \c op is registered as user-defined DART operation that
+ * combines partial results in order of unit ids. In both cases, \c op must
+ * be associative.
  *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
@@ -69,6 +352,7 @@ ValueType accumulate(
  *
  *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
  *
+ * \see      dash::accumulate_all
  * \see      dash::transform
  *
  * \ingroup  DashAlgorithms
@@ -83,27 +367,117 @@ ValueType accumulate(
   ValueType       init,
   BinaryOperation binary_op = dash::plus<ValueType>())
 {
-  typedef typename GlobInputIt::index_type index_t;
+  return dash::internal::accumulate(
+           in_first, in_last, init, binary_op, false);
+}
 
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init, binary_op);
-  auto result      = 0;
+/**
+ * Accumulate values in range \c [first, last) as the sum of all values
+ * in the range.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType >
+ValueType accumulate_all(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init)
+{
+  return dash::internal::accumulate(
+           in_first, in_last, init, dash::plus<ValueType>(), true);
+}
 
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
+/**
+ * Accumulate values in range \c [first, last) using the given binary
+ * reduce function \c op.
+ *
+ * Collective operation, the result is returned at all units.
+ * Partial results of units are reduced with a single \c dart_allreduce if
+ * \c op is a DASH reduce operation and the value type has a native DART
+ * type.
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation >
+ValueType accumulate_all(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  BinaryOperation binary_op)
+{
+  return dash::internal::accumulate(
+           in_first, in_last, init, binary_op, true);
+}
 
-  team.barrier();
+/**
+ * Variant of \c dash::accumulate executing the local phase as specified
+ * by an execution policy, see \c dash::execution.
+ * Unsequenced policies are executed like their parallel counterparts.
+ *
+ * \returns  A \c dash::Future of the result for asynchronous execution
+ *           policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, ValueType>
+accumulate(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType          init)
+{
+  return dash::internal::execute<ValueType>(
+           policy,
+           [=](const dash::internal::parallel_config & config) {
+             return dash::internal::accumulate(
+                      in_first, in_last, init, dash::plus<ValueType>(),
+                      false, config);
+           });
+}
 
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result = binary_op(result, l_results[i]);
-    }
-  }
-  return result;
+/**
+ * Variant of \c dash::accumulate using the given binary reduce function
+ * \c op, executing the local phase as specified by an execution policy.
+ *
+ * \returns  A \c dash::Future of the result for asynchronous execution
+ *           policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, ValueType>
+accumulate(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType          init,
+  BinaryOperation    binary_op)
+{
+  return dash::internal::execute<ValueType>(
+           policy,
+           [=](const dash::internal::parallel_config & config) {
+             return dash::internal::accumulate(
+                      in_first, in_last, init, binary_op, false, config);
+           });
 }
 
 } // namespace dash
@@ -1,17 +1,26 @@
 #ifndef DASH__ALGORITHM__COPY_H__
 #define DASH__ALGORITHM__COPY_H__
 
+#include <dash/Execution.h>
 #include <dash/Future.h>
 #include <dash/Iterator.h>
+#include <dash/Team.h>
+#include <dash/Onesided.h>
+#include <dash/Exception.h>
 
 #include <dash/algorithm/LocalRange.h>
 
+#include <dash/util/Config.h>
+
 #include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_locality.h>
 
 #include <algorithm>
 #include <vector>
 #include <memory>
 #include <future>
+#include <string>
+#include <cstring>
 
 
 // #ifndef DASH__ALGORITHM__COPY__USE_WAIT
@@ -19,6 +28,15 @@
 // #define DASH__ALGORITHM__COPY__USE_WAIT
 // #endif
 
+/**
+ * Default maximum number of get requests of a blocking copy operation in
+ * flight at the same time, can be overridden at runtime by configuration
+ * key \c DASH_COPY_MAX_REQUESTS.
+ */
+#ifndef DASH__ALGORITHM__COPY__MAX_REQUESTS
+#define DASH__ALGORITHM__COPY__MAX_REQUESTS 256
+#endif
+
 namespace dash {
 
 #ifdef DOXYGEN
@@ -104,16 +122,160 @@ namespace internal {
 // =========================================================================
 
 /**
- * Blocking implementation of \c dash::copy (global to local) without
- * optimization for local subrange.
+ * Configuration of blocking copy operations, read from configuration
+ * keys \c DASH_COPY_MAX_REQUESTS and \c DASH_COPY_OWNER_COMPUTES only
+ * if the configuration changed since the last copy operation.
+ */
+struct copy_config
+{
+  size_t version        = 0;
+  bool   valid          = false;
+  size_t max_requests   = DASH__ALGORITHM__COPY__MAX_REQUESTS;
+  bool   owner_computes = false;
+
+  static const copy_config & get()
+  {
+    static thread_local copy_config config;
+    size_t version = dash::util::Config::version();
+    if (!config.valid || config.version != version) {
+      config.max_requests =
+        dash::util::Config::get<size_t>("DASH_COPY_MAX_REQUESTS");
+      if (config.max_requests == 0) {
+        config.max_requests = DASH__ALGORITHM__COPY__MAX_REQUESTS;
+      }
+      config.owner_computes =
+        dash::util::Config::get<bool>("DASH_COPY_OWNER_COMPUTES");
+      config.version = version;
+      config.valid   = true;
+    }
+    return config;
+  }
+};
+
+/**
+ * Get requests issued by a blocking global-to-local copy operation.
+ *
+ * Gets are started as non-blocking requests which are completed together
+ * in \c wait, so a copy spanning multiple units only waits for the latency
+ * of a single round-trip. At most \c DASH_COPY_MAX_REQUESTS requests
+ * (default: \c DASH__ALGORITHM__COPY__MAX_REQUESTS) are in flight at the
+ * same time.
+ *
+ * If \c DASH_COPY_OWNER_COMPUTES is set, gets from units located at the
+ * same node as the calling unit are deferred until all requests to other
+ * nodes have been started. Deferred gets are then served by the calling
+ * unit while the remote requests are in flight, using \c memcpy from the
+ * shared memory window if available.
+ */
+template <typename ValueType>
+class copy_get_requests
+{
+private:
+  struct deferred_get {
+    dart_gptr_t   gptr;
+    ValueType   * dest;
+    size_t        nelem;
+  };
+
+public:
+  explicit copy_get_requests(const dash::Team & team)
+  : _teamid(team.dart_id()),
+    _max_requests(copy_config::get().max_requests),
+    _owner_computes(copy_config::get().owner_computes)
+  {
+    if (_owner_computes) {
+      dart_unit_locality_t * myloc;
+      DASH_ASSERT_RETURNS(
+        dart_unit_locality(_teamid, team.myid(), &myloc),
+        DART_OK);
+      _host = myloc->hwinfo.host;
+    }
+  }
+
+  copy_get_requests(const copy_get_requests & other)            = delete;
+  copy_get_requests & operator=(const copy_get_requests & other) = delete;
+
+  /**
+   * Start a get request of \c nelem elements at \c gptr to \c dest.
+   */
+  void get(dart_gptr_t gptr, ValueType * dest, size_t nelem)
+  {
+    if (_owner_computes &&
+        is_node_local(dash::team_unit_t(gptr.unitid))) {
+      _deferred.push_back(deferred_get { gptr, dest, nelem });
+      return;
+    }
+    dart_handle_t handle;
+    dash::internal::get_handle(gptr, dest, nelem, &handle);
+    if (handle != DART_HANDLE_NULL) {
+      _handles.push_back(handle);
+      if (_handles.size() >= _max_requests) {
+        complete();
+      }
+    }
+  }
+
+  /**
+   * Block until all requests have been completed locally.
+   */
+  void wait()
+  {
+    DASH_LOG_TRACE("dash::copy_get_requests.wait()",
+                   "deferred:", _deferred.size(),
+                   "in flight:", _handles.size());
+    for (const auto & d : _deferred) {
+      dash::internal::get_blocking(d.gptr, d.dest, d.nelem);
+    }
+    _deferred.clear();
+    complete();
+  }
+
+private:
+  void complete()
+  {
+    if (_handles.empty()) {
+      return;
+    }
+    if (dart_waitall_local(_handles.data(), _handles.size()) != DART_OK) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "dash::copy: dart_waitall_local failed");
+    }
+    _handles.clear();
+  }
+
+  bool is_node_local(dash::team_unit_t unit) const
+  {
+    dart_unit_locality_t * uloc;
+    DASH_ASSERT_RETURNS(
+      dart_unit_locality(_teamid, unit, &uloc),
+      DART_OK);
+    return _host == uloc->hwinfo.host;
+  }
+
+private:
+  dart_team_t                 _teamid;
+  size_t                      _max_requests;
+  bool                        _owner_computes;
+  std::string                 _host;
+  std::vector<dart_handle_t>  _handles;
+  std::vector<deferred_get>   _deferred;
+};
+
+/**
+ * Implementation of \c dash::copy (global to local) without optimization
+ * for local subrange.
+ * Starts get requests for all elements in the input range, the copied
+ * elements are only available after \c requests.wait() returned.
  */
 template <
   typename ValueType,
   class GlobInputIt >
 ValueType * copy_impl(
-  GlobInputIt   in_first,
-  GlobInputIt   in_last,
-  ValueType   * out_first)
+  GlobInputIt                    in_first,
+  GlobInputIt                    in_last,
+  ValueType                    * out_first,
+  copy_get_requests<ValueType> & requests)
 {
   DASH_LOG_TRACE("dash::copy_impl()",
                  "in_first:",  in_first.pos(),
@@ -174,7 +336,7 @@ ValueType * copy_impl(
                      "left:",           total_elem_left);
       auto cur_in_first  = g_in_first + num_elem_copied;
       auto cur_out_first = out_first  + num_elem_copied;
-      dash::internal::get_blocking(
+      requests.get(
         cur_in_first.dart_gptr(),
         cur_out_first,
         num_copy_elem);
@@ -224,7 +386,7 @@ ValueType * copy_impl(
                      "left:",           total_elem_left);
       auto dest_ptr = out_first + num_elem_copied;
       auto src_gptr = cur_in_first.dart_gptr();
-      dash::internal::get_blocking(src_gptr, dest_ptr, num_copy_elem);
+      requests.get(src_gptr, dest_ptr, num_copy_elem);
       num_elem_copied += num_copy_elem;
     }
   }
@@ -847,6 +1009,8 @@ ValueType * copy(
                  li_range_in.begin,
                  li_range_in.end,
                  "in_first.is_local:", in_first.is_local());
+  // Pending get requests of remote elements:
+  dash::internal::copy_get_requests<ValueType> requests(team);
   // Check if global input range is partially local:
   if (num_local_elem > 0) {
     // Part of the input range is local, copy local input subrange to local
@@ -881,6 +1045,9 @@ ValueType * copy(
     DASH_LOG_TRACE_VAR("dash::copy", num_prelocal_elem);
     DASH_LOG_TRACE_VAR("dash::copy", num_postlocal_elem);
 
+    // Requests for remote elements preceding and succeeding the local
+    // subrange are started first and completed after the local subrange
+    // has been copied.
     //
     // -----------------------------------------------------------------------
     // Copy remote elements preceding the local subrange:
@@ -893,11 +1060,27 @@ ValueType * copy(
       // ... [ --- copy --- | ... l ... | ........ ]
       //     ^              ^           ^          ^
       //     in_first       l_in_first  l_in_last  in_last
-      out_last = dash::internal::copy_impl(g_in_first,
-                                           g_l_in_first,
-                                           dest_first);
-      // Advance output pointers:
-      dest_first = out_last;
+      dest_first = dash::internal::copy_impl(g_in_first,
+                                             g_l_in_first,
+                                             dest_first,
+                                             requests);
+    }
+    //
+    // -----------------------------------------------------------------------
+    // Copy remote elements succeeding the local subrange:
+    //
+    if (num_postlocal_elem > 0) {
+      DASH_LOG_TRACE("dash::copy",
+                     "copy global range succeeding local subrange",
+                     "in_first:", g_l_in_last.pos(),
+                     "in_last:",  g_in_last.pos());
+      // ... [ ........ | ... l ... | --- copy --- ]
+      //     ^          ^           ^              ^
+      //     in_first   l_in_first  l_in_last      in_last
+      out_last = dash::internal::copy_impl(g_l_in_last,
+                                           g_in_last,
+                                           dest_first + num_local_elem,
+                                           requests);
     }
     //
     // -----------------------------------------------------------------------
@@ -920,48 +1103,37 @@ ValueType * copy(
 
     DASH_LOG_TRACE("dash::copy", "copy local subrange",
                    "num_copy_elem:", l_in_last - l_in_first);
+    ValueType * l_out_last;
     // Use memcpy for data ranges below 64 KB
     if (use_memcpy) {
       std::memcpy(dest_first, // destination
                   l_in_first, // source
                   num_local_elem * sizeof(ValueType));
-      out_last = dest_first + num_local_elem;
+      l_out_last = dest_first + num_local_elem;
     } else {
-      out_last = std::copy(l_in_first,
-                           l_in_last,
-                           dest_first);
+      l_out_last = std::copy(l_in_first,
+                             l_in_last,
+                             dest_first);
     }
     // Assert that all elements in local range have been copied:
-    DASH_ASSERT_EQ(out_last, dest_first + num_local_elem,
+    DASH_ASSERT_EQ(l_out_last, dest_first + num_local_elem,
                    "Expected to copy " << num_local_elem << " local elements "
-                   "but copied " << (out_last - dest_first));
+                   "but copied " << (l_out_last - dest_first));
     DASH_LOG_TRACE("dash::copy", "finished local copy of",
-                   (out_last - dest_first), "elements");
-    // Advance output pointers:
-    dest_first = out_last;
-    //
-    // -----------------------------------------------------------------------
-    // Copy remote elements succeeding the local subrange:
-    //
-    if (num_postlocal_elem > 0) {
-      DASH_LOG_TRACE("dash::copy",
-                     "copy global range succeeding local subrange",
-                     "in_first:", g_l_in_last.pos(),
-                     "in_last:",  g_in_last.pos());
-      // ... [ ........ | ... l ... | --- copy --- ]
-      //     ^          ^           ^              ^
-      //     in_first   l_in_first  l_in_last      in_last
-      out_last = dash::internal::copy_impl(g_l_in_last,
-                                           g_in_last,
-                                           dest_first);
+                   (l_out_last - dest_first), "elements");
+    if (num_postlocal_elem <= 0) {
+      out_last = l_out_last;
     }
   } else {
     DASH_LOG_TRACE("dash::copy", "no local subrange");
     // All elements in input range are remote
     out_last = dash::internal::copy_impl(in_first,
                                          in_last,
-                                         dest_first);
+                                         dest_first,
+                                         requests);
   }
+  // Wait for completion of all remote requests:
+  requests.wait();
   DASH_LOG_TRACE("dash::copy >", "finished,",
                  "out_last:", out_last);
   return out_last;
@@ -1155,6 +1327,95 @@ GlobOutputIt copy(
   return GlobOutputIt();
 }
 
+namespace internal {
+
+template <
+  class PolicyT,
+  class InputIt,
+  class OutputIt >
+OutputIt copy(
+  const PolicyT & policy,
+  InputIt         in_first,
+  InputIt         in_last,
+  OutputIt        out_first)
+{
+  (void)(policy);
+  return dash::copy(in_first, in_last, out_first);
+}
+
+template <
+  class BasePolicy,
+  class InputIt,
+  class OutputIt >
+dash::Future<OutputIt> copy(
+  const dash::execution::async_policy<BasePolicy> & policy,
+  InputIt                                           in_first,
+  InputIt                                           in_last,
+  OutputIt                                          out_first)
+{
+  if (policy.launch_policy() == dash::launch::async) {
+    // Non-blocking one-sided transfers, no thread required:
+    return dash::copy_async(in_first, in_last, out_first);
+  }
+  return dash::internal::execute<OutputIt>(
+           policy,
+           [=](const dash::internal::parallel_config &) {
+             return dash::copy(in_first, in_last, out_first);
+           });
+}
+
+} // namespace internal
+
+/**
+ * Variant of \c dash::copy as global-to-local copy operation, launched as
+ * specified by an execution policy, see \c dash::execution.
+ *
+ * Copying is not partitioned on threads, the number of threads and chunk
+ * size of the policy are ignored. Asynchronous policies with
+ * \c dash::launch::async delegate to \c dash::copy_async.
+ *
+ * \returns  The output range end pointer, or a \c dash::Future of it for
+ *           asynchronous execution policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ValueType,
+  class    GlobInputIt >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, ValueType *>
+copy(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType        * out_first)
+{
+  return dash::internal::copy(policy, in_first, in_last, out_first);
+}
+
+/**
+ * Variant of \c dash::copy as local-to-global copy operation, launched as
+ * specified by an execution policy, see \c dash::execution.
+ *
+ * \returns  The output range end iterator, or a \c dash::Future of it for
+ *           asynchronous execution policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ValueType,
+  class    GlobOutputIt >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, GlobOutputIt>
+copy(
+  ExecutionPolicy && policy,
+  ValueType        * in_first,
+  ValueType        * in_last,
+  GlobOutputIt       out_first)
+{
+  return dash::internal::copy(policy, in_first, in_last, out_first);
+}
+
 #endif // DOXYGEN
 
 } // namespace dash
@@ -3,27 +3,52 @@
 
 #include <dash/internal/Config.h>
 
+#include <dash/Execution.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
-
-#include <dash/util/UnitLocality.h>
+#include <dash/algorithm/internal/Parallel.h>
 
 #include <dash/dart/if/dart_communication.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <algorithm>
 
 
 namespace dash {
 
+namespace internal {
+
+template <typename GlobIterType>
+void fill(
+  GlobIterType                              first,
+  GlobIterType                              last,
+  const typename GlobIterType::value_type & value,
+  const parallel_config                   & config)
+{
+  typedef typename GlobIterType::value_type value_t;
+
+  // Global iterators to local range:
+  auto      index_range = dash::local_range(first, last);
+  value_t * lfirst      = index_range.begin;
+  value_t * llast       = index_range.end;
+
+  dash::internal::parallel_for(
+    llast - lfirst,
+    config,
+    [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+      std::fill(lfirst + c_first, lfirst + c_last, value);
+    });
+}
+
+} // namespace internal
+
 /**
  * Assigns the given value to the elements in the range [first, last)
  *
  * Being a collaborative operation, each unit will assign the value to
- * its local elements only.
+ * its local elements only, in chunks on the threads available to the
+ * unit.
  *
  * \tparam      ElementType  Type of the elements in the sequence
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
@@ -40,42 +65,39 @@ void fill(
   /// Value which will be assigned to the elements in range [first, last)
   const typename GlobIterType::value_type & value)
 {
-  typedef typename GlobIterType::index_type index_t;
-  typedef typename GlobIterType::value_type value_t;
+  dash::internal::fill(first, last, value,
+                       dash::internal::parallel_config());
+}
 
-  // Global iterators to local range:
-  auto      index_range = dash::local_range(first, last);
-  value_t * lfirst      = index_range.begin;
-  value_t * llast       = index_range.end;
-  auto      nlocal      = llast - lfirst;
-
-#if 0
-  for (index_t lt = 0; lt < nlocal; lt++) {
-    lfirst[lt] = value;
-  }
-#else
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::fill", "thread capacity:",  n_threads);
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-#else
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-#endif
-#endif
+/**
+ * Variant of \c dash::fill executing the local phase as specified by an
+ * execution policy, see \c dash::execution.
+ *
+ * \returns  A \c dash::Future<void> for asynchronous execution policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobIterType >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, void>
+fill(
+  /// Execution policy of the local phase
+  ExecutionPolicy  && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIterType        first,
+  /// Iterator to the final position in the sequence
+  GlobIterType        last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const typename GlobIterType::value_type & value)
+{
+  typedef typename GlobIterType::value_type value_t;
+  value_t fill_value = value;
+  return dash::internal::execute<void>(
+           policy,
+           [=](const dash::internal::parallel_config & config) {
+             dash::internal::fill(first, last, fill_value, config);
+           });
 }
 
 } // namespace dash
@@ -5,6 +5,7 @@
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
 #include <dash/dart/if/dart_communication.h>
 
 namespace dash {
@@ -14,6 +15,9 @@ namespace dash {
  * compares equal to \c val.
  * If no such element is found, the function returns \c last.
  *
+ * Local elements are searched in chunks by the threads available to the
+ * unit, chunks following the first match are skipped.
+ *
  * \ingroup     DashAlgorithms
  */
 template<
@@ -53,7 +57,14 @@ GlobIter<ElementType, PatternType> find(
 
     DASH_LOG_DEBUG("local index range", l_begin_index, l_end_index);
 
-    auto l_result = std::find(l_range_begin, l_range_end, value);
+    auto l_result = l_range_begin + dash::internal::parallel_find(
+                      l_range_end - l_range_begin,
+                      dash::internal::parallel_config(),
+                      [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+                        return std::find(l_range_begin + c_first,
+                                         l_range_begin + c_last,
+                                         value) - l_range_begin;
+                      });
     if(l_result == l_range_end){
       DASH_LOG_DEBUG("Not found in local range");
       g_index = std::numeric_limits<p_index_t>::max();
@@ -116,9 +127,15 @@ GlobIter<ElementType, PatternType> find_if(
   auto l_first       = index_range.begin;
   auto l_last        = index_range.end;
 
-  auto l_result      = std::find_if(l_first, l_last, predicate);
-  auto l_offset      = std::distance(l_first, l_result);
-  if (l_result == l_last) {
+  auto l_offset      = dash::internal::parallel_find(
+                         l_last - l_first,
+                         dash::internal::parallel_config(),
+                         [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+                           return std::find_if(l_first + c_first,
+                                               l_first + c_last,
+                                               predicate) - l_first;
+                         });
+  if (l_offset == l_last - l_first) {
     l_offset = -1;
   }
 
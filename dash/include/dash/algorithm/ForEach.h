@@ -1,19 +1,94 @@
 #ifndef DASH__ALGORITHM__FOR_EACH_H__
 #define DASH__ALGORITHM__FOR_EACH_H__
 
+#include <dash/Execution.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Parallel.h>
 
 #include <algorithm>
 
 
 namespace dash {
 
+namespace internal {
+
+template <
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+void for_each(
+  const GlobIter<ElementType, PatternType> & first,
+  const GlobIter<ElementType, PatternType> & last,
+  UnaryFunction                              func,
+  const parallel_config                    & config)
+{
+  /// Global iterators to local index range:
+  auto index_range  = dash::local_index_range(first, last);
+  auto lbegin_index = index_range.begin;
+  auto lend_index   = index_range.end;
+  auto & team       = first.pattern().team();
+  if (lbegin_index != lend_index) {
+    // Local range to native pointers, from non-const global memory:
+    auto first_it     = first;
+    auto lrange_begin = first_it.globmem().lbegin() + lbegin_index;
+    dash::internal::parallel_for(
+      lend_index - lbegin_index,
+      config,
+      [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+        dash::internal::parallel_chunk_loop(
+          c_first, c_last, config,
+          [&](std::ptrdiff_t i) { func(lrange_begin[i]); });
+      });
+  }
+  team.barrier();
+}
+
+template <
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunctionWithIndex >
+void for_each_with_index(
+  const GlobIter<ElementType, PatternType> & first,
+  const GlobIter<ElementType, PatternType> & last,
+  UnaryFunctionWithIndex                     func,
+  const parallel_config                    & config)
+{
+  /// Global iterators to local index range:
+  auto index_range  = dash::local_index_range(first, last);
+  auto lbegin_index = index_range.begin;
+  auto lend_index   = index_range.end;
+  auto & team       = first.pattern().team();
+  if (lbegin_index != lend_index) {
+    // Pattern from global begin iterator:
+    auto & pattern    = first.pattern();
+    // Native pointer to local memory, from non-const global memory:
+    auto   first_it   = first;
+    auto   lbegin     = first_it.globmem().lbegin();
+    // Iterate local index range:
+    dash::internal::parallel_for(
+      lend_index - lbegin_index,
+      config,
+      [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+        for (auto lindex = lbegin_index + c_first;
+             lindex != lbegin_index + c_last;
+             ++lindex) {
+          func(lbegin[lindex], pattern.global(lindex));
+        }
+      });
+  }
+  team.barrier();
+}
+
+} // namespace internal
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * This function has the same signature as \c std::for_each but
  * Being a collaborative operation, each unit will invoke the given
  * function on its local elements only.
+ * The function is invoked on the local elements in order by the calling
+ * thread, use \c dash::execution::par to invoke it concurrently.
  * To support compiler optimization, this const version is provided
  *
  * \tparam      ElementType   Type of the elements in the sequence
@@ -40,20 +115,41 @@ void for_each(
   /// Function to invoke on every index in the range
   UnaryFunction                              func)
 {
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto & pattern    = first.pattern();
-    // Local range to native pointers:
-    auto lrange_begin = (first + pattern.global(lbegin_index)).local();
-    auto lrange_end   = lrange_begin + lend_index;
-    std::for_each(lrange_begin, lrange_end, func);
-  }
-  team.barrier();
+  dash::internal::for_each(first, last, func,
+                           dash::execution::seq.config());
+}
+
+/**
+ * Variant of \c dash::for_each executing the local phase as specified by
+ * an execution policy, see \c dash::execution.
+ * With \c dash::execution::par_unseq, \c func may be invoked in vectorized
+ * loops.
+ *
+ * \returns  A \c dash::Future<void> for asynchronous execution policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, void>
+for_each(
+  /// Execution policy of the local phase
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunction                              func)
+{
+  return dash::internal::execute<void>(
+           policy,
+           [=](const dash::internal::parallel_config & config) {
+             dash::internal::for_each(first, last, func, config);
+           });
 }
 
 /**
@@ -61,6 +157,8 @@ void for_each(
  * Being a collaborative operation, each unit will invoke the given
  * function on its local elements only. The index passed to the function is
  * a global index.
+ * The function is invoked on the local elements in order by the calling
+ * thread, use \c dash::execution::par to invoke it concurrently.
  *
  * \tparam      ElementType            Type of the elements in the sequence
  * \tparam      UnaryFunctionWithIndex Function to invoke for each element
@@ -87,25 +185,39 @@ void for_each_with_index(
   /// Function to invoke on every index in the range
   UnaryFunctionWithIndex                     func)
 {
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto & pattern    = first.pattern();
-    auto first_offset = first.pos();
-    // Iterate local index range:
-    for (auto lindex = lbegin_index;
-         lindex != lend_index;
-         ++lindex) {
-      auto gindex       = pattern.global(lindex);
-      auto element_it   = first + (gindex - first_offset);
-      func(*(element_it.local()), gindex);
-    }
-  }
-  team.barrier();
+  dash::internal::for_each_with_index(first, last, func,
+                                      dash::execution::seq.config());
+}
+
+/**
+ * Variant of \c dash::for_each_with_index executing the local phase as
+ * specified by an execution policy, see \c dash::execution.
+ *
+ * \returns  A \c dash::Future<void> for asynchronous execution policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunctionWithIndex >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, void>
+for_each_with_index(
+  /// Execution policy of the local phase
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunctionWithIndex                     func)
+{
+  return dash::internal::execute<void>(
+           policy,
+           [=](const dash::internal::parallel_config & config) {
+             dash::internal::for_each_with_index(first, last, func, config);
+           });
 }
 
 } // namespace dash
@@ -1,9 +1,11 @@
 #ifndef DASH__ALGORITHM__GENERATE_H__
 #define DASH__ALGORITHM__GENERATE_H__
 
+#include <dash/Execution.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -12,12 +14,72 @@
 
 namespace dash {
 
+namespace internal {
+
+template <
+    typename ElementType,
+    class    PatternType,
+    class    UnaryFunction >
+void generate(
+  GlobIter<ElementType, PatternType> first,
+  GlobIter<ElementType, PatternType> last,
+  UnaryFunction                      gen,
+  const parallel_config            & config) {
+  /// Global iterators to local range:
+  auto lrange = dash::local_range(first, last);
+  auto lfirst = lrange.begin;
+  auto llast  = lrange.end;
+
+  dash::internal::parallel_for(
+    llast - lfirst,
+    config,
+    [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+      std::generate(lfirst + c_first, lfirst + c_last, gen);
+    });
+}
+
+template <
+    typename ElementType,
+    class    PatternType,
+    class    UnaryFunction >
+void generate_with_index(
+  GlobIter<ElementType, PatternType> first,
+  GlobIter<ElementType, PatternType> last,
+  UnaryFunction                      gen,
+  const parallel_config            & config) {
+  /// Global iterators to local index range:
+  auto index_range  = dash::local_index_range(first, last);
+  auto lbegin_index = index_range.begin;
+  auto lend_index   = index_range.end;
+
+  if (lbegin_index != lend_index) {
+    // Pattern from global begin iterator:
+    auto & pattern    = first.pattern();
+    auto   lbegin     = first.globmem().lbegin();
+    // Iterate local index range:
+    dash::internal::parallel_for(
+      lend_index - lbegin_index,
+      config,
+      [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+        for (auto lindex = lbegin_index + c_first;
+             lindex != lbegin_index + c_last;
+             ++lindex) {
+          lbegin[lindex] = gen(pattern.global(lindex));
+        }
+      });
+  }
+}
+
+} // namespace internal
+
 /**
  * Assigns each element in range [first, last) a value generated by the
  * given function object g.
  *
  * Being a collaborative operation, each unit will invoke the given
- * function on its local elements only.
+ * function on its local elements only, in order on the calling thread.
+ * Use \c dash::execution::par to invoke it concurrently, every chunk of
+ * local elements is then generated by a copy of \c gen.
  *
  * \tparam      ElementType    Type of the elements in the sequence
  *                             invoke, deduced from parameter \c gen
@@ -40,12 +102,40 @@ void generate (
   GlobIter<ElementType, PatternType> last,
   /// Generator function
   UnaryFunction                      gen) {
-  /// Global iterators to local range:
-  auto lrange = dash::local_range(first, last);
-  auto lfirst = lrange.begin;
-  auto llast  = lrange.end;
+  dash::internal::generate(first, last, gen,
+                           dash::execution::seq.config());
+}
 
-  std::generate(lfirst, llast, gen);
+/**
+ * Variant of \c dash::generate executing the local phase as specified by
+ * an execution policy, see \c dash::execution.
+ * With \c dash::execution::par, every chunk of local elements is
+ * generated by a copy of \c gen.
+ *
+ * \returns  A \c dash::Future<void> for asynchronous execution policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+    class    ExecutionPolicy,
+    typename ElementType,
+    class    PatternType,
+    class    UnaryFunction >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, void>
+generate(
+  /// Execution policy of the local phase
+  ExecutionPolicy                 && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Generator function
+  UnaryFunction                      gen) {
+  return dash::internal::execute<void>(
+           policy,
+           [=](const dash::internal::parallel_config & config) {
+             dash::internal::generate(first, last, gen, config);
+           });
 }
 
 /**
@@ -54,7 +144,8 @@ void generate (
  * a global index.
  *
  * Being a collaborative operation, each unit will invoke the given
- * function on its local elements only.
+ * function on its local elements only, in order on the calling thread.
+ * Use \c dash::execution::par to invoke it concurrently.
  *
  * \tparam      ElementType    Type of the elements in the sequence
  *                             invoke, deduced from parameter \c gen
@@ -77,24 +168,38 @@ void generate_with_index(
   GlobIter<ElementType, PatternType> last,
   /// Generator function
   UnaryFunction                      gen) {
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
+  dash::internal::generate_with_index(first, last, gen,
+                                      dash::execution::seq.config());
+}
 
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto & pattern    = first.pattern();
-    auto first_offset = first.pos();
-    // Iterate local index range:
-    for (auto lindex = lbegin_index;
-         lindex != lend_index;
-         ++lindex) {
-      auto gindex     = pattern.global(lindex);
-      auto element_it = first + (gindex - first_offset);
-      *element_it = gen(gindex);
-    }
-  }
+/**
+ * Variant of \c dash::generate_with_index executing the local phase as
+ * specified by an execution policy, see \c dash::execution.
+ *
+ * \returns  A \c dash::Future<void> for asynchronous execution policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+    class    ExecutionPolicy,
+    typename ElementType,
+    class    PatternType,
+    class    UnaryFunction >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, void>
+generate_with_index(
+  /// Execution policy of the local phase
+  ExecutionPolicy                 && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Generator function
+  UnaryFunction                      gen) {
+  return dash::internal::execute<void>(
+           policy,
+           [=](const dash::internal::parallel_config & config) {
+             dash::internal::generate_with_index(first, last, gen, config);
+           });
 }
 
 } // namespace dash
@@ -4,8 +4,10 @@
 #include <dash/internal/Config.h>
 
 #include <dash/Allocator.h>
+#include <dash/Execution.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Parallel.h>
 
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
@@ -17,17 +19,52 @@
 #include <algorithm>
 #include <memory>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
-
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Finds the first occurrence of the smallest value in a local range on
+ * the threads specified in \c config.
+ */
+template <
+  class ElementType,
+  class Compare >
+const ElementType * min_element_local(
+  const ElementType     * l_range_begin,
+  const ElementType     * l_range_end,
+  Compare                 compare,
+  const parallel_config & config)
+{
+  // Offsets of the first minimum in chunks, combined in order of chunks
+  // to find the first occurrence of the minimum:
+  std::ptrdiff_t l_min_idx = 0;
+  if (!dash::internal::parallel_reduce(
+         l_range_end - l_range_begin,
+         config,
+         [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+           return ::std::min_element(l_range_begin + first,
+                                     l_range_begin + last,
+                                     compare) - l_range_begin;
+         },
+         [&](std::ptrdiff_t lhs, std::ptrdiff_t rhs) {
+           return compare(l_range_begin[rhs], l_range_begin[lhs])
+                  ? rhs : lhs;
+         },
+         l_min_idx)) {
+    return l_range_end;
+  }
+  return l_range_begin + l_min_idx;
+}
+
+} // namespace internal
+
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
- * Specialization for local range, delegates to std::min_element.
+ * Specialization for local range, delegates to std::min_element on
+ * chunks of the range processed by the threads available to the unit.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
@@ -53,112 +90,22 @@ const ElementType * min_element(
   Compare             compare
     = std::less<const ElementType &>())
 {
-#ifdef DASH_ENABLE_OPENMP
-  typedef typename std::decay<ElementType>::type      value_t;
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::min_element", "thread capacity:",  n_threads);
-
-  // TODO: Should also restrict on elements/units > ~10240.
-  //       Find a model for the minimum work laod.
-  if (n_threads > 1) {
-    auto          l_size     = l_range_end - l_range_begin;
-    int           min_idx_l  = 0;
-    ElementType   min_val_l  = *l_range_begin;
-
-    typedef struct min_pos_t { value_t val; size_t idx; } min_pos;
-
-    DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size);
-    int       align_bytes      = uloc.cache_line_size(0);
-    size_t    min_vals_t_size  = n_threads + 1 +
-                                 (align_bytes / sizeof(min_pos));
-    size_t    min_vals_t_bytes = min_vals_t_size * sizeof(min_pos);
-    min_pos * min_vals_t_raw   = new min_pos[min_vals_t_size];
-    void    * min_vals_t_alg   = min_vals_t_raw;
-    min_pos * min_vals_t       = static_cast<min_pos *>(
-                                   dash::align(
-                                     align_bytes,
-                                     sizeof(min_pos),
-                                     min_vals_t_alg,
-                                     min_vals_t_bytes));
-    DASH_LOG_TRACE("dash::min_element", "min * alloc:",   min_vals_t_raw);
-    DASH_LOG_TRACE("dash::min_element", "min * aligned:", min_vals_t);
-    DASH_LOG_TRACE("dash::min_element", "min * size:",    min_vals_t_bytes);
-    DASH_ASSERT_GE(min_vals_t_bytes, n_threads * sizeof(min_pos),
-                   "Aligned buffer of min_pos has insufficient size");
-    DASH_ASSERT_MSG(nullptr != min_vals_t,
-                    "Aligned allocation of min_pos returned nullptr");
-
-    // Cannot use user-defined reduction (OpenMP 4.0) as the compare
-    // predicate cannot be used in `omp declare reduction`.
-    // Avoid omp for + omp critical section by using array of
-    // thread-local minimum values, aligned to prevent false sharing:
-    int t_id;
-    #pragma omp parallel num_threads(n_threads) private(t_id)
-    {
-      // Documentation of Intel MIC intrinsics, see:
-      // https://software.intel.com/de-de/node/523533
-      // https://software.intel.com/de-de/node/523387
-      t_id = omp_get_thread_num();
-      DASH_LOG_TRACE("dash::min_element", "starting thread", t_id);
-      min_vals_t[t_id].idx = min_idx_l;
-      min_vals_t[t_id].val = min_val_l;
-      // Cannot use explicit private(min_val_t) as ElementType might
-      // not be default-constructible:
-      #pragma omp for schedule(static)
-      for (int i = 0; i < l_size; i++) {
-        const ElementType & val_t = *(l_range_begin + i);
-        if (compare(val_t, min_vals_t[t_id].val)) {
-          min_vals_t[t_id].val = val_t;
-          min_vals_t[t_id].idx = i;
-        }
-      }
-      DASH_LOG_TRACE("dash::min_element", "local minimum at thread", t_id,
-                     "idx:", min_vals_t[t_id].idx,
-                     "val:", min_vals_t[t_id].val);
-    }
-    min_pos min_pos_l = min_vals_t[0];
-    for (int t = 1; t < n_threads; t++) {
-      const min_pos & mpt = min_vals_t[t];
-      if (compare(mpt.val, min_pos_l.val)) {
-        min_pos_l = mpt;
-      }
-    }
-    delete[] min_vals_t_raw;
-    return (l_range_begin + min_pos_l.idx);
-  }
-#endif // DASH_ENABLE_OPENMP
-  return ::std::min_element(l_range_begin, l_range_end, compare);
+  return dash::internal::min_element_local(
+           l_range_begin, l_range_end, compare,
+           dash::internal::parallel_config());
 }
 
-/**
- * Finds an iterator pointing to the element with the smallest value in
- * the range [first,last).
- *
- * \return      An iterator to the first occurrence of the smallest value
- *              in the range, or \c last if the range is empty.
- *
- * \tparam      ElementType  Type of the elements in the sequence
- * \tparam      Compare      Binary comparison function with signature
- *                           \c bool (const TypeA &a, const TypeB &b)
- *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
- *
- * \ingroup     DashAlgorithms
- */
+namespace internal {
+
 template <
   class ElementType,
   class PatternType,
-  class Compare = std::less<const ElementType &> >
+  class Compare >
 GlobIter<ElementType, PatternType> min_element(
-  /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
-  /// Iterator to the final position in the sequence
   const GlobIter<ElementType, PatternType> & last,
-  /// Element comparison function, defaults to std::less
-  Compare                                    compare
-    = std::less<const ElementType &>())
+  Compare                                    compare,
+  const parallel_config                    & config)
 {
   typedef dash::GlobIter<ElementType, PatternType> globiter_t;
   typedef PatternType                               pattern_t;
@@ -199,7 +146,8 @@ GlobIter<ElementType, PatternType> min_element(
     const ElementType * l_range_begin = lbegin + local_idx_range.begin;
     const ElementType * l_range_end   = lbegin + local_idx_range.end;
 
-    lmin = dash::min_element(l_range_begin, l_range_end, compare);
+    lmin = dash::internal::min_element_local(l_range_begin, l_range_end,
+                                             compare, config);
 
     if (lmin != l_range_end) {
       DASH_LOG_TRACE_VAR("dash::min_element", *lmin);
@@ -300,6 +248,77 @@ GlobIter<ElementType, PatternType> min_element(
   return minimum;
 }
 
+} // namespace internal
+
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<const ElementType &> >
+GlobIter<ElementType, PatternType> min_element(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::less<const ElementType &>())
+{
+  return dash::internal::min_element(first, last, compare,
+                                     dash::internal::parallel_config());
+}
+
+/**
+ * Variant of \c dash::min_element executing the local phase as specified
+ * by an execution policy, see \c dash::execution.
+ * Unsequenced policies are executed like their parallel counterparts.
+ *
+ * \returns  A \c dash::Future of the iterator for asynchronous execution
+ *           policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<const ElementType &> >
+dash::internal::enable_if_execution_policy_t<
+  ExecutionPolicy, GlobIter<ElementType, PatternType> >
+min_element(
+  /// Execution policy of the local phase
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::less<const ElementType &>())
+{
+  return dash::internal::execute<GlobIter<ElementType, PatternType>>(
+           policy,
+           [=](const dash::internal::parallel_config & config) {
+             return dash::internal::min_element(first, last, compare,
+                                                config);
+           });
+}
+
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
@@ -3,10 +3,12 @@
 
 #include <dash/Types.h>
 #include <dash/Meta.h>
+#include <dash/Exception.h>
 
 #include <dash/dart/if/dart_types.h>
 
 #include <functional>
+#include <type_traits>
 
 
 /**
@@ -36,12 +38,113 @@ public:
   typedef ValueType value_type;
 
 public:
-  constexpr typename std::enable_if< enabled, dart_operation_t >::type
-  dart_operation() const {
+  constexpr dart_operation_t dart_operation() const {
     return _op;
   }
 };
 
+/**
+ * Reduce operation without DART equivalent for the value type, such as
+ * arithmetic operations on user-defined types.
+ *
+ * \ingroup  DashReduceOperations
+ */
+template <
+  typename         ValueType,
+  dart_operation_t OP >
+class ReduceOperation<ValueType, OP, false> {
+public:
+  typedef ValueType value_type;
+};
+
+/**
+ * Registers a binary operation on elements of type \c ValueType as DART
+ * reduce operation for the lifetime of the instance, so reductions with
+ * user-defined operations can be performed by DART collectives.
+ *
+ * Value types without native DART type are registered as custom DART
+ * type of \c sizeof(ValueType) bytes.
+ *
+ * \ingroup  DashReduceOperations
+ */
+template <
+  typename ValueType,
+  class    BinaryOperation >
+class CustomReduceOperation {
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "user-defined reduce operations require trivially copyable "
+                "value type");
+
+  typedef CustomReduceOperation<ValueType, BinaryOperation> self_t;
+
+  static constexpr bool native_type =
+    dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED;
+
+public:
+  typedef ValueType value_type;
+
+public:
+  /**
+   * Registers \c op, operands of non-commutative operations are combined
+   * in order of unit ids.
+   */
+  CustomReduceOperation(
+    BinaryOperation op,
+    bool            commutative)
+  : _op(op),
+    _dart_type(dash::dart_datatype<ValueType>::value)
+  {
+    if (!native_type) {
+      DASH_ASSERT_RETURNS(
+        dart_type_create_custom(sizeof(ValueType), &_dart_type),
+        DART_OK);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_op_create(&self_t::apply, &_op, commutative, _dart_type,
+                     &_dart_op),
+      DART_OK);
+  }
+
+  CustomReduceOperation(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)               = delete;
+
+  ~CustomReduceOperation()
+  {
+    dart_op_destroy(&_dart_op);
+    if (!native_type) {
+      dart_type_destroy(&_dart_type);
+    }
+  }
+
+  dart_operation_t dart_operation() const {
+    return _dart_op;
+  }
+
+  dart_datatype_t dart_type() const {
+    return _dart_type;
+  }
+
+private:
+  static void apply(
+    const void * invec,
+    void       * inoutvec,
+    size_t       len,
+    void       * userdata)
+  {
+    const ValueType * in    = static_cast<const ValueType *>(invec);
+    ValueType       * inout = static_cast<ValueType *>(inoutvec);
+    BinaryOperation & op    = *static_cast<BinaryOperation *>(userdata);
+    for (size_t i = 0; i < len; ++i) {
+      inout[i] = op(in[i], inout[i]);
+    }
+  }
+
+private:
+  BinaryOperation  _op;
+  dart_datatype_t  _dart_type;
+  dart_operation_t _dart_op   = DART_OP_UNDEFINED;
+};
+
 } // namespace internal
 
 /**
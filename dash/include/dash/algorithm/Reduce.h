@@ -0,0 +1,239 @@
+#ifndef DASH__ALGORITHM__REDUCE_H__
+#define DASH__ALGORITHM__REDUCE_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/internal/Logging.h>
+
+#include <type_traits>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Reduces the transformed values of elements in the local range
+ * \c [l_first, l_last) without initial value.
+ *
+ * \returns  \c false if the local range is empty, in which case \c result
+ *           is not modified.
+ */
+template <
+  class ElementType,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+bool transform_reduce_local(
+  const ElementType     * l_first,
+  const ElementType     * l_last,
+  BinaryOperation         reduce_op,
+  UnaryOperation          transform_op,
+  ValueType             & result,
+  const parallel_config & config = parallel_config())
+{
+  if (l_first == nullptr || l_first == l_last) {
+    return false;
+  }
+  DASH_LOG_TRACE_VAR("dash::transform_reduce", l_last - l_first);
+  return dash::internal::parallel_reduce(
+           l_last - l_first,
+           config,
+           [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+             ValueType c_result = transform_op(l_first[c_first]);
+             for (auto i = c_first + 1; i < c_last; ++i) {
+               c_result = reduce_op(c_result, transform_op(l_first[i]));
+             }
+             return c_result;
+           },
+           [&](const ValueType & lhs, const ValueType & rhs) {
+             return reduce_op(lhs, rhs);
+           },
+           result);
+}
+
+/**
+ * Combines partial results of all units in the team using the DART
+ * reduce operation of \c reduce_op on the native DART type of
+ * \c ValueType.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+ValueType transform_reduce_combine(
+  const accumulate_partial<ValueType> & l_partial,
+  ValueType                             init,
+  BinaryOperation                       reduce_op,
+  dash::Team                          & team,
+  std::true_type                        /* native DART reduction */)
+{
+  return accumulate_combine(l_partial, init, reduce_op, team, true,
+                            std::true_type());
+}
+
+/**
+ * Combines partial results of all units in the team with \c reduce_op
+ * registered as commutative user-defined DART reduce operation.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+ValueType transform_reduce_combine(
+  const accumulate_partial<ValueType> & l_partial,
+  ValueType                             init,
+  BinaryOperation                       reduce_op,
+  dash::Team                          & team,
+  std::false_type                       /* native DART reduction */)
+{
+  auto g_partial = accumulate_reduce_partials(
+                     l_partial, reduce_op, team, true, true);
+  return g_partial.valid ? reduce_op(init, g_partial.val) : init;
+}
+
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ValueType transform_reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  BinaryOperation reduce_op,
+  UnaryOperation  transform_op)
+{
+  typedef std::integral_constant<
+            bool,
+            accumulate_identity<BinaryOperation, ValueType>::defined &&
+            dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED >
+    native_reduce;
+
+  auto & team        = in_first.team();
+  auto   index_range = dash::local_range(in_first, in_last);
+
+  accumulate_partial<ValueType> l_partial;
+  l_partial.val   = init;
+  l_partial.valid = transform_reduce_local(
+                      index_range.begin, index_range.end,
+                      reduce_op, transform_op, l_partial.val);
+  DASH_LOG_TRACE("dash::transform_reduce", "local partial result valid:",
+                 l_partial.valid);
+  return transform_reduce_combine(l_partial, init, reduce_op, team,
+                                  native_reduce());
+}
+
+} // namespace internal
+
+/**
+ * Reduces the values in range \c [first, last) and \c init using the
+ * binary operation \c op, like \c std::reduce.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * Every unit reduces its local elements on the threads available to the
+ * unit. Partial results of units are reduced with a single
+ * \c dart_allreduce. Operations without DART equivalent, such as lambdas
+ * or functors on user-defined types, are registered as user-defined DART
+ * operation for the duration of the call, value types without native DART
+ * type are registered as custom DART type.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
+ *
+ * in unspecified order, \c op must be associative and commutative and the
+ * value type must be trivially copyable.
+ *
+ * \see      dash::accumulate
+ * \see      dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation >
+ValueType reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  BinaryOperation op)
+{
+  typedef typename GlobInputIt::value_type element_t;
+  return dash::internal::transform_reduce(
+           in_first, in_last, init, op,
+           [](const element_t & value) { return ValueType(value); });
+}
+
+/**
+ * Reduces the values in range \c [first, last) and \c init to their sum.
+ *
+ * Collective operation, the result is returned at all units.
+ *
+ * \see      dash::reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType >
+ValueType reduce(
+  GlobInputIt in_first,
+  GlobInputIt in_last,
+  ValueType   init)
+{
+  return dash::reduce(in_first, in_last, init, dash::plus<ValueType>());
+}
+
+/**
+ * Applies \c transform_op to every value in range \c [first, last) and
+ * reduces the results and \c init using the binary operation
+ * \c reduce_op, like \c std::transform_reduce.
+ *
+ * Collective operation, the result is returned at all units.
+ * Partial results are reduced as in \c dash::reduce, \c reduce_op must be
+ * associative and commutative.
+ *
+ * Example:
+ *
+ * \code
+ *   // Sum of squares:
+ *   double sum_sq = dash::transform_reduce(
+ *                     array.begin(), array.end(), 0.0,
+ *                     dash::plus<double>(),
+ *                     [](double v) { return v * v; });
+ * \endcode
+ *
+ * \see      dash::reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ValueType transform_reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  BinaryOperation reduce_op,
+  UnaryOperation  transform_op)
+{
+  return dash::internal::transform_reduce(
+           in_first, in_last, init, reduce_op, transform_op);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__REDUCE_H__
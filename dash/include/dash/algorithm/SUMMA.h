@@ -6,9 +6,13 @@
 #include <dash/Pattern.h>
 #include <dash/Future.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/internal/Gemm.h>
 #include <dash/util/Trace.h>
 
+#include <algorithm>
+#include <array>
 #include <utility>
+#include <vector>
 
 // Prefer MKL if available:
 #ifdef DASH_ENABLE_MKL
@@ -49,43 +53,24 @@ void mmult_local(
   MemArrange        storage);
 #else
 /**
- * Naive matrix multiplication for local multiplication of matrix blocks,
- * used only for tests and where MKL is not available.
+ * Matrix multiplication for local multiplication of matrix blocks via the
+ * built-in kernel \c gemm_local, used where neither MKL nor BLAS is
+ * available.
  */
 template<typename ValueType>
 void mmult_local(
-  /// Matrix to multiply, extents n x m
+  /// Matrix to multiply, m rows by k columns.
   const ValueType * A,
-  /// Matrix to multiply, extents m x p
+  /// Matrix to multiply, k rows by n columns.
   const ValueType * B,
-  /// Matrix to contain the multiplication result, extents n x p
+  /// Matrix to contain the multiplication result, m rows by n columns.
   ValueType       * C,
   long long         m,
   long long         n,
-  long long         p,
+  long long         k,
   MemArrange        storage)
 {
-#ifndef DEBUG
-  DASH_THROW(
-    dash::exception::RuntimeError,
-    "Called fallback implementation of DGEMM (only enabled in Debug)");
-#endif
-  ValueType c_sum = 0;
-  for (auto i = 0; i < n; ++i) {
-    // row i = 0...n
-    for (auto j = 0; j < p; ++j) {
-      // column j = 0...p
-      c_sum = C[i * p + j]; // = C[j][i]
-      for (auto k = 0; k < m; ++k) {
-        // k = 0...m
-        auto ik     = i * m + k;
-        auto kj     = k * m + j;
-        auto value  = A[ik] * B[kj];
-        c_sum      += value;
-      }
-      C[i * p + j] = c_sum; // C[j][i] = c_sum
-    }
-  }
+  gemm_local(A, B, C, m, n, k, storage);
 }
 #endif // defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 
@@ -589,6 +574,426 @@ void summa(
   DASH_LOG_TRACE("dash::summa >", "finished");
 }
 
+/// Constraints on pattern partitioning properties of matrix operands passed
+/// to \c dash::summa_bcast.
+typedef dash::pattern_partitioning_properties<
+            // Block extents are constant for every dimension.
+            dash::pattern_partitioning_tag::rectangular,
+            // Identical number of elements in every block.
+            dash::pattern_partitioning_tag::balanced
+        > summa_bcast_pattern_partitioning_constraints;
+/// Constraints on pattern layout properties of matrix operands passed to
+/// \c dash::summa_bcast.
+typedef dash::pattern_layout_properties<
+            // Elements are contiguous in local memory within single block.
+            dash::pattern_layout_tag::blocked,
+            // Local element order corresponds to a logical linearization
+            // within single blocks.
+            dash::pattern_layout_tag::linear
+        > summa_bcast_pattern_layout_constraints;
+
+namespace internal {
+
+/**
+ * Creates the DART teams of the rows (\c dim 1) or columns (\c dim 0) of
+ * the process grid \c teamspec of \c team and returns the team the
+ * calling unit is a member of.
+ * Collective operation on \c team, teams are created one after another as
+ * every unit has to pass the same group to \c dart_team_create.
+ * No teams are created for a process grid of extent 1 in \c dim, the
+ * returned team is \c DART_TEAM_NULL then.
+ */
+template<typename TeamSpecType>
+dart_team_t summa_grid_team(
+  dash::Team         & team,
+  const TeamSpecType & teamspec,
+  dim_t                dim)
+{
+  dim_t       other_dim = 1 - dim;
+  dart_team_t grid_team = DART_TEAM_NULL;
+  if (teamspec.extent(dim) < 2) {
+    return grid_team;
+  }
+  auto        coords    = teamspec.coords(team.myid());
+  for (decltype(teamspec.extent(other_dim)) g = 0;
+       g < teamspec.extent(other_dim); ++g) {
+    coords[other_dim] = g;
+    dart_group_t group;
+    DASH_ASSERT_RETURNS(
+      dart_group_create(&group),
+      DART_OK);
+    for (decltype(teamspec.extent(dim)) i = 0; i < teamspec.extent(dim); ++i) {
+      coords[dim] = i;
+      team_unit_t unit(teamspec.at(coords));
+      DASH_ASSERT_RETURNS(
+        dart_group_addmember(group, team.global_id(unit)),
+        DART_OK);
+    }
+    dart_team_t new_team = DART_TEAM_NULL;
+    DASH_ASSERT_RETURNS(
+      dart_team_create(team.dart_id(), group, &new_team),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_group_destroy(&group),
+      DART_OK);
+    if (new_team != DART_TEAM_NULL) {
+      grid_team = new_team;
+    }
+  }
+  return grid_team;
+}
+
+/**
+ * Whether the blocks of a matrix are mapped to the units in \c teamspec
+ * round-robin in both dimensions, i.e. block (i,j) is owned by the unit
+ * at coordinates (i mod P0, j mod P1) in the process grid.
+ */
+template<typename PatternType, typename TeamSpecType>
+bool summa_block_cyclic(
+  const PatternType  & pattern,
+  const TeamSpecType & teamspec)
+{
+  typedef typename PatternType::index_type       index_t;
+  typedef std::array<index_t, 2>                 coords_t;
+  auto block_rows = pattern.block(0).extent(0);
+  auto block_cols = pattern.block(0).extent(1);
+  if (pattern.extent(0) % block_rows != 0 ||
+      pattern.extent(1) % block_cols != 0) {
+    return false;
+  }
+  index_t num_blocks_rows = pattern.extent(0) / block_rows;
+  index_t num_blocks_cols = pattern.extent(1) / block_cols;
+  index_t p_rows          = teamspec.extent(0);
+  index_t p_cols          = teamspec.extent(1);
+  for (index_t bi = 0; bi < num_blocks_rows; ++bi) {
+    for (index_t bj = 0; bj < num_blocks_cols; ++bj) {
+      coords_t elem_coords {{ bi * static_cast<index_t>(block_rows),
+                              bj * static_cast<index_t>(block_cols) }};
+      coords_t unit_coords {{ bi % p_rows, bj % p_cols }};
+      if (pattern.unit_at(elem_coords).id !=
+          static_cast<dart_unit_t>(teamspec.at(unit_coords))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace internal
+
+/**
+ * Multiplies two matrices using the SUMMA algorithm with panel broadcasts
+ * in rows and columns of the process grid.
+ *
+ * Matrices are distributed in rectangular blocks, block (i,j) is owned by
+ * the unit at coordinates (i mod P0, j mod P1) in a P0 x P1 process grid,
+ * e.g. by \c dash::TilePattern. Process grid and blocks do not have to be
+ * square, blocks of A must have as many columns as blocks of B have rows.
+ *
+ * In step k, the owner of block column k of A in every process row
+ * broadcasts its blocks to the other units in the row, the owner of block
+ * row k of B in every process column to the other units in the column.
+ * Every block is sent once per row or column instead of being fetched by
+ * every unit that needs it.
+ * Broadcasts of the next \c pipeline_depth - 1 steps are in flight while
+ * the blocks of the current step are multiplied.
+ *
+ * Pseudocode:
+ *
+ *   for k = 1:b:m {
+ *     bcast A(my rows, k:k+b-1) in process row
+ *     bcast B(k:k+b-1, my cols) in process column
+ *     C(my rows, my cols) += A(my rows, k:k+b-1) * B(k:k+b-1, my cols)
+ *   }
+ */
+template<
+  typename MatrixTypeA,
+  typename MatrixTypeB,
+  typename MatrixTypeC
+>
+void summa_bcast(
+  /// Matrix to multiply, extents n x m
+  MatrixTypeA & A,
+  /// Matrix to multiply, extents m x p
+  MatrixTypeB & B,
+  /// Matrix to contain the multiplication result, extents n x p,
+  /// initialized with zeros
+  MatrixTypeC & C,
+  /// Number of steps with broadcasts in flight, at least 1
+  int           pipeline_depth = 2)
+{
+  typedef typename MatrixTypeA::value_type   value_type;
+  typedef typename MatrixTypeA::index_type   index_t;
+  typedef std::array<index_t, 2>             coords_t;
+
+  static_assert(
+      std::is_floating_point<value_type>::value,
+      "dash::summa_bcast expects matrix element type double or float");
+  static_assert(
+      MatrixTypeA::pattern_type::memory_order() ==
+        MatrixTypeC::pattern_type::memory_order() &&
+      MatrixTypeB::pattern_type::memory_order() ==
+        MatrixTypeC::pattern_type::memory_order(),
+      "dash::summa_bcast expects identical memory order of matrices");
+
+  DASH_LOG_DEBUG("dash::summa_bcast()", "pipeline depth:", pipeline_depth);
+
+  dash::check_pattern_constraints<
+    summa_bcast_pattern_partitioning_constraints,
+    dash::pattern_mapping_properties<>,
+    summa_bcast_pattern_layout_constraints
+  >(A.pattern());
+  dash::check_pattern_constraints<
+    summa_bcast_pattern_partitioning_constraints,
+    dash::pattern_mapping_properties<>,
+    summa_bcast_pattern_layout_constraints
+  >(B.pattern());
+  dash::check_pattern_constraints<
+    summa_bcast_pattern_partitioning_constraints,
+    dash::pattern_mapping_properties<>,
+    summa_bcast_pattern_layout_constraints
+  >(C.pattern());
+
+  if (pipeline_depth < 1) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_bcast(): pipeline depth must be at least 1, got " <<
+      pipeline_depth);
+  }
+
+  dash::Team & team = C.team();
+  const auto & pattern_a = A.pattern();
+  const auto & pattern_b = B.pattern();
+  const auto & pattern_c = C.pattern();
+  const auto & teamspec  = pattern_c.teamspec();
+
+  DASH_ASSERT_EQ(
+    pattern_a.extent(1),
+    pattern_b.extent(0),
+    "dash::summa_bcast(): "
+    "Extents of first operand in dimension 1 do not match extents of "
+    "second operand in dimension 0");
+  DASH_ASSERT_EQ(
+    pattern_c.extent(0),
+    pattern_a.extent(0),
+    "dash::summa_bcast(): "
+    "Extents of result matrix in dimension 0 do not match extents of "
+    "first operand in dimension 0");
+  DASH_ASSERT_EQ(
+    pattern_c.extent(1),
+    pattern_b.extent(1),
+    "dash::summa_bcast(): "
+    "Extents of result matrix in dimension 1 do not match extents of "
+    "second operand in dimension 1");
+
+  // Block extents, A: rows x inner, B: inner x cols, C: rows x cols
+  auto block_rows = pattern_c.block(0).extent(0);
+  auto block_cols = pattern_c.block(0).extent(1);
+  auto block_inner = pattern_a.block(0).extent(1);
+  if (pattern_a.block(0).extent(0) != block_rows ||
+      pattern_b.block(0).extent(0) != block_inner ||
+      pattern_b.block(0).extent(1) != block_cols) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_bcast(): block extents of matrices do not match, " <<
+      "A: " << pattern_a.block(0).extents() << " " <<
+      "B: " << pattern_b.block(0).extents() << " " <<
+      "C: " << pattern_c.block(0).extents());
+  }
+  if (A.team().dart_id() != team.dart_id() ||
+      B.team().dart_id() != team.dart_id() ||
+      pattern_a.teamspec().extents() != teamspec.extents() ||
+      pattern_b.teamspec().extents() != teamspec.extents()) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_bcast(): matrices are not distributed on the same "
+      "process grid");
+  }
+  if (!internal::summa_block_cyclic(pattern_a, teamspec) ||
+      !internal::summa_block_cyclic(pattern_b, teamspec) ||
+      !internal::summa_block_cyclic(pattern_c, teamspec)) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_bcast(): matrix blocks are not mapped round-robin to "
+      "the process grid");
+  }
+
+  const dash::MemArrange memory_order = pattern_c.memory_order();
+  const dart_datatype_t  dtype        = dash::dart_datatype<value_type>::value;
+
+  index_t p_rows          = teamspec.extent(0);
+  index_t p_cols          = teamspec.extent(1);
+  index_t num_blocks_rows = pattern_c.extent(0) / block_rows;
+  index_t num_blocks_cols = pattern_c.extent(1) / block_cols;
+  index_t num_blocks_k    = pattern_a.extent(1) / block_inner;
+  auto    unit_ts_coords  = teamspec.coords(team.myid());
+  index_t my_row          = unit_ts_coords[0];
+  index_t my_col          = unit_ts_coords[1];
+  // Block rows of A and C and block columns of B and C owned by this unit:
+  index_t num_l_rows      = (num_blocks_rows - my_row + p_rows - 1) / p_rows;
+  index_t num_l_cols      = (num_blocks_cols - my_col + p_cols - 1) / p_cols;
+  auto    block_a_size    = block_rows * block_inner;
+  auto    block_b_size    = block_inner * block_cols;
+
+  DASH_LOG_TRACE("dash::summa_bcast", "process grid:", p_rows, "x", p_cols,
+                 "unit coords:", unit_ts_coords,
+                 "local block rows:", num_l_rows,
+                 "local block cols:", num_l_cols,
+                 "k blocks:", num_blocks_k);
+
+  dash::util::Trace trace("SUMMA");
+
+  // Units in the same process row receive blocks of A, units in the same
+  // process column receive blocks of B:
+  dart_team_t row_team = internal::summa_grid_team(team, teamspec, 1);
+  dart_team_t col_team = internal::summa_grid_team(team, teamspec, 0);
+  // Broadcast roots by column in the row team and by row in the column
+  // team:
+  std::vector<dart_team_unit_t> row_roots(p_cols);
+  std::vector<dart_team_unit_t> col_roots(p_rows);
+  for (index_t col = 0; p_cols > 1 && col < p_cols; ++col) {
+    coords_t root_coords {{ my_row, col }};
+    DASH_ASSERT_RETURNS(
+      dart_team_unit_g2l(
+        row_team,
+        team.global_id(team_unit_t(teamspec.at(root_coords))),
+        &row_roots[col]),
+      DART_OK);
+  }
+  for (index_t row = 0; p_rows > 1 && row < p_rows; ++row) {
+    coords_t root_coords {{ row, my_col }};
+    DASH_ASSERT_RETURNS(
+      dart_team_unit_g2l(
+        col_team,
+        team.global_id(team_unit_t(teamspec.at(root_coords))),
+        &col_roots[row]),
+      DART_OK);
+  }
+
+  std::vector<value_type *> l_blocks_c;
+  l_blocks_c.reserve(num_l_rows * num_l_cols);
+  for (index_t li = 0; li < num_l_rows; ++li) {
+    for (index_t lj = 0; lj < num_l_cols; ++lj) {
+      l_blocks_c.push_back(
+        C.block(coords_t {{ my_row + li * p_rows,
+                            my_col + lj * p_cols }}).begin().local());
+    }
+  }
+
+  // Panels of the steps in flight, blocks of the panel are either received
+  // in the panel buffer or local blocks of the broadcast root:
+  struct panel {
+    std::vector<value_type>        buf_a;
+    std::vector<value_type>        buf_b;
+    std::vector<const value_type*> blocks_a;
+    std::vector<const value_type*> blocks_b;
+    std::vector<dart_handle_t>     handles;
+  };
+  int num_panels = static_cast<int>(
+                     std::min<index_t>(pipeline_depth, num_blocks_k));
+  std::vector<panel> panels(num_panels);
+  for (auto & pnl : panels) {
+    pnl.buf_a.resize(num_l_rows * block_a_size);
+    pnl.buf_b.resize(num_l_cols * block_b_size);
+    pnl.blocks_a.resize(num_l_rows);
+    pnl.blocks_b.resize(num_l_cols);
+    pnl.handles.reserve(num_l_rows + num_l_cols);
+  }
+
+  auto start_panel = [&](index_t block_k, panel & pnl) {
+    trace.enter_state("bcast");
+    // Root of the broadcast of block column k of A in this process row:
+    index_t root_col = block_k % p_cols;
+    for (index_t li = 0; li < num_l_rows; ++li) {
+      value_type * block = pnl.buf_a.data() + li * block_a_size;
+      if (my_col == root_col) {
+        block = A.block(coords_t {{ my_row + li * p_rows, block_k }})
+                 .begin().local();
+      }
+      pnl.blocks_a[li] = block;
+      if (p_cols > 1) {
+        dart_handle_t handle;
+        DASH_ASSERT_RETURNS(
+          dart_bcast_handle(block, block_a_size, dtype, row_roots[root_col],
+                            row_team, &handle),
+          DART_OK);
+        pnl.handles.push_back(handle);
+      }
+    }
+    // Root of the broadcast of block row k of B in this process column:
+    index_t root_row = block_k % p_rows;
+    for (index_t lj = 0; lj < num_l_cols; ++lj) {
+      value_type * block = pnl.buf_b.data() + lj * block_b_size;
+      if (my_row == root_row) {
+        block = B.block(coords_t {{ block_k, my_col + lj * p_cols }})
+                 .begin().local();
+      }
+      pnl.blocks_b[lj] = block;
+      if (p_rows > 1) {
+        dart_handle_t handle;
+        DASH_ASSERT_RETURNS(
+          dart_bcast_handle(block, block_b_size, dtype, col_roots[root_row],
+                            col_team, &handle),
+          DART_OK);
+        pnl.handles.push_back(handle);
+      }
+    }
+    trace.exit_state("bcast");
+  };
+
+  for (index_t block_k = 0; block_k < num_panels; ++block_k) {
+    start_panel(block_k, panels[block_k]);
+  }
+  for (index_t block_k = 0; block_k < num_blocks_k; ++block_k) {
+    auto & pnl = panels[block_k % num_panels];
+    DASH_LOG_TRACE("dash::summa_bcast", "summa.block.k", block_k,
+                   "waiting for", pnl.handles.size(), "broadcasts");
+    trace.enter_state("prefetch");
+    DASH_ASSERT_RETURNS(
+      dart_waitall(pnl.handles.data(), pnl.handles.size()),
+      DART_OK);
+    pnl.handles.clear();
+    trace.exit_state("prefetch");
+
+    trace.enter_state("multiply");
+    for (index_t li = 0; li < num_l_rows; ++li) {
+      for (index_t lj = 0; lj < num_l_cols; ++lj) {
+        dash::internal::mmult_local<value_type>(
+            pnl.blocks_a[li],
+            pnl.blocks_b[lj],
+            l_blocks_c[li * num_l_cols + lj],
+            block_rows,
+            block_cols,
+            block_inner,
+            memory_order);
+      }
+    }
+    trace.exit_state("multiply");
+
+    if (block_k + num_panels < num_blocks_k) {
+      start_panel(block_k + num_panels, pnl);
+    }
+  }
+
+  if (row_team != DART_TEAM_NULL) {
+    DASH_ASSERT_RETURNS(
+      dart_team_destroy(&row_team),
+      DART_OK);
+  }
+  if (col_team != DART_TEAM_NULL) {
+    DASH_ASSERT_RETURNS(
+      dart_team_destroy(&col_team),
+      DART_OK);
+  }
+
+  DASH_LOG_TRACE("dash::summa_bcast", "waiting for other units");
+  trace.enter_state("barrier");
+  C.barrier();
+  trace.exit_state("barrier");
+
+  DASH_LOG_TRACE("dash::summa_bcast >", "finished");
+}
+
 #ifdef DOXYGEN
 /**
  * Function adapter to an implementation of matrix-matrix multiplication
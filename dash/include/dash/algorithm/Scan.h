@@ -0,0 +1,532 @@
+#ifndef DASH__ALGORITHM__SCAN_H__
+#define DASH__ALGORITHM__SCAN_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Contiguous chunk of a local range that is scanned by a single thread.
+ */
+template<typename ValueType>
+struct scan_chunk {
+  /// Offset of the first element of the chunk in the local range
+  std::ptrdiff_t                 begin;
+  /// Offset past the last element of the chunk in the local range
+  std::ptrdiff_t                 end;
+  /// Combination of all elements in the chunk
+  accumulate_partial<ValueType>  total;
+  /// Combination of all elements preceding the chunk in the global range
+  accumulate_partial<ValueType>  prefix;
+};
+
+/**
+ * Partitions the local range of \c l_size elements in contiguous chunks,
+ * at most one for every thread available to the calling unit.
+ */
+template<typename ValueType>
+std::vector<scan_chunk<ValueType>> scan_chunks(std::ptrdiff_t l_size)
+{
+  std::ptrdiff_t n_threads = parallel_num_threads(parallel_config());
+  std::ptrdiff_t n_chunks  = std::max<std::ptrdiff_t>(
+                               1,
+                               std::min<std::ptrdiff_t>(
+                                 n_threads,
+                                 l_size / parallel_min_chunk_size));
+  DASH_LOG_DEBUG("dash::scan", "chunks:", n_chunks);
+  std::vector<scan_chunk<ValueType>> chunks(n_chunks);
+  std::ptrdiff_t chunk_size = (l_size + n_chunks - 1) / n_chunks;
+  for (std::ptrdiff_t c = 0; c < n_chunks; ++c) {
+    chunks[c].begin        = std::min(c * chunk_size, l_size);
+    chunks[c].end          = std::min(chunks[c].begin + chunk_size, l_size);
+    chunks[c].total.valid  = false;
+    chunks[c].prefix.valid = false;
+  }
+  return chunks;
+}
+
+/**
+ * Calls \c func for every chunk, each on a separate thread.
+ */
+template<typename ValueType, class ChunkFunc>
+void scan_for_chunks(
+  std::vector<scan_chunk<ValueType>> & chunks,
+  ChunkFunc                         && func)
+{
+  parallel_for(
+    chunks.size(),
+    parallel_config(chunks.size(), 1),
+    [&](std::ptrdiff_t c_first, std::ptrdiff_t c_last) {
+      for (auto c = c_first; c < c_last; ++c) {
+        func(chunks[c]);
+      }
+    });
+}
+
+/**
+ * Scans every chunk of the local range \c l_in to \c l_out independently
+ * and stores the chunks' totals.
+ *
+ * For an inclusive scan, \c l_out[i] is the combination of the elements
+ * in the chunk up to and including \c l_in[i]. For an exclusive scan,
+ * \c l_out[i] is the combination of the elements in the chunk preceding
+ * \c l_in[i] and the first element of every chunk is left undefined.
+ * Input and output range may be identical.
+ */
+template <
+  class InputType,
+  class ValueType,
+  class BinaryOperation >
+void scan_local_chunks(
+  const InputType                    * l_in,
+  ValueType                          * l_out,
+  BinaryOperation                      binary_op,
+  bool                                 exclusive,
+  std::vector<scan_chunk<ValueType>> & chunks)
+{
+  auto scan_one = [&](scan_chunk<ValueType> & chunk) {
+    if (chunk.begin == chunk.end) {
+      return;
+    }
+    ValueType acc = l_in[chunk.begin];
+    if (!exclusive) {
+      l_out[chunk.begin] = acc;
+    }
+    for (auto i = chunk.begin + 1; i < chunk.end; ++i) {
+      // Read input before writing output for in-place scans:
+      ValueType in_i = l_in[i];
+      if (exclusive) {
+        l_out[i] = acc;
+      }
+      acc = binary_op(acc, in_i);
+      if (!exclusive) {
+        l_out[i] = acc;
+      }
+    }
+    chunk.total.val   = acc;
+    chunk.total.valid = true;
+  };
+  scan_for_chunks(chunks, scan_one);
+}
+
+/**
+ * Combines the prefix \c prefix of the calling unit's local range with
+ * the chunk scans in \c l_out to the final scan result.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+void scan_local_fixup(
+  ValueType                          * l_out,
+  BinaryOperation                      binary_op,
+  bool                                 exclusive,
+  std::vector<scan_chunk<ValueType>> & chunks)
+{
+  auto fixup_chunk = [&](const scan_chunk<ValueType> & chunk) {
+    if (chunk.begin == chunk.end || !chunk.prefix.valid) {
+      // Only the first chunk in the global range of an inclusive scan
+      // without initial value has no prefix, its scan is final
+      return;
+    }
+    const ValueType prefix = chunk.prefix.val;
+    auto first = chunk.begin;
+    if (exclusive) {
+      l_out[first++] = prefix;
+    }
+    for (auto i = first; i < chunk.end; ++i) {
+      l_out[i] = binary_op(prefix, l_out[i]);
+    }
+  };
+  scan_for_chunks(chunks, fixup_chunk);
+}
+
+/**
+ * Exclusive scan of the local totals of all units in the team using the
+ * DART reduce operation of \c binary_op on the native DART type of
+ * \c ValueType.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+accumulate_partial<ValueType> scan_units(
+  const accumulate_partial<ValueType> & l_total,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team,
+  std::true_type                        /* native DART reduction */)
+{
+  ValueType l_val = l_total.valid
+                    ? l_total.val
+                    : accumulate_identity<BinaryOperation, ValueType>::value();
+  accumulate_partial<ValueType> prefix;
+  prefix.val   = l_val;
+  DASH_ASSERT_RETURNS(
+    dart_exscan(
+      &l_val,
+      &prefix.val,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      binary_op.dart_operation(),
+      team.dart_id()),
+    DART_OK);
+  // Result of the exclusive scan is undefined at unit 0:
+  prefix.valid = (team.myid() != 0);
+  return prefix;
+}
+
+/**
+ * Exclusive scan of the local totals of all units in the team by
+ * gathering the totals and combining those of preceding units in order
+ * of unit ids.
+ * Used for reduce operations without DART equivalent and value types
+ * without native DART type.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+accumulate_partial<ValueType> scan_units(
+  const accumulate_partial<ValueType> & l_total,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team,
+  std::false_type                       /* native DART reduction */)
+{
+  typedef accumulate_partial<ValueType> partial_t;
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::scan requires trivially copyable value type");
+
+  std::vector<partial_t> totals(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_total,
+      totals.data(),
+      sizeof(partial_t),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  partial_t prefix;
+  prefix.valid = false;
+  for (dart_unit_t u = 0; u < team.myid().id; ++u) {
+    const auto & total = totals[u];
+    if (!total.valid) {
+      continue;
+    }
+    prefix.val   = prefix.valid ? binary_op(prefix.val, total.val)
+                                : total.val;
+    prefix.valid = true;
+  }
+  return prefix;
+}
+
+/**
+ * Local range of a unit in the input range of a scan.
+ */
+struct scan_unit_range {
+  enum error_t : int {
+    ok = 0,
+    /// Local input and output ranges differ in size
+    size_mismatch,
+    /// Local range is not contiguous in global index range
+    not_contiguous
+  };
+  int            error;
+  /// Number of elements in the local range
+  std::ptrdiff_t size;
+  /// Global index of the first element in the local range
+  std::ptrdiff_t g_first;
+  /// Global index of the last element in the local range
+  std::ptrdiff_t g_last;
+};
+
+/**
+ * Validates the local ranges of all units in the team before the
+ * collective scan, so either all or no units throw.
+ * Local ranges must be contiguous in the global index range and ordered
+ * by unit id.
+ * Collective operation.
+ *
+ * \throws  dash::exception::InvalidArgument  on all units if the local
+ *          range of any unit is invalid.
+ */
+inline void check_scan_ranges(
+  const scan_unit_range & l_range,
+  dash::Team            & team)
+{
+  std::vector<scan_unit_range> ranges(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_range,
+      ranges.data(),
+      sizeof(scan_unit_range),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  if (l_range.error == scan_unit_range::size_mismatch) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::scan: local input and output range of unit " << team.myid() <<
+      " differ in size");
+  }
+  if (l_range.error == scan_unit_range::not_contiguous) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::scan: local range of unit " << team.myid() <<
+      " is not contiguous in global index range");
+  }
+  const scan_unit_range * prev = nullptr;
+  for (size_t u = 0; u < ranges.size(); ++u) {
+    const auto & range = ranges[u];
+    if (range.error != scan_unit_range::ok) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::scan: invalid local range at unit " << u);
+    }
+    if (range.size == 0) {
+      continue;
+    }
+    if (prev != nullptr && range.g_first != prev->g_last + 1) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::scan: local range of unit " << u << " does not follow " <<
+        "the local range of the preceding unit in global index range");
+    }
+    prev = &range;
+  }
+}
+
+/**
+ * Scan of the global range \c [in_first, in_last) to the range starting
+ * at \c out_first:
+ *
+ * 1. every chunk of the local range is scanned by a thread,
+ * 2. the totals of the units' local ranges are scanned across units,
+ * 3. the prefix of every chunk is combined with its scan.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation >
+GlobOutputIt scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op,
+  const accumulate_partial<ValueType> & init,
+  bool            exclusive)
+{
+  typedef std::integral_constant<
+            bool,
+            accumulate_identity<BinaryOperation, ValueType>::defined &&
+            dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED >
+    native_reduce;
+
+  auto & team     = in_first.team();
+  auto   n        = in_last - in_first;
+  auto   out_last = out_first + n;
+
+  auto in_index_range  = dash::local_index_range(in_first, in_last);
+  auto out_index_range = dash::local_index_range(out_first, out_last);
+  std::ptrdiff_t l_size = in_index_range.end - in_index_range.begin;
+  scan_unit_range l_range;
+  l_range.error   = scan_unit_range::ok;
+  l_range.size    = l_size;
+  l_range.g_first = 0;
+  l_range.g_last  = 0;
+  if (out_index_range.end - out_index_range.begin != l_size) {
+    l_range.error = scan_unit_range::size_mismatch;
+  } else if (l_size > 0) {
+    const auto & pattern = in_first.pattern();
+    l_range.g_first = pattern.global(in_index_range.begin);
+    l_range.g_last  = pattern.global(in_index_range.end - 1);
+    if (l_range.g_last - l_range.g_first != l_size - 1) {
+      l_range.error = scan_unit_range::not_contiguous;
+    }
+  }
+  check_scan_ranges(l_range, team);
+  auto l_in  = dash::local_range(in_first, in_last).begin;
+  auto l_out = dash::local_range(out_first, out_last).begin;
+  DASH_LOG_TRACE("dash::scan", "local range size:", l_size,
+                 "exclusive:", exclusive);
+
+  auto chunks = scan_chunks<ValueType>(l_size);
+  scan_local_chunks(l_in, l_out, binary_op, exclusive, chunks);
+
+  accumulate_partial<ValueType> l_total;
+  l_total.valid = false;
+  for (const auto & chunk : chunks) {
+    if (chunk.total.valid) {
+      l_total.val   = l_total.valid
+                      ? binary_op(l_total.val, chunk.total.val)
+                      : chunk.total.val;
+      l_total.valid = true;
+    }
+  }
+
+  auto unit_prefix = scan_units(l_total, binary_op, team, native_reduce());
+  accumulate_partial<ValueType> prefix = init;
+  if (unit_prefix.valid) {
+    prefix.val   = prefix.valid ? binary_op(prefix.val, unit_prefix.val)
+                                : unit_prefix.val;
+    prefix.valid = true;
+  }
+  for (auto & chunk : chunks) {
+    chunk.prefix = prefix;
+    if (chunk.total.valid) {
+      prefix.val   = prefix.valid ? binary_op(prefix.val, chunk.total.val)
+                                  : chunk.total.val;
+      prefix.valid = true;
+    }
+  }
+  scan_local_fixup(l_out, binary_op, exclusive, chunks);
+
+  return out_last;
+}
+
+} // namespace internal
+
+/**
+ * Computes the inclusive prefix combination of the values in the range
+ * \c [in_first, in_last) using the binary operation \c op and stores it
+ * to the range starting at \c out_first.
+ *
+ * Semantics:
+ *
+ *     out[i] = in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * Collective operation. The local range of every unit in input and
+ * output range must be contiguous in the global index range and local
+ * ranges of units must be ordered by unit id, like in a \c BLOCKED
+ * distribution. Input and output range must be distributed identically
+ * and may be identical.
+ *
+ * Every unit scans its local range in chunks on the threads available to
+ * the unit. Totals of local ranges are combined in a single
+ * \c dart_exscan if \c op is a DASH reduce operation and the value type
+ * has a native DART type, or gathered otherwise. In both cases, \c op
+ * must be associative.
+ *
+ * Only local elements of the output range are written, units must
+ * synchronize before accessing remote elements of the output range.
+ *
+ * \returns  Iterator past the last element written.
+ * \throws   dash::exception::InvalidArgument  on all units if the local
+ *           ranges of the units do not meet these requirements.
+ *
+ * \see      dash::exclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation =
+    dash::plus<typename GlobOutputIt::value_type> >
+GlobOutputIt inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op = BinaryOperation())
+{
+  typedef typename GlobOutputIt::value_type value_t;
+  dash::internal::accumulate_partial<value_t> init;
+  init.valid = false;
+  return dash::internal::scan(
+           in_first, in_last, out_first, binary_op, init, false);
+}
+
+/**
+ * Computes the inclusive prefix combination of the values in the range
+ * \c [in_first, in_last) using the binary operation \c op, starting with
+ * \c init, and stores it to the range starting at \c out_first.
+ *
+ * Semantics:
+ *
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \see      dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class ValueType >
+GlobOutputIt inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op,
+  ValueType       init)
+{
+  typedef typename GlobOutputIt::value_type value_t;
+  dash::internal::accumulate_partial<value_t> g_init;
+  g_init.val   = init;
+  g_init.valid = true;
+  return dash::internal::scan(
+           in_first, in_last, out_first, binary_op, g_init, false);
+}
+
+/**
+ * Computes the exclusive prefix combination of the values in the range
+ * \c [in_first, in_last) using the binary operation \c op, starting with
+ * \c init, and stores it to the range starting at \c out_first.
+ *
+ * Semantics:
+ *
+ *     out[0] = init
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i-1]
+ *
+ * Requirements and synchronization are those of
+ * \c dash::inclusive_scan.
+ *
+ * \returns  Iterator past the last element written.
+ *
+ * \see      dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation =
+    dash::plus<typename GlobOutputIt::value_type> >
+GlobOutputIt exclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  ValueType       init,
+  BinaryOperation binary_op = BinaryOperation())
+{
+  typedef typename GlobOutputIt::value_type value_t;
+  dash::internal::accumulate_partial<value_t> g_init;
+  g_init.val   = init;
+  g_init.valid = true;
+  return dash::internal::scan(
+           in_first, in_last, out_first, binary_op, g_init, true);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__
@@ -0,0 +1,470 @@
+#ifndef DASH__ALGORITHM__SORT_H__
+#define DASH__ALGORITHM__SORT_H__
+
+#include <dash/internal/Config.h>
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Onesided.h>
+#include <dash/Exception.h>
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+
+namespace internal {
+
+/// Maximum number of splitter samples drawn from every unit's local range.
+static const size_t sort_max_samples = 1024;
+/// Number of samples per unit drawn for every bucket.
+static const size_t sort_oversampling = 16;
+
+/**
+ * Merges consecutive sorted runs in \c [data + offsets[0],
+ * data + offsets.back()) to a single sorted sequence.
+ * Runs are merged pairwise in \c log2(runs) rounds, merges within a round
+ * are distributed to threads if OpenMP is enabled.
+ */
+template <
+  class ValueType,
+  class Compare >
+void sort_merge_runs(
+  ValueType           * data,
+  std::vector<size_t>   offsets,
+  Compare               compare,
+  int                   n_threads = 1)
+{
+  while (offsets.size() > 2) {
+    int n_pairs = static_cast<int>((offsets.size() - 1) / 2);
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for num_threads(n_threads) schedule(dynamic)
+#endif
+    for (int p = 0; p < n_pairs; p++) {
+      std::inplace_merge(data + offsets[2 * p],
+                         data + offsets[2 * p + 1],
+                         data + offsets[2 * p + 2],
+                         compare);
+    }
+    std::vector<size_t> merged;
+    merged.reserve(offsets.size() / 2 + 1);
+    for (size_t r = 0; r < offsets.size(); r += 2) {
+      merged.push_back(offsets[r]);
+    }
+    if (merged.back() != offsets.back()) {
+      merged.push_back(offsets.back());
+    }
+    offsets.swap(merged);
+  }
+  DASH_LOG_TRACE("dash::sort", "merged runs");
+}
+
+/**
+ * Sorts the local range \c [l_first, l_last).
+ *
+ * If OpenMP is enabled, the range is partitioned in contiguous chunks
+ * that are sorted by the threads available to the calling unit and
+ * merged subsequently.
+ */
+template <
+  class ValueType,
+  class Compare >
+void sort_local(
+  ValueType * l_first,
+  ValueType * l_last,
+  Compare     compare)
+{
+  size_t l_size = l_last - l_first;
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  auto n_threads = uloc.num_domain_threads();
+  DASH_LOG_DEBUG("dash::sort", "thread capacity:", n_threads);
+  if (n_threads > 1 && l_size > static_cast<size_t>(n_threads)) {
+    std::vector<size_t> offsets(n_threads + 1);
+    for (int t = 0; t <= n_threads; t++) {
+      offsets[t] = (l_size * t) / n_threads;
+    }
+    #pragma omp parallel for num_threads(n_threads) schedule(static)
+    for (int t = 0; t < n_threads; t++) {
+      std::sort(l_first + offsets[t], l_first + offsets[t + 1], compare);
+    }
+    sort_merge_runs(l_first, offsets, compare, n_threads);
+    return;
+  }
+#endif // DASH_ENABLE_OPENMP
+  DASH_LOG_TRACE_VAR("dash::sort", l_size);
+  std::sort(l_first, l_last, compare);
+}
+
+/**
+ * Local split positions of buckets in a sorted local range.
+ *
+ * Elements equal to a splitter value are distributed evenly to the
+ * buckets adjacent to the splitter so that duplicate keys do not
+ * accumulate in a single bucket.
+ *
+ * \returns  Offsets of the buckets' first elements in the local range,
+ *           followed by the local range size.
+ */
+template <
+  class ValueType,
+  class Compare >
+std::vector<size_t> sort_split_local(
+  const ValueType              * l_first,
+  const ValueType              * l_last,
+  const std::vector<ValueType> & splitters,
+  Compare                        compare)
+{
+  size_t nsplitters = splitters.size();
+  std::vector<size_t> splits(nsplitters + 2, 0);
+  splits[nsplitters + 1] = l_last - l_first;
+  size_t s = 0;
+  while (s < nsplitters) {
+    // Run of equal splitters in [s, s_end):
+    size_t s_end = s + 1;
+    while (s_end < nsplitters &&
+           !compare(splitters[s], splitters[s_end])) {
+      ++s_end;
+    }
+    auto   lb   = std::lower_bound(l_first, l_last, splitters[s], compare);
+    auto   ub   = std::upper_bound(lb,      l_last, splitters[s], compare);
+    size_t ties = ub - lb;
+    size_t run  = s_end - s;
+    for (size_t r = 0; r < run; ++r) {
+      splits[s + r + 1] = (lb - l_first) + (ties * (r + 1)) / (run + 1);
+    }
+    s = s_end;
+  }
+  return splits;
+}
+
+/**
+ * Resolves the offsets of the first and past-the-last local element in
+ * the global range \c [first, last) by binary search on the global
+ * indices of local elements, in contrast to \c dash::local_index_range
+ * also valid for cyclic distributions.
+ * Requires global indices of local elements to be monotonic in their
+ * local offsets, as in all one-dimensional patterns.
+ */
+template <class GlobRandomIt>
+LocalIndexRange<typename GlobRandomIt::pattern_type::index_type>
+sort_local_index_range(
+  const GlobRandomIt & first,
+  const GlobRandomIt & last)
+{
+  typedef typename GlobRandomIt::pattern_type::index_type  index_t;
+
+  const auto & pattern  = first.pattern();
+  index_t      g_begin  = first.pos();
+  index_t      g_end    = last.pos();
+  index_t      l_size   = pattern.local_size();
+  auto lower_bound = [&](index_t g_index) {
+    index_t lo = 0;
+    index_t hi = l_size;
+    while (lo < hi) {
+      index_t mid = lo + (hi - lo) / 2;
+      if (pattern.global(mid) < g_index) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  };
+  return LocalIndexRange<index_t> { lower_bound(g_begin),
+                                    lower_bound(g_end) };
+}
+
+/**
+ * Writes a sorted bucket to its position in the global range starting at
+ * \c first.
+ * Elements are written in runs of positions that are contiguous in the
+ * local memory of a single unit, so buckets in blocked ranges are written
+ * in one or two operations per unit.
+ */
+template <
+  class GlobRandomIt,
+  class ValueType >
+void sort_write_bucket(
+  GlobRandomIt                   first,
+  size_t                         bucket_offset,
+  const std::vector<ValueType> & bucket)
+{
+  typedef typename GlobRandomIt::pattern_type::index_type  index_t;
+
+  const auto & pattern = first.pattern();
+  auto         myid    = first.team().myid();
+  index_t      g_first = first.pos() + static_cast<index_t>(bucket_offset);
+  size_t       b_size  = bucket.size();
+  size_t       b       = 0;
+  while (b < b_size) {
+    auto   l_pos = pattern.local(g_first + static_cast<index_t>(b));
+    size_t n     = 1;
+    while (b + n < b_size) {
+      auto next = pattern.local(g_first + static_cast<index_t>(b + n));
+      if (next.unit  != l_pos.unit ||
+          next.index != l_pos.index + static_cast<index_t>(n)) {
+        break;
+      }
+      ++n;
+    }
+    if (l_pos.unit == myid) {
+      std::copy(bucket.data() + b, bucket.data() + b + n,
+                first.globmem().lbegin() + l_pos.index);
+    } else {
+      dart_gptr_t gptr = first.globmem().at(
+                           team_unit_t(l_pos.unit), l_pos.index
+                         ).dart_gptr();
+      dash::internal::put_blocking(gptr, bucket.data() + b, n);
+    }
+    b += n;
+  }
+}
+
+} // namespace internal
+
+/**
+ * Sorts the elements in the range \c [first, last) in ascending order
+ * according to \c compare.
+ * The order of equal elements is not guaranteed to be preserved.
+ *
+ * Collective operation, implemented as sample sort:
+ *
+ * 1. Units sort their local elements in the range, using all threads
+ *    available to the unit if OpenMP is enabled.
+ * 2. Splitters are selected from regular samples of all units' sorted
+ *    local elements, gathered with \c dart_allgather. Splitters are chosen
+ *    such that bucket \c u approximately contains the elements at the
+ *    positions of unit \c u's local elements in a blocked range.
+ * 3. Units read the elements of their bucket from all other units in a
+ *    single one-sided get per unit. Gets from units sharing a node
+ *    resolve to a \c memcpy from the shared memory window.
+ * 4. Received sorted runs are merged and written to the bucket's
+ *    position in the global range.
+ *
+ * The element type must be trivially copyable and the global indices of
+ * every unit's local elements must be monotonic in their local offsets,
+ * as in all one-dimensional patterns.
+ *
+ * \complexity  O(nl log nl) local operations, O(p^2) splitter positions
+ *              and O(p * min(16p, 1024)) samples gathered, with \c nl
+ *              local elements in the range and \c p units in the team.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobRandomIt,
+  class Compare >
+void sort(
+  /// Iterator to the initial position in the sequence
+  GlobRandomIt first,
+  /// Iterator to the final position in the sequence
+  GlobRandomIt last,
+  /// Element comparison function
+  Compare      compare)
+{
+  typedef typename GlobRandomIt::value_type                value_t;
+  typedef typename GlobRandomIt::pattern_type::index_type  index_t;
+
+  static_assert(std::is_trivially_copyable<value_t>::value,
+                "dash::sort requires trivially copyable element type");
+
+  if (first == last) {
+    return;
+  }
+
+  auto & team     = first.team();
+  auto   myid     = team.myid();
+  size_t nunits   = team.size();
+  auto   l_idx    = dash::internal::sort_local_index_range(first, last);
+  size_t l_size   = l_idx.end - l_idx.begin;
+  value_t * l_first = (l_size == 0)
+                      ? nullptr
+                      : first.globmem().lbegin() + l_idx.begin;
+  value_t * l_last  = (l_size == 0) ? nullptr : l_first + l_size;
+
+  DASH_LOG_TRACE("dash::sort()", "local index range:",
+                 l_idx.begin, "-", l_idx.end);
+
+  // Phase 1: Sort local elements.
+  if (l_size > 0) {
+    dash::internal::sort_local(l_first, l_last, compare);
+  }
+
+  // Local offset and size of the local range of every unit:
+  size_t l_range[2] = { static_cast<size_t>(l_idx.begin), l_size };
+  std::vector<size_t> l_ranges(2 * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_range,
+      l_ranges.data(),
+      2,
+      dash::dart_datatype<size_t>::value,
+      team.dart_id()),
+    DART_OK);
+
+  if (nunits == 1) {
+    return;
+  }
+
+  // Phase 2: Select splitters from regular samples of sorted local ranges.
+  size_t nsamples = std::min(nunits * dash::internal::sort_oversampling,
+                             dash::internal::sort_max_samples);
+  std::vector<value_t> l_samples(nsamples);
+  for (size_t s = 0; s < nsamples && l_size > 0; ++s) {
+    l_samples[s] = l_first[((2 * s + 1) * l_size) / (2 * nsamples)];
+  }
+  std::vector<value_t> samples(nsamples * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_samples.data(),
+      samples.data(),
+      nsamples * sizeof(value_t),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+
+  // Samples weighted by the number of elements they represent:
+  typedef std::pair<value_t, double> sample_t;
+  std::vector<sample_t> w_samples;
+  w_samples.reserve(samples.size());
+  size_t g_size = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    size_t u_size = l_ranges[2 * u + 1];
+    g_size       += u_size;
+    for (size_t s = 0; s < nsamples && u_size > 0; ++s) {
+      w_samples.push_back(
+        std::make_pair(samples[u * nsamples + s],
+                       static_cast<double>(u_size) / nsamples));
+    }
+  }
+  std::sort(w_samples.begin(), w_samples.end(),
+            [&](const sample_t & a, const sample_t & b) {
+              return compare(a.first, b.first);
+            });
+  // Splitter u is the sample at weighted rank of the first element of
+  // unit u+1:
+  std::vector<value_t> splitters;
+  splitters.reserve(nunits - 1);
+  double w_cumul = 0;
+  size_t r_cumul = 0;
+  auto   w_it    = w_samples.begin();
+  for (size_t u = 0; u < nunits - 1; ++u) {
+    r_cumul += l_ranges[2 * u + 1];
+    while (w_it + 1 != w_samples.end() &&
+           static_cast<double>(r_cumul) > w_cumul + w_it->second) {
+      w_cumul += w_it->second;
+      ++w_it;
+    }
+    splitters.push_back(w_it->first);
+  }
+
+  // Phase 3: Exchange bucket boundaries and read buckets.
+  std::vector<size_t> l_splits = dash::internal::sort_split_local(
+                                   l_first, l_last, splitters, compare);
+  std::vector<size_t> splits((nunits + 1) * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_splits.data(),
+      splits.data(),
+      nunits + 1,
+      dash::dart_datatype<size_t>::value,
+      team.dart_id()),
+    DART_OK);
+
+  // Sizes of all buckets, offset of the local bucket in the global range
+  // and offsets of the runs received from every unit in the local bucket:
+  std::vector<size_t> run_offsets(nunits + 1, 0);
+  size_t bucket_offset = 0;
+  for (size_t b = 0; b < nunits; ++b) {
+    size_t b_size = 0;
+    for (size_t u = 0; u < nunits; ++u) {
+      const size_t * u_splits = splits.data() + u * (nunits + 1);
+      size_t         n        = u_splits[b + 1] - u_splits[b];
+      if (b == static_cast<size_t>(myid)) {
+        run_offsets[u + 1] = run_offsets[u] + n;
+      }
+      b_size += n;
+    }
+    if (b < static_cast<size_t>(myid)) {
+      bucket_offset += b_size;
+    }
+  }
+  size_t bucket_size = run_offsets[nunits];
+  DASH_LOG_DEBUG("dash::sort", "bucket offset:", bucket_offset,
+                 "size:", bucket_size);
+
+  // Sorted local ranges must be visible before reading buckets:
+  team.barrier();
+
+  std::vector<value_t> bucket(bucket_size);
+  for (size_t u = 0; u < nunits; ++u) {
+    size_t n = run_offsets[u + 1] - run_offsets[u];
+    if (n == 0) {
+      continue;
+    }
+    const size_t * u_splits = splits.data() + u * (nunits + 1);
+    dart_gptr_t gptr = first.globmem().at(
+                         team_unit_t(u),
+                         static_cast<index_t>(l_ranges[2 * u] +
+                                              u_splits[myid])
+                       ).dart_gptr();
+    dash::internal::get_blocking(gptr,
+                                 bucket.data() + run_offsets[u],
+                                 n);
+  }
+
+  // Phase 4: Merge received runs and write bucket to the global range.
+  int n_threads = 1;
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  n_threads = uloc.num_domain_threads();
+#endif
+  dash::internal::sort_merge_runs(bucket.data(), run_offsets, compare,
+                                  n_threads);
+
+  // All units must have read their buckets before the range is
+  // overwritten:
+  team.barrier();
+  dash::internal::sort_write_bucket(first, bucket_offset, bucket);
+  team.barrier();
+}
+
+/**
+ * Sorts the elements in the range \c [first, last) in ascending order.
+ *
+ * \see      dash::sort(GlobRandomIt, GlobRandomIt, Compare)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+void sort(
+  /// Iterator to the initial position in the sequence
+  GlobRandomIt first,
+  /// Iterator to the final position in the sequence
+  GlobRandomIt last)
+{
+  typedef typename GlobRandomIt::value_type value_t;
+  dash::sort(first, last, std::less<value_t>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SORT_H__
@@ -3,10 +3,12 @@
 
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
+#include <dash/Execution.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/internal/Parallel.h>
 
 #include <dash/iterator/GlobIter.h>
 
@@ -17,9 +19,6 @@
 
 #include <iterator>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
 
 namespace dash {
 
@@ -185,6 +184,12 @@ GlobOutputIt transform(
  *              =    =    =    ...
  *   output:  [ u0 | u1 | u2 | ... ]
  * </pre>
+ *
+ * Local elements are transformed in chunks by the threads specified in
+ * \c config.
+ *
+ * \returns  Output iterator to the element past the last element of the
+ *           global output range, at all units.
  */
 template<
   typename ValueType,
@@ -197,7 +202,8 @@ OutputIt transform_local(
   InputAIt        in_a_last,
   InputBIt        in_b_first,
   OutputIt        out_first,
-  BinaryOperation binary_op)
+  BinaryOperation binary_op,
+  const internal::parallel_config & config = internal::parallel_config())
 {
   DASH_LOG_DEBUG("dash::transform_local()");
   DASH_ASSERT_MSG(in_a_first.pattern() == in_b_first.pattern(),
@@ -206,51 +212,32 @@ OutputIt transform_local(
   DASH_ASSERT_MSG(in_a_first.pattern() == out_first.pattern(),
                   "dash::transform_local: "
                   "distributions of input- and output ranges differ");
-  // Local subrange of input range a:
-  auto local_range_a   = dash::local_range(in_a_first, in_a_last);
-  ValueType * lbegin_a = local_range_a.begin;
-  ValueType * lend_a   = local_range_a.end;
-  if (lbegin_a == lend_a) {
-    // Local input range is empty, return initial output iterator to indicate
-    // that no values have been transformed:
+  // Output iterator past the last element of the global range:
+  auto out_last          = out_first + (in_a_last - in_a_first);
+  // Local index range, identical in all ranges:
+  auto l_index_range     = dash::local_index_range(in_a_first, in_a_last);
+  auto num_lvalues       = l_index_range.end - l_index_range.begin;
+  DASH_LOG_TRACE("dash::transform_local", "local elements:", num_lvalues);
+  if (num_lvalues == 0) {
     DASH_LOG_DEBUG("dash::transform_local", "local range empty");
-    return out_first;
+    return out_last;
   }
-  // Global offset of first local element:
-  auto g_offset_first    = in_a_first.pattern().global(0);
-  // Number of elements in global ranges:
-  auto num_gvalues       = dash::distance(in_a_first, in_b_first);
-  DASH_LOG_TRACE_VAR("dash::transform_local", num_gvalues);
-  // Number of local elements:
-  DASH_LOG_TRACE("dash::transform_local", "local elements:", lend_a-lbegin_a);
-  // Local subrange of input range b:
-  ValueType * lbegin_b   = (in_b_first + g_offset_first).local();
-  // Local pointer of initial output element:
-  ValueType * lbegin_out = (out_first  + g_offset_first).local();
+  // Native pointers to local subranges:
+  auto lbegin_a   = in_a_first.globmem().lbegin() + l_index_range.begin;
+  auto lbegin_b   = in_b_first.globmem().lbegin() + l_index_range.begin;
+  auto lbegin_out = out_first.globmem().lbegin()  + l_index_range.begin;
   // Generate output values:
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::transform_local", "thread capacity:",  n_threads);
-  if (n_threads > 1) {
-    auto l_size = lend_a - lbegin_a;
-    // TODO: Vectorize.
-    // Documentation of Intel MIC intrinsics, see:
-    // https://software.intel.com/de-de/node/523533
-    // https://software.intel.com/de-de/node/523387
-    #pragma omp parallel for num_threads(n_threads) schedule(static)
-    for (int i = 0; i < l_size; i++) {
-      lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
-    }
-    return out_first + num_gvalues;
-  }
-#endif
-  // No OpenMP or insufficient number of threads for parallelization:
-  for (; lbegin_a != lend_a; ++lbegin_a, ++lbegin_b, ++lbegin_out) {
-    *lbegin_out = binary_op(*lbegin_a, *lbegin_b);
-  }
-  // Return out_end iterator past final transformed element;
-  return out_first + num_gvalues;
+  dash::internal::parallel_for(
+    num_lvalues,
+    config,
+    [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+      dash::internal::parallel_chunk_loop(
+        first, last, config,
+        [&](std::ptrdiff_t i) {
+          lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
+        });
+    });
+  return out_last;
 }
 
 /**
@@ -446,6 +433,89 @@ GlobAsyncRef<ValueType> transform(
     "Async variant of dash::transform is not implemented");
 }
 
+namespace internal {
+
+template<
+  typename ValueType,
+  class PatternType,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+GlobOutputIt transform(
+  GlobIter<ValueType, PatternType> in_a_first,
+  GlobIter<ValueType, PatternType> in_a_last,
+  GlobInputIt                      in_b_first,
+  GlobOutputIt                     out_first,
+  BinaryOperation                  binary_op,
+  const parallel_config          & config)
+{
+  if (in_a_first.pattern() == in_b_first.pattern() &&
+      in_a_first.pattern() == out_first.pattern() &&
+      in_a_first.pos()     == in_b_first.pos()     &&
+      in_a_first.pos()     == out_first.pos()) {
+    // All units operate on local ranges that have identical distribution:
+    dash::util::Trace trace("transform");
+    trace.enter_state("local");
+    auto out_last = dash::transform_local<ValueType>(
+                      in_a_first, in_a_last, in_b_first, out_first,
+                      binary_op, config);
+    trace.exit_state("local");
+    return out_last;
+  }
+  dash::transform(in_a_first, in_a_last, in_b_first, out_first, binary_op);
+  return out_first + (in_a_last - in_a_first);
+}
+
+} // namespace internal
+
+/**
+ * Variant of \c dash::transform executing the local phase as specified by
+ * an execution policy, see \c dash::execution.
+ *
+ * If all ranges have identical distribution and start offset, every unit
+ * transforms its local elements in local memory, which is not atomic on
+ * elements. Otherwise, elements are transformed by atomic accumulate
+ * operations as in \c dash::transform.
+ * With \c dash::execution::par_unseq, \c binary_op may be invoked in
+ * vectorized loops.
+ *
+ * \returns  Output iterator to the element past the last element of the
+ *           global output range, or a \c dash::Future of the iterator for
+ *           asynchronous execution policies.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  typename ValueType,
+  class PatternType,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, GlobOutputIt>
+transform(
+  /// Execution policy of the local phase
+  ExecutionPolicy               && policy,
+  /// Iterator on begin of first global range
+  GlobIter<ValueType, PatternType> in_a_first,
+  /// Iterator after last element of first global range
+  GlobIter<ValueType, PatternType> in_a_last,
+  /// Iterator on begin of second global range
+  GlobInputIt                      in_b_first,
+  /// Iterator on first element of global output range
+  GlobOutputIt                     out_first,
+  /// Reduce operation
+  BinaryOperation                  binary_op)
+{
+  return dash::internal::execute<GlobOutputIt>(
+           policy,
+           [=](const dash::internal::parallel_config & config) {
+             return dash::internal::transform(
+                      in_a_first, in_a_last, in_b_first, out_first,
+                      binary_op, config);
+           });
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__TRANSFORM_H__
@@ -0,0 +1,281 @@
+#ifndef DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+
+#include <dash/Types.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Tile sizes of the built-in matrix multiplication kernel \c gemm_local.
+ *
+ * The register tile of \c MR x \c NR elements of C is accumulated in
+ * \c 2 * MR vector registers, \c NR spans two vectors of the widest SIMD
+ * instruction set enabled at compile time.
+ * A panel of \c KC x \c NC elements of B is kept in the last level cache,
+ * a block of \c MC x \c KC elements of A in the L2 cache and a sliver of
+ * \c KC x \c NR elements of B in the L1 cache.
+ */
+template<typename ValueType>
+struct gemm_tiling
+{
+#if defined(__AVX512F__)
+  static constexpr int  simd_bytes = 64;
+#elif defined(__AVX__)
+  static constexpr int  simd_bytes = 32;
+#else
+  static constexpr int  simd_bytes = 16;
+#endif
+  static constexpr int  MR = 6;
+  static constexpr int  NR = 2 * simd_bytes / sizeof(ValueType);
+  static constexpr long long KC = 256;
+  static constexpr long long MC = 16 * MR;
+  static constexpr long long NC = 256 * NR;
+};
+
+/**
+ * Copies rows [0, mc) and columns [0, kc) of the row-major matrix \c A with
+ * leading dimension \c lda to slivers of \c MR rows, stored column by
+ * column. Rows of the last sliver exceeding \c mc are filled with zeros.
+ */
+template<typename ValueType, int MR>
+void gemm_pack_a(
+  const ValueType * A,
+  long long         lda,
+  long long         mc,
+  long long         kc,
+  ValueType       * buf)
+{
+  for (long long i0 = 0; i0 < mc; i0 += MR) {
+    int mr = static_cast<int>(std::min<long long>(MR, mc - i0));
+    for (long long l = 0; l < kc; ++l) {
+      for (int i = 0; i < mr; ++i) {
+        buf[i] = A[(i0 + i) * lda + l];
+      }
+      for (int i = mr; i < MR; ++i) {
+        buf[i] = 0;
+      }
+      buf += MR;
+    }
+  }
+}
+
+/**
+ * Copies rows [0, kc) and columns [0, nc) of the row-major matrix \c B with
+ * leading dimension \c ldb to slivers of \c NR columns, stored row by row.
+ * Columns of the last sliver exceeding \c nc are filled with zeros.
+ */
+template<typename ValueType, int NR>
+void gemm_pack_b(
+  const ValueType * B,
+  long long         ldb,
+  long long         kc,
+  long long         nc,
+  ValueType       * buf)
+{
+  for (long long j0 = 0; j0 < nc; j0 += NR) {
+    int nr = static_cast<int>(std::min<long long>(NR, nc - j0));
+    for (long long l = 0; l < kc; ++l) {
+      const ValueType * b_row = B + l * ldb + j0;
+      for (int j = 0; j < nr; ++j) {
+        buf[j] = b_row[j];
+      }
+      for (int j = nr; j < NR; ++j) {
+        buf[j] = 0;
+      }
+      buf += NR;
+    }
+  }
+}
+
+/**
+ * Adds the product of a packed sliver of A (\c MR x \c kc) and a packed
+ * sliver of B (\c kc x \c NR) to the upper left \c mr x \c nr elements of
+ * the row-major tile \c C with leading dimension \c ldc.
+ *
+ * The accumulators are vectors of the SIMD width, so the compiler keeps
+ * them in registers and emits broadcast and fused multiply-add
+ * instructions. Without GNU vector extensions, the accumulation loops
+ * have compile-time bounds for auto-vectorization instead.
+ */
+template<typename ValueType, int MR, int NR>
+inline void gemm_micro_kernel(
+  long long         kc,
+  const ValueType * a,
+  const ValueType * b,
+  ValueType       * C,
+  long long         ldc,
+  int               mr,
+  int               nr)
+{
+  ValueType c_tile[MR][NR];
+#if defined(__GNUC__)
+  constexpr int VS = gemm_tiling<ValueType>::simd_bytes;
+  constexpr int VL = VS / sizeof(ValueType);
+  constexpr int NV = NR / VL;
+  typedef ValueType vec_t __attribute__((vector_size(VS)));
+
+  vec_t acc[MR][NV];
+  for (int i = 0; i < MR; ++i) {
+    for (int v = 0; v < NV; ++v) {
+      acc[i][v] = vec_t{};
+    }
+  }
+  for (long long l = 0; l < kc; ++l) {
+    vec_t b_l[NV];
+    for (int v = 0; v < NV; ++v) {
+      __builtin_memcpy(&b_l[v], b + v * VL, sizeof(vec_t));
+    }
+    for (int i = 0; i < MR; ++i) {
+      const ValueType a_il = a[i];
+      for (int v = 0; v < NV; ++v) {
+        acc[i][v] += a_il * b_l[v];
+      }
+    }
+    a += MR;
+    b += NR;
+  }
+  __builtin_memcpy(c_tile, acc, sizeof(c_tile));
+#else
+  for (int i = 0; i < MR; ++i) {
+    for (int j = 0; j < NR; ++j) {
+      c_tile[i][j] = 0;
+    }
+  }
+  for (long long l = 0; l < kc; ++l) {
+    for (int i = 0; i < MR; ++i) {
+      const ValueType a_il = a[i];
+      for (int j = 0; j < NR; ++j) {
+        c_tile[i][j] += a_il * b[j];
+      }
+    }
+    a += MR;
+    b += NR;
+  }
+#endif
+  for (int i = 0; i < mr; ++i) {
+    for (int j = 0; j < nr; ++j) {
+      C[i * ldc + j] += c_tile[i][j];
+    }
+  }
+}
+
+/**
+ * Cache-blocked multiplication C += A x B of row-major matrices, see
+ * \c gemm_local.
+ */
+template<typename ValueType>
+void gemm_local_row_major(
+  const ValueType * A,
+  const ValueType * B,
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k)
+{
+  typedef gemm_tiling<ValueType> tiling;
+  constexpr int       MR = tiling::MR;
+  constexpr int       NR = tiling::NR;
+  constexpr long long KC = tiling::KC;
+  constexpr long long MC = tiling::MC;
+  constexpr long long NC = tiling::NC;
+
+  const long long lda = k;
+  const long long ldb = n;
+  const long long ldc = n;
+
+  std::vector<ValueType> b_pack(
+    std::min(KC, k) * ((std::min(NC, n) + NR - 1) / NR) * NR);
+
+  for (long long jc = 0; jc < n; jc += NC) {
+    long long nc = std::min(NC, n - jc);
+    for (long long pc = 0; pc < k; pc += KC) {
+      long long kc = std::min(KC, k - pc);
+      gemm_pack_b<ValueType, NR>(B + pc * ldb + jc, ldb, kc, nc,
+                                 b_pack.data());
+      // Blocks of A are multiplied with the shared panel of B by all
+      // threads available to the unit:
+#ifdef DASH_ENABLE_OPENMP
+      #pragma omp parallel if (m > MC)
+#endif
+      {
+        std::vector<ValueType> a_pack(
+          kc * ((std::min(MC, m) + MR - 1) / MR) * MR);
+#ifdef DASH_ENABLE_OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for (long long ic = 0; ic < m; ic += MC) {
+          long long mc = std::min(MC, m - ic);
+          gemm_pack_a<ValueType, MR>(A + ic * lda + pc, lda, mc, kc,
+                                     a_pack.data());
+          for (long long jr = 0; jr < nc; jr += NR) {
+            int nr = static_cast<int>(std::min<long long>(NR, nc - jr));
+            const ValueType * b_sliver = b_pack.data() + jr * kc;
+            for (long long ir = 0; ir < mc; ir += MR) {
+              int mr = static_cast<int>(std::min<long long>(MR, mc - ir));
+              gemm_micro_kernel<ValueType, MR, NR>(
+                kc,
+                a_pack.data() + ir * kc,
+                b_sliver,
+                C + (ic + ir) * ldc + jc + jr,
+                ldc,
+                mr, nr);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Built-in matrix multiplication C += A x B for local matrix blocks, used
+ * by \c dash::summa if neither MKL nor BLAS is available.
+ *
+ * Operands are packed to contiguous slivers in cache-sized tiles and
+ * multiplied by a register-blocked micro kernel on SIMD vectors. Blocks
+ * of A are distributed on the threads available to the unit if OpenMP is
+ * enabled.
+ *
+ * For column-major storage, the transposed product C^T = B^T x A^T is
+ * computed on the operands in row-major interpretation.
+ */
+template<typename ValueType>
+void gemm_local(
+  /// Matrix to multiply, m rows by k columns.
+  const ValueType * A,
+  /// Matrix to multiply, k rows by n columns.
+  const ValueType * B,
+  /// Matrix to contain the multiplication result, m rows by n columns.
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  MemArrange        storage)
+{
+  static_assert(std::is_arithmetic<ValueType>::value,
+                "dash::summa: built-in multiplication kernel requires "
+                "arithmetic value types");
+  if (m <= 0 || n <= 0 || k <= 0) {
+    return;
+  }
+  if (storage == dash::COL_MAJOR) {
+    gemm_local_row_major(B, A, C, n, m, k);
+  } else {
+    gemm_local_row_major(A, B, C, m, n, k);
+  }
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
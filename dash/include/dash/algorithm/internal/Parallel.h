@@ -0,0 +1,288 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+
+#include <dash/internal/Config.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Assignment of chunks of a local range to threads.
+ */
+enum class parallel_schedule : int {
+  /// Chunks are assigned to threads round-robin in ascending order.
+  static_chunks,
+  /// Threads take the next unprocessed chunk when done with their last.
+  dynamic_chunks
+};
+
+/**
+ * Minimum number of elements per chunk if no chunk size is specified,
+ * smaller ranges are processed by the calling thread.
+ */
+constexpr std::ptrdiff_t parallel_min_chunk_size = 1024;
+
+/**
+ * Configuration of the intra-unit parallel execution of local algorithm
+ * phases.
+ */
+struct parallel_config {
+  /// Number of threads, 0 for the threads available in the unit's domain.
+  int               num_threads;
+  /// Number of elements per chunk, 0 for one chunk per thread for static
+  /// schedules.
+  std::ptrdiff_t    chunk_size;
+  parallel_schedule schedule;
+  /// Whether loops over elements in a chunk may be vectorized.
+  bool              unsequenced;
+
+  constexpr parallel_config(
+    int               nthreads = 0,
+    std::ptrdiff_t    nchunk   = 0,
+    parallel_schedule sched    = parallel_schedule::static_chunks,
+    bool              unseq    = false)
+  : num_threads(nthreads),
+    chunk_size(nchunk),
+    schedule(sched),
+    unsequenced(unseq)
+  { }
+};
+
+/**
+ * Number of threads to process a local range, as specified in \c config
+ * or sized from \c dash::util::UnitLocality::num_domain_threads.
+ * Always 1 if OpenMP is disabled.
+ */
+inline int parallel_num_threads(const parallel_config & config)
+{
+#ifdef DASH_ENABLE_OPENMP
+  if (config.num_threads > 0) {
+    return config.num_threads;
+  }
+  dash::util::UnitLocality uloc;
+  return std::max(1, uloc.num_domain_threads());
+#else
+  (void)(config);
+  return 1;
+#endif
+}
+
+/**
+ * Number of elements per chunk to partition a range of \c size elements on
+ * \c n_threads threads.
+ */
+inline std::ptrdiff_t parallel_chunk_size(
+  std::ptrdiff_t          size,
+  int                     n_threads,
+  const parallel_config & config)
+{
+  if (config.chunk_size > 0) {
+    return config.chunk_size;
+  }
+  std::ptrdiff_t chunk = (size + n_threads - 1) / n_threads;
+  if (config.schedule == parallel_schedule::dynamic_chunks) {
+    // Several chunks per thread to balance load:
+    chunk = (chunk + 7) / 8;
+  }
+  return std::max(chunk, parallel_min_chunk_size);
+}
+
+/**
+ * Calls \c body(first, last) for chunks [first, last) partitioning the
+ * range [0, size), on the threads specified in \c config if OpenMP is
+ * enabled. Chunks are processed concurrently and in unspecified order.
+ */
+template <class BodyT>
+void parallel_for(
+  std::ptrdiff_t          size,
+  const parallel_config & config,
+  BodyT                && body)
+{
+  if (size <= 0) {
+    return;
+  }
+#ifdef DASH_ENABLE_OPENMP
+  int n_threads = parallel_num_threads(config);
+  if (n_threads > 1) {
+    std::ptrdiff_t chunk    = parallel_chunk_size(size, n_threads, config);
+    std::ptrdiff_t n_chunks = (size + chunk - 1) / chunk;
+    if (n_chunks > 1) {
+      n_threads = static_cast<int>(std::min<std::ptrdiff_t>(n_threads,
+                                                            n_chunks));
+      DASH_LOG_TRACE("dash::internal::parallel_for", "threads:", n_threads,
+                     "chunks:", n_chunks, "chunk size:", chunk);
+      if (config.schedule == parallel_schedule::dynamic_chunks) {
+        #pragma omp parallel for num_threads(n_threads) schedule(dynamic, 1)
+        for (std::ptrdiff_t c = 0; c < n_chunks; ++c) {
+          body(c * chunk, std::min(size, (c + 1) * chunk));
+        }
+      } else {
+        #pragma omp parallel for num_threads(n_threads) schedule(static, 1)
+        for (std::ptrdiff_t c = 0; c < n_chunks; ++c) {
+          body(c * chunk, std::min(size, (c + 1) * chunk));
+        }
+      }
+      return;
+    }
+  }
+#else
+  (void)(config);
+#endif // DASH_ENABLE_OPENMP
+  body(0, size);
+}
+
+/**
+ * Calls \c func(i) for every index in the chunk [first, last), as SIMD
+ * loop if \c config allows unsequenced execution and OpenMP is enabled.
+ */
+template <class FuncT>
+inline void parallel_chunk_loop(
+  std::ptrdiff_t          first,
+  std::ptrdiff_t          last,
+  const parallel_config & config,
+  FuncT                && func)
+{
+#ifdef DASH_ENABLE_OPENMP
+  if (config.unsequenced) {
+    #pragma omp simd
+    for (std::ptrdiff_t i = first; i < last; ++i) {
+      func(i);
+    }
+    return;
+  }
+#else
+  (void)(config);
+#endif // DASH_ENABLE_OPENMP
+  for (std::ptrdiff_t i = first; i < last; ++i) {
+    func(i);
+  }
+}
+
+/**
+ * Finds the smallest index in [0, size) for which \c find_chunk succeeds.
+ *
+ * \c find_chunk(first, last) returns the smallest matching index in
+ * [first, last) or \c last if there is none. Chunks are taken by the
+ * threads in ascending order, chunks following a match that has already
+ * been found are skipped.
+ *
+ * \returns  The smallest matching index, or \c size if there is none.
+ */
+template <class FindT>
+std::ptrdiff_t parallel_find(
+  std::ptrdiff_t          size,
+  const parallel_config & config,
+  FindT                && find_chunk)
+{
+  if (size <= 0) {
+    return size;
+  }
+#ifdef DASH_ENABLE_OPENMP
+  int n_threads = parallel_num_threads(config);
+  if (n_threads > 1) {
+    // Small chunks so threads stop soon after a match:
+    parallel_config chunk_config(config.num_threads, config.chunk_size,
+                                 parallel_schedule::dynamic_chunks);
+    std::ptrdiff_t chunk    = parallel_chunk_size(size, n_threads,
+                                                  chunk_config);
+    std::ptrdiff_t n_chunks = (size + chunk - 1) / chunk;
+    if (n_chunks > 1) {
+      n_threads = static_cast<int>(std::min<std::ptrdiff_t>(n_threads,
+                                                            n_chunks));
+      std::atomic<std::ptrdiff_t> found(size);
+      #pragma omp parallel for num_threads(n_threads) schedule(dynamic, 1)
+      for (std::ptrdiff_t c = 0; c < n_chunks; ++c) {
+        std::ptrdiff_t first = c * chunk;
+        if (first >= found.load(std::memory_order_relaxed)) {
+          continue;
+        }
+        std::ptrdiff_t last  = std::min(size, first + chunk);
+        std::ptrdiff_t match = find_chunk(first, last);
+        if (match == last) {
+          continue;
+        }
+        std::ptrdiff_t prev = found.load(std::memory_order_relaxed);
+        while (match < prev &&
+               !found.compare_exchange_weak(prev, match,
+                                            std::memory_order_relaxed)) { }
+      }
+      return found.load();
+    }
+  }
+#else
+  (void)(config);
+#endif // DASH_ENABLE_OPENMP
+  return find_chunk(0, size);
+}
+
+/**
+ * Reduces the range [0, size) to a single result.
+ *
+ * \c reduce_chunk(first, last) returns the result of the non-empty chunk
+ * [first, last). Results of chunks are combined in ascending order of
+ * chunks by \c combine(lhs, rhs), which must be associative.
+ *
+ * \returns  \c false if the range is empty, in which case \c result is
+ *           not modified.
+ */
+template <
+  class ResultT,
+  class ReduceT,
+  class CombineT >
+bool parallel_reduce(
+  std::ptrdiff_t          size,
+  const parallel_config & config,
+  ReduceT              && reduce_chunk,
+  CombineT             && combine,
+  ResultT               & result)
+{
+  if (size <= 0) {
+    return false;
+  }
+#ifdef DASH_ENABLE_OPENMP
+  int n_threads = parallel_num_threads(config);
+  if (n_threads > 1) {
+    std::ptrdiff_t chunk    = parallel_chunk_size(size, n_threads, config);
+    std::ptrdiff_t n_chunks = (size + chunk - 1) / chunk;
+    if (n_chunks > 1) {
+      // Every chunk result is written once, false sharing is negligible:
+      std::vector<ResultT> chunk_results(n_chunks);
+      parallel_for(
+        size, parallel_config(n_threads, chunk, config.schedule),
+        [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+          chunk_results[first / chunk] = reduce_chunk(first, last);
+        });
+      ResultT acc = chunk_results[0];
+      for (std::ptrdiff_t c = 1; c < n_chunks; ++c) {
+        acc = combine(acc, chunk_results[c]);
+      }
+      result = acc;
+      return true;
+    }
+  }
+#else
+  (void)(config);
+  (void)(combine);
+#endif // DASH_ENABLE_OPENMP
+  result = reduce_chunk(0, size);
+  return true;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
@@ -3,7 +3,11 @@
 
 #include <dash/Types.h>
 #include <dash/GlobPtr.h>
+#include <dash/Future.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/atomic/internal/AsyncOps.h>
+
+#include <memory>
 
 
 namespace dash {
@@ -312,6 +316,116 @@ public:
     return fetch_op(dash::plus<T>(), -value);
   }
 
+  /**
+   * Non-blocking variant of \c op.
+   * The operation remains in flight after returning and is guaranteed to
+   * be completed at the target after \c flush.
+   */
+  template<typename BinaryOp>
+  void op_async(
+    BinaryOp  binary_op,
+    /// Value to be added to global atomic variable.
+    const T & value) const
+  {
+    DASH_LOG_DEBUG_VAR("GlobRef<Atomic>.op_async()", value);
+    DASH_LOG_TRACE_VAR("GlobRef<Atomic>.op_async",   _gptr);
+    // Operand buffer is kept until local completion of the operation:
+    dash::internal::AsyncOps::get().start(
+      value,
+      [&](const T * operand, dart_handle_t * handle) {
+        return dart_accumulate_handle(
+                 _gptr,
+                 operand,
+                 1,
+                 dash::dart_punned_datatype<T>::value,
+                 binary_op.dart_operation(),
+                 handle);
+      });
+    DASH_LOG_DEBUG("GlobRef<Atomic>.op_async >");
+  }
+
+  /**
+   * Non-blocking atomic fetch-and-op operation on the referenced shared
+   * value.
+   *
+   * \return  A future providing the value of the referenced shared
+   *          variable before the operation.
+   */
+  template<typename BinaryOp>
+  dash::Future<T> fetch_op_async(
+    BinaryOp  binary_op,
+    /// Value to be added to global atomic variable.
+    const T & value) const
+  {
+    DASH_LOG_DEBUG_VAR("GlobRef<Atomic>.fetch_op_async()", value);
+    DASH_LOG_TRACE_VAR("GlobRef<Atomic>.fetch_op_async",   _gptr);
+    // Operand and result buffers of the pending operation, released after
+    // local completion when the last copy of the future is destroyed:
+    struct fetch_op_state {
+      value_type    value;
+      value_type    result;
+      dart_handle_t handle = DART_HANDLE_NULL;
+
+      ~fetch_op_state() {
+        dart_wait_local(&handle);
+      }
+    };
+    auto state   = std::make_shared<fetch_op_state>();
+    state->value = value;
+    dart_ret_t ret = dart_fetch_and_op_handle(
+                       _gptr,
+                       reinterpret_cast<const void * const>(&state->value),
+                       reinterpret_cast<void * const>(&state->result),
+                       dash::dart_punned_datatype<T>::value,
+                       binary_op.dart_operation(),
+                       &state->handle);
+    DASH_ASSERT_EQ(DART_OK, ret, "dart_fetch_and_op_handle failed");
+    return dash::Future<T>([state]() {
+      DASH_ASSERT_RETURNS(
+        dart_wait(&state->handle),
+        DART_OK);
+      return state->result;
+    });
+  }
+
+  /**
+   * Non-blocking variant of \c add.
+   * The operation remains in flight after returning and is guaranteed to
+   * be completed at the target after \c flush.
+   */
+  void add_async(const T & value) const
+  {
+    op_async(dash::plus<T>(), value);
+  }
+
+  /**
+   * Non-blocking atomic fetch-and-add operation on the referenced shared
+   * value.
+   *
+   * \return  A future providing the value of the referenced shared
+   *          variable before the operation.
+   */
+  dash::Future<T> fetch_add_async(
+    /// Value to be added to global atomic variable.
+    const T & value) const
+  {
+    return fetch_op_async(dash::plus<T>(), value);
+  }
+
+  /**
+   * Block until completion of all non-blocking operations on the
+   * referenced shared value issued by the calling unit.
+   * Also completes pending operations of the calling thread on other
+   * shared values locally.
+   */
+  void flush() const
+  {
+    dash::internal::AsyncOps::get().wait_local();
+    DASH_ASSERT_RETURNS(
+      dart_flush(_gptr),
+      DART_OK);
+  }
+
   /// prefix atomically increment value by one
   T operator++ () const {
     return fetch_add(1) + 1;
@@ -167,7 +167,41 @@ fetch_sub(
 {
   return ref.fetch_sub(value);
 }
-  
+
+/**
+ * Non-blocking atomic add operation on the referenced shared value,
+ * completed at the target after \c flush on the reference.
+ */
+template<typename T>
+typename std::enable_if<
+  std::is_integral<T>::value,
+  void>::type
+add_async(
+  const dash::GlobRef<dash::Atomic<T>> & ref,
+  const T & value)
+{
+  ref.add_async(value);
+}
+
+/**
+ * Non-blocking atomic fetch-and-add operation on the referenced shared
+ * value.
+ *
+ * \return  A future providing the value of the referenced shared
+ *          variable before the operation.
+ */
+template<typename T>
+typename std::enable_if<
+  std::is_integral<T>::value,
+  dash::Future<T>>::type
+fetch_add_async(
+  const dash::GlobRef<dash::Atomic<T>> & ref,
+  /// Value to be added to global atomic variable.
+  const T & value)
+{
+  return ref.fetch_add_async(value);
+}
+
 } // namespace atomic
 } // namespace dash
 
@@ -0,0 +1,117 @@
+#ifndef DASH__ATOMIC__INTERNAL__ASYNC_OPS_H__INCLUDED
+#define DASH__ATOMIC__INTERNAL__ASYNC_OPS_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace dash {
+namespace internal {
+
+/**
+ * Operand buffers and DART handles of non-blocking atomic operations
+ * issued by the calling thread that have not been completed yet.
+ *
+ * Operations remain in flight until they are flushed or until
+ * \c Capacity operations are pending, at which point all pending
+ * operations are completed locally as a batch.
+ * Remote completion is established by \c dart_flush on the targets.
+ */
+class AsyncOps
+{
+public:
+  /// Maximum size of an operand in bytes.
+  static const size_t MaxOperandSize = 16;
+  /// Maximum number of operations in flight.
+  static const size_t Capacity       = 1024;
+
+private:
+  typedef typename std::aligned_storage<MaxOperandSize>::type operand_t;
+
+public:
+  /**
+   * Pending operations issued by the calling thread.
+   */
+  static AsyncOps & get()
+  {
+    static thread_local AsyncOps ops;
+    return ops;
+  }
+
+  AsyncOps(const AsyncOps & other)            = delete;
+  AsyncOps & operator=(const AsyncOps & other) = delete;
+
+  /**
+   * Copies the operand into a buffer that is valid until local completion
+   * and starts the operation with \c start_op, called with a pointer to
+   * the operand buffer and the handle of the operation.
+   */
+  template<typename T, typename StartOp>
+  void start(const T & operand, StartOp start_op)
+  {
+    static_assert(sizeof(T) <= MaxOperandSize,
+                  "dash::internal::AsyncOps: operand size exceeds "
+                  "MaxOperandSize");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "dash::internal::AsyncOps: operand type must be "
+                  "trivially copyable");
+    if (_handles.size() == Capacity) {
+      DASH_LOG_TRACE("AsyncOps.start", "capacity reached");
+      wait_local();
+    }
+    T * buf = new (&_operands[_handles.size()]) T(operand);
+    dart_handle_t handle = DART_HANDLE_NULL;
+    DASH_ASSERT_RETURNS(
+      start_op(static_cast<const T *>(buf), &handle),
+      DART_OK);
+    _handles.push_back(handle);
+  }
+
+  /**
+   * Blocks until local completion of all pending operations and releases
+   * their operand buffers.
+   */
+  void wait_local()
+  {
+    DASH_LOG_TRACE("AsyncOps.wait_local()", "pending:", _handles.size());
+    if (_handles.empty()) {
+      return;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_waitall_local(_handles.data(), _handles.size()),
+      DART_OK);
+    _handles.clear();
+  }
+
+  /**
+   * Number of pending operations.
+   */
+  inline size_t size() const noexcept
+  {
+    return _handles.size();
+  }
+
+private:
+  AsyncOps()
+  : _operands(Capacity)
+  {
+    _handles.reserve(Capacity);
+  }
+
+private:
+  /// Operand buffers of pending operations, by position in \c _handles.
+  std::vector<operand_t>     _operands;
+  /// Handles of pending operations.
+  std::vector<dart_handle_t> _handles;
+
+}; // class AsyncOps
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ATOMIC__INTERNAL__ASYNC_OPS_H__INCLUDED
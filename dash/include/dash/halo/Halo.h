@@ -305,6 +305,54 @@ public:
     }
   }
 
+  /**
+   * Creates halo regions \c depth times as wide as the reach of the given
+   * stencils, so \c depth stencil sweeps can be computed after a single
+   * halo update. Elements in halo regions are then updated redundantly and
+   * depend on their neighbors in all directions, so for \c depth > 1 all
+   * regions combining directions reached by the stencils are created with
+   * the same extent.
+   */
+  template <typename StencilSpecT>
+  HaloSpec(const StencilSpecT& stencil_specs, region_extent_t depth)
+  : HaloSpec(stencil_specs) {
+    _depth = depth;
+    if(depth <= 1)
+      return;
+
+    std::array<std::pair<bool, bool>, NumDimensions> reach{};
+    region_extent_t                                   max_reach = 0;
+    for(const auto& stencil : stencil_specs.specs()) {
+      for(auto d = 0; d < NumDimensions; ++d) {
+        if(stencil[d] < 0)
+          reach[d].first = true;
+        else if(stencil[d] > 0)
+          reach[d].second = true;
+      }
+      max_reach = std::max<region_extent_t>(max_reach, stencil.max());
+    }
+
+    _specs       = Specs_t{};
+    _num_regions = 0;
+    for(region_index_t index = 0; index < RegionCoords_t::MaxIndex; ++index) {
+      RegionCoords_t coords(index);
+      bool           center = true;
+      bool           valid  = true;
+      for(auto d = 0; d < NumDimensions; ++d) {
+        if(coords[d] != 1)
+          center = false;
+        if((coords[d] == 0 && !reach[d].first)
+           || (coords[d] == 2 && !reach[d].second))
+          valid = false;
+      }
+      if(center || !valid)
+        continue;
+
+      _specs[index] = RegionSpec_t(index, max_reach * depth);
+      ++_num_regions;
+    }
+  }
+
   template <typename... ARGS>
   HaloSpec(const ARGS&... args) {
     std::array<RegionSpec_t, sizeof...(ARGS)> tmp{ args... };
@@ -314,7 +362,11 @@ public:
     }
   }
 
-  HaloSpec(const Self_t& other) { _specs = other._specs; }
+  HaloSpec(const Self_t& other) {
+    _specs       = other._specs;
+    _num_regions = other._num_regions;
+    _depth       = other._depth;
+  }
 
   constexpr RegionSpec_t spec(const region_index_t index) const {
     return _specs[index];
@@ -326,6 +378,11 @@ public:
 
   constexpr region_size_t num_regions() const { return _num_regions; }
 
+  /**
+   * Number of stencil sweeps supported by one halo update.
+   */
+  constexpr region_extent_t depth() const { return _depth; }
+
   const Specs_t& specs() const { return _specs; }
 
 private:
@@ -354,8 +411,9 @@ private:
   }
 
 private:
-  Specs_t       _specs{};
-  region_size_t _num_regions{ 0 };
+  Specs_t         _specs{};
+  region_size_t   _num_regions{ 0 };
+  region_extent_t _depth{ 1 };
 };  // HaloSpec
 
 template <typename ElementT, typename PatternT,
@@ -747,7 +805,7 @@ public:
             const HaloSpec_t&  halo_reg_spec,
             const CycleSpec_t& cycle_spec = CycleSpec_t{})
   : _globmem(globmem), _pattern(pattern), _view(view),
-    _halo_reg_spec(halo_reg_spec) {
+    _halo_reg_spec(halo_reg_spec), _cycle_spec(cycle_spec) {
     _view_inner                 = view;
     _view_inner_with_boundaries = view;
 
@@ -882,6 +940,7 @@ public:
                        cycle_spec);
       }
     }
+    _halo_extents_max = halo_extents_max;
   }
 
   HaloBlock() = delete;
@@ -929,6 +988,49 @@ public:
     return _boundary_elements;
   }
 
+  /**
+   * Global view of the elements updated by a stencil sweep with
+   * \c num_sweeps sweeps remaining until the next halo update.
+   *
+   * For every halo region not set to fixed values, the block is extended
+   * into the halo by \c num_sweeps times the stencil reach, i.e. the halo
+   * extent divided by the halo depth. At global borders without halo
+   * regions, elements within the stencil reach are excluded.
+   */
+  ViewSpec_t view_sweep(region_extent_t num_sweeps) const {
+    pattern_index_t depth   = _halo_reg_spec.depth();
+    auto            offsets = _view.offsets();
+    auto            extents = _view.extents();
+    for(auto d = 0; d < NumDimensions; ++d) {
+      pattern_index_t view_offset = _view.offset(d);
+      pattern_index_t view_extent = _view.extent(d);
+      pattern_index_t reach_lower = _halo_extents_max[d].first / depth;
+      pattern_index_t reach_upper = _halo_extents_max[d].second / depth;
+
+      // extension at the lower and upper side, negative values shrink
+      pattern_index_t ext_lower = num_sweeps * reach_lower;
+      pattern_index_t ext_upper = num_sweeps * reach_upper;
+      if(view_offset < _halo_extents_max[d].first) {
+        if(_cycle_spec[d] == Cycle::NONE)
+          ext_lower = -reach_lower;
+        else if(_cycle_spec[d] == Cycle::FIXED)
+          ext_lower = 0;
+      }
+      if(view_offset + view_extent + _halo_extents_max[d].second
+         > static_cast<pattern_index_t>(_pattern.extent(d))) {
+        if(_cycle_spec[d] == Cycle::NONE)
+          ext_upper = -reach_upper;
+        else if(_cycle_spec[d] == Cycle::FIXED)
+          ext_upper = 0;
+      }
+      offsets[d] -= ext_lower;
+      extents[d] = std::max<pattern_index_t>(
+        view_extent + ext_lower + ext_upper, 0);
+    }
+
+    return ViewSpec_t(offsets, extents);
+  }
+
   pattern_size_t halo_size() const { return _size_halo_elems; }
 
   pattern_size_t boundary_size() const { return _size_bnd_elems; }
@@ -994,6 +1096,10 @@ private:
 
   const HaloSpec_t& _halo_reg_spec;
 
+  CycleSpec_t _cycle_spec;
+
+  HaloExtsMax_t _halo_extents_max{};
+
   ViewSpec_t _view_inner_with_boundaries;
 
   ViewSpec_t _view_inner;
@@ -1032,23 +1138,54 @@ public:
   using region_index_t = typename RegionCoords_t::region_index_t;
   using pattern_size_t = typename Pattern_t::size_type;
 
+  using RegionStrides_t = std::array<pattern_size_t, NumDimensions>;
+
 public:
-  HaloMemory(const HaloBlockT& haloblock) : _haloblock(haloblock) {
-    _halobuffer.resize(haloblock.halo_size());
-    auto* offset = _halobuffer.data();
+  /**
+   * Creates the halo memory for all halo regions of the given \c HaloBlock.
+   * Halo regions are stored in \c buffer if specified, which must provide
+   * space for \c haloblock.halo_size() elements, or in a buffer owned by
+   * the halo memory otherwise.
+   */
+  HaloMemory(const HaloBlockT& haloblock, Element_t* buffer = nullptr)
+  : _haloblock(haloblock) {
+    if(buffer == nullptr) {
+      _halobuffer.resize(haloblock.halo_size());
+      buffer = _halobuffer.data();
+    }
+    _buffer = buffer;
 
+    auto* offset = _buffer;
     for(const auto& region : haloblock.halo_regions()) {
       _halo_offsets[region.index()] = offset;
+      _halo_strides[region.index()] = strides(region.region().extents());
       offset += region.size();
     }
   }
 
   Element_t* pos_at(region_index_t index) { return _halo_offsets[index]; }
 
-  Element_t* pos_start() { return _halobuffer.data(); }
+  Element_t* pos_start() { return _buffer; }
 
+  /**
+   * Buffer owned by the halo memory, empty if halo regions are stored in an
+   * external buffer.
+   */
   const std::vector<Element_t>& buffer() const { return _halobuffer; }
 
+  /**
+   * Reads the halo region with the given index in place at \c pos instead
+   * of the halo buffer, e.g. from memory of a unit on the same node.
+   * \c block_extents are the extents of the local memory block containing
+   * the region.
+   */
+  template <typename ExtentsT>
+  void set_region_pos(region_index_t index, Element_t* pos,
+                      const ExtentsT& block_extents) {
+    _halo_offsets[index] = pos;
+    _halo_strides[index] = strides(block_extents);
+  }
+
   bool to_halo_mem_coords_check(const region_index_t region_index,
                                 ElementCoords_t&     coords) {
     const auto& extents =
@@ -1083,26 +1220,37 @@ public:
 
   pattern_size_t value_at(const region_index_t   region_index,
                           const ElementCoords_t& coords) {
-    const auto& extents =
-      _haloblock.halo_region(region_index)->region().extents();
-    pattern_size_t off = 0;
+    const auto&    strides = _halo_strides[region_index];
+    pattern_size_t off     = 0;
+    for(auto d = 0; d < NumDimensions; ++d)
+      off += coords[d] * strides[d];
+
+    return off;
+  }
+
+private:
+  template <typename ExtentsT>
+  static RegionStrides_t strides(const ExtentsT& extents) {
+    RegionStrides_t strides;
     if(MemoryArrange == ROW_MAJOR) {
-      off = coords[0];
-      for(auto d = 1; d < NumDimensions; ++d)
-        off = off * extents[d] + coords[d];
+      strides[NumDimensions - 1] = 1;
+      for(auto d = NumDimensions - 1; d > 0; --d)
+        strides[d - 1] = strides[d] * extents[d];
     } else {
-      off = coords[NumDimensions - 1];
-      for(auto d = NumDimensions - 2; d >= 0; --d)
-        off = off * extents[d] + coords[d];
+      strides[0] = 1;
+      for(auto d = 1; d < NumDimensions; ++d)
+        strides[d] = strides[d - 1] * extents[d - 1];
     }
 
-    return off;
+    return strides;
   }
 
 private:
-  const HaloBlockT&                _haloblock;
-  std::vector<Element_t>           _halobuffer;
-  std::array<Element_t*, MaxIndex> _halo_offsets{};
+  const HaloBlockT&                     _haloblock;
+  std::vector<Element_t>                _halobuffer;
+  Element_t*                            _buffer;
+  std::array<Element_t*, MaxIndex>      _halo_offsets{};
+  std::array<RegionStrides_t, MaxIndex> _halo_strides{};
 };  // class HaloMemory
 
 }  // namespace dash
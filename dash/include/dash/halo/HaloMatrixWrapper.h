@@ -3,6 +3,7 @@
 
 #include <dash/dart/if/dart.h>
 
+#include <dash/Exception.h>
 #include <dash/Matrix.h>
 #include <dash/Pattern.h>
 #include <dash/memory/GlobStaticMem.h>
@@ -14,6 +15,20 @@
 
 namespace dash {
 
+/**
+ * Specifies how \c HaloMatrixWrapper updates halo regions.
+ */
+enum class HaloUpdateMode : uint8_t {
+  /// Every unit gets its halo regions from the units owning them
+  GET,
+  /// Like GET, but halo regions owned by units that share memory with the
+  /// calling unit are read in place instead of being copied
+  SHARED,
+  /// Owners put their boundary elements into the halo buffers of their
+  /// neighbors and notify them per region
+  PUSH
+};
+
 template <typename MatrixT, typename StencilSpecT>
 class HaloMatrixWrapper {
 private:
@@ -34,6 +49,8 @@ public:
   using iterator_bnd = HaloMatrixIterator<Element_t, Pattern_t, StencilSpecT,
                                           StencilViewScope::BOUNDARY>;
   using const_iterator_bnd = const iterator_bnd;
+  using iterator_sweep = HaloMatrixIterator<Element_t, Pattern_t, StencilSpecT,
+                                            StencilViewScope::SWEEP>;
 
   using ViewSpec_t      = ViewSpec<NumDimensions, pattern_index_t>;
   using CycleSpec_t     = CycleSpec<NumDimensions>;
@@ -41,6 +58,7 @@ public:
   using HaloMemory_t    = HaloMemory<HaloBlock_t>;
   using ElementCoords_t = std::array<pattern_index_t, NumDimensions>;
   using region_index_t  = typename RegionCoords<NumDimensions>::region_index_t;
+  using region_extent_t = typename HaloSpec<NumDimensions>::region_extent_t;
 
 private:
   static constexpr auto MemoryArrange = Pattern_t::memory_order();
@@ -48,16 +66,34 @@ private:
   using pattern_size_t = typename Pattern_t::size_type;
   using HaloSpec_t     = HaloSpec<NumDimensions>;
   using Region_t       = Region<Element_t, Pattern_t, NumDimensions>;
+  using RegionCoords_t = RegionCoords<NumDimensions>;
 
 public:
+  /**
+   * Creates halo regions for the local block of \c matrix as required by
+   * \c stencil_spec.
+   *
+   * In mode \c HaloUpdateMode::PUSH, halo buffers are allocated in global
+   * memory, so construction and destruction are collective operations on
+   * the team of the matrix.
+   *
+   * With \c halo_depth > 1, halo regions are \c halo_depth times as wide
+   * as the stencil reach, see \c sbegin. Halo regions must not be wider
+   * than the local blocks of the neighbors then, and cannot be read in
+   * place in mode \c HaloUpdateMode::SHARED.
+   */
   HaloMatrixWrapper(MatrixT& matrix, const StencilSpecT& stencil_spec,
-                    const CycleSpec_t& cycle_spec = CycleSpec_t())
+                    const CycleSpec_t& cycle_spec = CycleSpec_t(),
+                    HaloUpdateMode     mode       = HaloUpdateMode::GET,
+                    region_extent_t    halo_depth = 1)
   : _matrix(matrix), _stencil_spec(stencil_spec), _cycle_spec(cycle_spec),
-    _halo_reg_spec(stencil_spec), _view_local(matrix.local.extents()),
+    _mode(mode), _halo_reg_spec(stencil_spec, halo_depth),
+    _view_local(matrix.local.extents()),
     _view_global(ViewSpec_t(matrix.local.offsets(), matrix.local.extents())),
     _haloblock(matrix.begin().globmem(), matrix.pattern(), _view_global,
                _halo_reg_spec, cycle_spec),
-    _halomemory(_haloblock), _begin(_haloblock, _halomemory, _stencil_spec, 0),
+    _halomemory(_haloblock, alloc_push_memory()),
+    _begin(_haloblock, _halomemory, _stencil_spec, 0),
     _end(_haloblock, _halomemory, _stencil_spec,
          _haloblock.view_inner_with_boundaries().size()),
     _ibegin(_haloblock, _halomemory, _stencil_spec, 0),
@@ -221,6 +257,12 @@ public:
         num_elems_block = region.region().extent(0);
       }
     }
+
+    if(_mode == HaloUpdateMode::SHARED)
+      init_shared_regions();
+
+    if(_mode == HaloUpdateMode::PUSH)
+      init_push_regions();
   }
 
   ~HaloMatrixWrapper() {
@@ -228,6 +270,14 @@ public:
       dart_type_destroy(&dart_type);
     }
     _dart_types.clear();
+
+    if(_mode == HaloUpdateMode::PUSH) {
+      complete_push();
+      // Neighbors may still put to the halo buffers of this unit
+      _matrix.team().barrier();
+      dart_team_memfree(_notify_gptr);
+      dart_team_memfree(_push_gptr);
+    }
   }
 
   iterator begin() noexcept { return _begin; }
@@ -254,35 +304,144 @@ public:
 
   const_iterator_bnd bend() const noexcept { return _bend; }
 
+  /**
+   * Iterator to the first element updated in stencil sweep \c sweep, with
+   * 0 <= \c sweep < \c halo_depth(), after a halo update.
+   *
+   * Sweeps alternate between the halo wrappers of an input and an output
+   * matrix with equal halo depth. Before the last sweep, elements in halo
+   * regions are updated redundantly, so the iterated view shrinks with
+   * every sweep until it covers the local block. Dereferencing the iterator
+   * refers to the element in the local block or in the halo memory.
+   *
+   * \see StencilOperator::apply_sweeps
+   */
+  iterator_sweep sbegin(region_extent_t sweep) {
+    return iterator_sweep(_haloblock, _halomemory, _stencil_spec,
+                          sweep_view(sweep), 0);
+  }
+
+  /**
+   * Iterator past the last element updated in stencil sweep \c sweep.
+   */
+  iterator_sweep send(region_extent_t sweep) {
+    auto view = sweep_view(sweep);
+    return iterator_sweep(_haloblock, _halomemory, _stencil_spec, view,
+                          view.size());
+  }
+
   const HaloBlock_t& halo_block() { return _haloblock; }
 
+  /**
+   * Number of stencil sweeps supported by one halo update.
+   */
+  region_extent_t halo_depth() const { return _halo_reg_spec.depth(); }
+
+  /**
+   * Updates all halo regions.
+   *
+   * In mode \c HaloUpdateMode::PUSH, the halo regions of neighbors are
+   * updated with the boundary elements of the calling unit, so all units
+   * in the team have to call \c update or \c update_async. Neighbors must
+   * not read their halo regions from the previous update anymore, e.g.
+   * after a barrier.
+   */
   void update() {
+    if(_mode == HaloUpdateMode::PUSH) {
+      push_intern();
+      wait();
+      return;
+    }
     for(auto& region : _region_data)
       update_halo_intern(region.second, false);
   }
 
+  /**
+   * Updates the halo region with the given index.
+   * Not supported in mode \c HaloUpdateMode::PUSH.
+   */
   void update_at(region_index_t index) {
+    check_not_push("update_at");
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end())
       update_halo_intern(it_find->second, false);
   }
 
+  /**
+   * Starts the update of all halo regions, see \c update.
+   */
   void update_async() {
+    if(_mode == HaloUpdateMode::PUSH) {
+      push_intern();
+      return;
+    }
     for(auto& region : _region_data)
       update_halo_intern(region.second, true);
   }
 
+  /**
+   * Starts the update of the halo region with the given index.
+   * Not supported in mode \c HaloUpdateMode::PUSH.
+   */
   void update_async_at(region_index_t index) {
+    check_not_push("update_async_at");
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end())
       update_halo_intern(it_find->second, true);
   }
 
   void wait() {
+    if(_mode == HaloUpdateMode::PUSH) {
+      complete_push();
+      for(auto& region : _region_data)
+        wait_at(region.first);
+      return;
+    }
     for(auto& region : _region_data)
       dart_wait_local(&region.second.halo_data.handle);
   }
 
+  /**
+   * Waits until the halo update of the region with the given index is
+   * completed. Has no effect for regions without halo update.
+   */
+  void wait_at(region_index_t index) {
+    if(_mode == HaloUpdateMode::PUSH) {
+      while(!test_at(index)) {
+      }
+      return;
+    }
+    auto it_find = _region_data.find(index);
+    if(it_find != _region_data.end())
+      dart_wait_local(&it_find->second.halo_data.handle);
+  }
+
+  /**
+   * Tests whether the halo update of the region with the given index is
+   * completed, does not block.
+   * Returns \c true for regions without halo update.
+   */
+  bool test_at(region_index_t index) {
+    auto it_find = _region_data.find(index);
+    if(it_find == _region_data.end())
+      return true;
+
+    if(_mode == HaloUpdateMode::PUSH) {
+      complete_push();
+      if(is_fixed_region(it_find->second.region))
+        return true;
+
+      return notify_count(index) >= _push_epoch;
+    }
+
+    int32_t finished = 0;
+    dart_test_local(&it_find->second.halo_data.handle, &finished);
+
+    return finished != 0;
+  }
+
+  HaloUpdateMode mode() const { return _mode; }
+
   const ViewSpec_t& view_local() const { return _view_local; }
 
   const StencilSpecT& stencil_spec() const { return _stencil_spec; }
@@ -352,6 +511,8 @@ public:
 private:
   struct HaloData {
     dart_handle_t       handle = DART_HANDLE_NULL;
+    /// Whether the halo region is read in place from the owning unit
+    bool                in_place = false;
   };
 
   struct Data {
@@ -360,29 +521,380 @@ private:
     HaloData                       halo_data;
   };
 
+  /// Description of a halo region owned by another unit, exchanged in
+  /// mode HaloUpdateMode::PUSH
+  struct PushRegionInfo {
+    /// Unit owning the region, -1 if the region is not pushed
+    dart_unit_t                              unit;
+    /// Local index of the first region element at the owning unit
+    pattern_index_t                          offset;
+    /// Offset of the region in the halo buffer of the receiving unit
+    pattern_index_t                          buffer_offset;
+    std::array<pattern_size_t, NumDimensions> extents;
+  };
+
+  /// Put of boundary elements to the halo buffer of a neighbor
+  struct PushData {
+    dart_gptr_t     dest;
+    dart_gptr_t     notify;
+    const Element_t* src;
+    size_t          nelem;
+    dart_datatype_t src_type;
+    dart_datatype_t dst_type;
+  };
+
+  using notify_t = long;
+
+  ViewSpec_t sweep_view(region_extent_t sweep) const {
+    DASH_ASSERT_LT(sweep, halo_depth(), "invalid stencil sweep");
+    return _haloblock.view_sweep(halo_depth() - 1 - sweep);
+  }
+
+  bool is_fixed_region(const Region_t& region) const {
+    auto rel_dim = region.spec().relevant_dim() - 1;
+    return region.is_border_region() && region.border_dim(rel_dim)
+           && _cycle_spec[rel_dim] == Cycle::FIXED;
+  }
+
+  void check_not_push(const char* fname) const {
+    if(_mode == HaloUpdateMode::PUSH) {
+      DASH_THROW(dash::exception::NotImplemented,
+                 "HaloMatrixWrapper." << fname << " is not supported in "
+                 "HaloUpdateMode::PUSH");
+    }
+  }
+
   void update_halo_intern(Data& data, bool async) {
-    auto rel_dim = data.region.spec().relevant_dim() - 1;
-    if(data.region.is_border_region() && data.region.border_dim(rel_dim)
-       && _cycle_spec[rel_dim] == Cycle::FIXED) {
+    if(is_fixed_region(data.region) || data.halo_data.in_place)
       return;
-    }
+
     data.get_halos(data.halo_data);
 
     if(!async)
       dart_wait_local(&data.halo_data.handle);
   }
 
+  /**
+   * Reads halo regions owned by units sharing memory with the calling unit
+   * in place.
+   */
+  void init_shared_regions() {
+    const auto& pattern = _matrix.pattern();
+    for(auto& region_data : _region_data) {
+      auto& data = region_data.second;
+      if(is_fixed_region(data.region))
+        continue;
+
+      auto  gptr = data.region.begin().dart_gptr();
+      void* addr = nullptr;
+      if(dart_gptr_getaddr_shared(gptr, &addr) != DART_OK || addr == nullptr)
+        continue;
+
+      _halomemory.set_region_pos(
+        region_data.first, static_cast<Element_t*>(addr),
+        pattern.local_extents(team_unit_t(gptr.unitid)));
+      data.halo_data.in_place = true;
+    }
+  }
+
+  /**
+   * Validates the halo depth, called before halo memory is allocated.
+   * In mode \c HaloUpdateMode::PUSH, units agree on the result so either
+   * all or no units throw before the collective allocation.
+   */
+  void check_halo_depth() const {
+    const auto halo_depth = _halo_reg_spec.depth();
+    if(halo_depth == 0) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "HaloMatrixWrapper: halo depth must be greater than 0");
+    }
+    if(halo_depth == 1) {
+      return;
+    }
+    if(_mode == HaloUpdateMode::SHARED) {
+      DASH_THROW(dash::exception::NotImplemented,
+                 "HaloMatrixWrapper: halo depth > 1 is not supported in "
+                 "HaloUpdateMode::SHARED");
+    }
+    int            lerror     = 0;
+    pattern_size_t err_extent = 0;
+    dim_t          err_dim    = 0;
+    for(const auto& spec : _halo_reg_spec.specs()) {
+      for(auto d = 0; d < NumDimensions; ++d) {
+        if(lerror == 0 && spec.extent() > 0 && spec[d] != 1
+           && spec.extent() > _view_local.extent(d)) {
+          lerror     = 1;
+          err_extent = spec.extent();
+          err_dim    = d;
+        }
+      }
+    }
+    int gerror = lerror;
+    if(_mode == HaloUpdateMode::PUSH) {
+      DASH_ASSERT_RETURNS(
+        dart_allreduce(&lerror, &gerror, 1, DART_TYPE_INT, DART_OP_MAX,
+                       _matrix.team().dart_id()),
+        DART_OK);
+    }
+    if(lerror != 0) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "HaloMatrixWrapper: halo extent " << err_extent
+                 << " exceeds local extent " << _view_local.extent(err_dim)
+                 << " in dimension " << err_dim);
+    }
+    if(gerror != 0) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "HaloMatrixWrapper: halo extent exceeds local extent of "
+                 "another unit");
+    }
+  }
+
+  /**
+   * Allocates halo buffers and notification counters in global memory in
+   * mode HaloUpdateMode::PUSH.
+   *
+   * \return  Local halo buffer, or \c nullptr in other modes.
+   */
+  Element_t* alloc_push_memory() {
+    check_halo_depth();
+    if(_mode != HaloUpdateMode::PUSH)
+      return nullptr;
+
+    auto&          team      = _matrix.team();
+    pattern_size_t halo_size = _haloblock.halo_size();
+    pattern_size_t max_size  = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&halo_size, &max_size, 1,
+                     dash::dart_datatype<pattern_size_t>::value, DART_OP_MAX,
+                     team.dart_id()),
+      DART_OK);
+
+    auto ds_buffer = dart_storage<Element_t>(std::max<pattern_size_t>(
+                                               max_size, 1));
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(team.dart_id(), ds_buffer.nelem,
+                                 ds_buffer.dtype, &_push_gptr),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(team.dart_id(), RegionCoords_t::MaxIndex,
+                                 dash::dart_datatype<notify_t>::value,
+                                 &_notify_gptr),
+      DART_OK);
+
+    void* addr = nullptr;
+    auto  gptr = _notify_gptr;
+    DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, team.myid()), DART_OK);
+    DASH_ASSERT_RETURNS(dart_gptr_getaddr(gptr, &addr), DART_OK);
+    std::fill_n(static_cast<notify_t*>(addr), RegionCoords_t::MaxIndex, 0);
+
+    gptr = _push_gptr;
+    DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, team.myid()), DART_OK);
+    DASH_ASSERT_RETURNS(dart_gptr_getaddr(gptr, &addr), DART_OK);
+
+    return static_cast<Element_t*>(addr);
+  }
+
+  /**
+   * Exchanges the location of halo regions between all units and creates
+   * the puts of boundary elements of the calling unit to the halo buffers
+   * of its neighbors.
+   */
+  void init_push_regions() {
+    auto& team = _matrix.team();
+
+    std::vector<PushRegionInfo> infos(RegionCoords_t::MaxIndex);
+    for(auto& info : infos)
+      info.unit = -1;
+
+    for(const auto& region_data : _region_data) {
+      const auto& region = region_data.second.region;
+      if(is_fixed_region(region))
+        continue;
+
+      auto  it    = region.begin();
+      auto& info  = infos[region_data.first];
+      info.unit   = it.dart_gptr().unitid;
+      info.offset = it.lpos().index;
+      info.buffer_offset =
+        _halomemory.pos_at(region_data.first) - _halomemory.pos_start();
+      info.extents = region.region().extents();
+    }
+
+    std::vector<PushRegionInfo> all_infos(infos.size() * team.size());
+    DASH_ASSERT_RETURNS(
+      dart_allgather(infos.data(), all_infos.data(),
+                     infos.size() * sizeof(PushRegionInfo), DART_TYPE_BYTE,
+                     team.dart_id()),
+      DART_OK);
+
+    const auto& local_extents = _matrix.pattern().local_extents();
+    for(std::size_t i = 0; i < all_infos.size(); ++i) {
+      const auto& info = all_infos[i];
+      if(info.unit != team.myid().id)
+        continue;
+
+      team_unit_t    dest_unit(i / RegionCoords_t::MaxIndex);
+      region_index_t index = i % RegionCoords_t::MaxIndex;
+
+      PushData push;
+      push.dest = _push_gptr;
+      DASH_ASSERT_RETURNS(dart_gptr_setunit(&push.dest, dest_unit), DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&push.dest,
+                          info.buffer_offset * sizeof(Element_t)),
+        DART_OK);
+      push.notify = _notify_gptr;
+      DASH_ASSERT_RETURNS(dart_gptr_setunit(&push.notify, dest_unit),
+                          DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&push.notify, index * sizeof(notify_t)), DART_OK);
+      push.src = _matrix.lbegin() + info.offset;
+
+      // Contiguous blocks of the region in local memory
+      pattern_size_t region_size = 1;
+      for(auto d = 0; d < NumDimensions; ++d)
+        region_size *= info.extents[d];
+
+      dim_t block_dim = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+      pattern_size_t block_size = info.extents[block_dim];
+      std::vector<size_t> block_offsets;
+      std::array<pattern_size_t, NumDimensions> coords{};
+      for(pattern_size_t b = 0; b < region_size / block_size; ++b) {
+        pattern_size_t offset = 0;
+        if(MemoryArrange == ROW_MAJOR) {
+          for(auto d = 0; d < NumDimensions; ++d)
+            offset = offset * local_extents[d] + coords[d];
+        } else {
+          for(auto d = NumDimensions - 1; d >= 0; --d)
+            offset = offset * local_extents[d] + coords[d];
+        }
+        block_offsets.push_back(offset);
+        // Next block in memory order
+        if(MemoryArrange == ROW_MAJOR) {
+          for(auto d = NumDimensions - 2; d >= 0; --d) {
+            if(++coords[d] < info.extents[d])
+              break;
+            coords[d] = 0;
+          }
+        } else {
+          for(auto d = 1; d < NumDimensions; ++d) {
+            if(++coords[d] < info.extents[d])
+              break;
+            coords[d] = 0;
+          }
+        }
+      }
+
+      auto ds_region = dart_storage<Element_t>(region_size);
+      push.nelem     = ds_region.nelem;
+      push.dst_type  = ds_region.dtype;
+      bool contiguous = true;
+      for(std::size_t b = 1; b < block_offsets.size(); ++b) {
+        if(block_offsets[b] != block_offsets[b - 1] + block_size)
+          contiguous = false;
+      }
+      if(contiguous) {
+        push.src_type = ds_region.dtype;
+      } else {
+        auto ds_block = dart_storage<Element_t>(block_size);
+        std::vector<size_t> block_sizes(block_offsets.size(), ds_block.nelem);
+        for(auto& offset : block_offsets)
+          offset = dart_storage<Element_t>(offset).nelem;
+        DASH_ASSERT_RETURNS(
+          dart_type_create_indexed(ds_block.dtype, block_offsets.size(),
+                                   block_sizes.data(), block_offsets.data(),
+                                   &push.src_type),
+          DART_OK);
+        _dart_types.push_back(push.src_type);
+      }
+      _push_data.push_back(push);
+    }
+
+    team.barrier();
+  }
+
+  /**
+   * Puts the boundary elements of the calling unit to the halo buffers of
+   * its neighbors. Neighbors are notified in \c complete_push.
+   */
+  void push_intern() {
+    complete_push();
+    ++_push_epoch;
+    for(const auto& push : _push_data) {
+      DASH_ASSERT_RETURNS(
+        dart_put(push.dest, push.src, push.nelem, push.src_type,
+                 push.dst_type),
+        DART_OK);
+    }
+    _push_pending = true;
+  }
+
+  /**
+   * Completes pending puts of boundary elements and notifies the
+   * neighbors.
+   */
+  void complete_push() {
+    if(!_push_pending)
+      return;
+
+    _push_pending = false;
+    if(_push_data.empty())
+      return;
+
+    // Puts have to be completed at the neighbors before notifying them
+    DASH_ASSERT_RETURNS(dart_flush_all(_push_gptr), DART_OK);
+    notify_t one = 1;
+    for(const auto& push : _push_data) {
+      DASH_ASSERT_RETURNS(
+        dart_accumulate(push.notify, &one, 1,
+                        dash::dart_datatype<notify_t>::value, DART_OP_SUM),
+        DART_OK);
+    }
+    DASH_ASSERT_RETURNS(dart_flush_all(_notify_gptr), DART_OK);
+  }
+
+  /**
+   * Number of updates of the halo region with the given index received
+   * from its owner.
+   */
+  notify_t notify_count(region_index_t index) {
+    auto gptr = _notify_gptr;
+    DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, _matrix.team().myid()),
+                        DART_OK);
+    DASH_ASSERT_RETURNS(dart_gptr_incaddr(&gptr, index * sizeof(notify_t)),
+                        DART_OK);
+    notify_t nothing = 0;
+    notify_t count   = 0;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(gptr, &nothing, &count,
+                        dash::dart_datatype<notify_t>::value,
+                        DART_OP_NO_OP),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush_local(gptr), DART_OK);
+
+    return count;
+  }
+
 private:
   MatrixT&                       _matrix;
   const StencilSpecT&            _stencil_spec;
   const CycleSpec_t              _cycle_spec;
+  const HaloUpdateMode           _mode;
   const HaloSpec_t               _halo_reg_spec;
   const ViewSpec_t               _view_local;
   const ViewSpec_t               _view_global;
   const HaloBlock_t              _haloblock;
+  /// Halo buffers of all units in mode HaloUpdateMode::PUSH
+  dart_gptr_t                    _push_gptr   = DART_GPTR_NULL;
+  /// Update counters per halo region of all units in mode
+  /// HaloUpdateMode::PUSH
+  dart_gptr_t                    _notify_gptr = DART_GPTR_NULL;
   HaloMemory_t                   _halomemory;
   std::map<region_index_t, Data> _region_data;
   std::vector<dart_datatype_t>   _dart_types;
+  std::vector<PushData>          _push_data;
+  notify_t                       _push_epoch   = 0;
+  bool                           _push_pending = false;
 
   iterator       _begin;
   iterator       _end;
@@ -0,0 +1,302 @@
+#ifndef DASH__HALO__STENCILOPERATOR_H
+#define DASH__HALO__STENCILOPERATOR_H
+
+#include <dash/halo/HaloMatrixWrapper.h>
+
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/Exception.h>
+#include <dash/util/UnitLocality.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace dash {
+
+/**
+ * Applies a stencil kernel to all local elements of a matrix wrapped in a
+ * \c HaloMatrixWrapper and overlaps the halo exchange with computation:
+ *
+ * 1. the halo updates of all regions are started asynchronously,
+ * 2. the kernel is applied to the inner elements, partitioned in
+ *    contiguous chunks on the threads available to the unit if OpenMP
+ *    is enabled,
+ * 3. every block of boundary elements is computed as soon as the halo
+ *    regions accessed by the stencil points in the block have arrived.
+ *
+ * Kernels are called with a reference to an inner or boundary iterator of
+ * the halo wrapper and store their result themselves, e.g. to
+ * \c lbegin()[it.lpos()] of the output matrix. The inner kernel is called
+ * concurrently by several threads.
+ *
+ * Example:
+ *
+ * \code
+ *   struct Laplace {
+ *     double* out;
+ *     template <typename IteratorT>
+ *     void operator()(IteratorT& it) const {
+ *       out[it.lpos()] = 0.25 * (it.value_at(0) + it.value_at(1) +
+ *                                it.value_at(2) + it.value_at(3));
+ *     }
+ *   };
+ *
+ *   dash::StencilOperator<HaloWrapper_t> op(halo_wrapper);
+ *   op.apply(Laplace{ matrix_new.lbegin() });
+ * \endcode
+ *
+ * For halo wrappers with a halo depth k > 1, \c apply_sweeps computes k
+ * stencil sweeps after a single halo update.
+ */
+template <typename HaloMatrixWrapperT>
+class StencilOperator {
+private:
+  using iterator_inner  = typename HaloMatrixWrapperT::iterator_inner;
+  using iterator_bnd    = typename HaloMatrixWrapperT::iterator_bnd;
+  using iterator_sweep  = typename HaloMatrixWrapperT::iterator_sweep;
+  using region_extent_t = typename HaloMatrixWrapperT::region_extent_t;
+  using region_index_t  = typename HaloMatrixWrapperT::region_index_t;
+  using pattern_index_t = typename iterator_inner::pattern_index_t;
+
+  static constexpr auto NumDimensions = iterator_inner::ndim();
+
+  using RegionCoords_t = RegionCoords<NumDimensions>;
+
+  /// Contiguous range of boundary elements and the halo regions accessed
+  /// by stencil points of these elements
+  struct BoundaryBlock {
+    pattern_index_t             first;
+    pattern_index_t             size;
+    std::vector<region_index_t> regions;
+  };
+
+public:
+  StencilOperator(HaloMatrixWrapperT& halo_wrapper)
+  : _halo_wrapper(halo_wrapper) {
+    dash::util::UnitLocality uloc;
+    _num_threads = std::max(1, uloc.num_domain_threads());
+
+    const auto& haloblock = _halo_wrapper.halo_block();
+    const auto& view      = haloblock.view();
+
+    pattern_index_t first = 0;
+    for(const auto& bnd_elems : haloblock.boundary_elements()) {
+      pattern_index_t size = bnd_elems.size();
+      if(size == 0)
+        continue;
+
+      BoundaryBlock block{ first, size, {} };
+      for(const auto& stencil : _halo_wrapper.stencil_spec().specs()) {
+        // Region coordinates covered by the shifted block in every dimension
+        std::array<std::vector<uint8_t>, NumDimensions> reg_coords;
+        for(dim_t d = 0; d < NumDimensions; ++d) {
+          pattern_index_t lower =
+            bnd_elems.offset(d) - view.offset(d) + stencil[d];
+          pattern_index_t upper = lower + bnd_elems.extent(d) - 1;
+          pattern_index_t ext   = view.extent(d);
+          if(lower < 0)
+            reg_coords[d].push_back(0);
+          if(upper >= 0 && lower < ext)
+            reg_coords[d].push_back(1);
+          if(upper >= ext)
+            reg_coords[d].push_back(2);
+        }
+        add_regions(reg_coords, 0, 0, true, block.regions);
+      }
+      std::sort(block.regions.begin(), block.regions.end());
+      block.regions.erase(
+        std::unique(block.regions.begin(), block.regions.end()),
+        block.regions.end());
+
+      _bnd_blocks.push_back(std::move(block));
+      first += size;
+    }
+  }
+
+  /**
+   * Applies \c inner_kernel to all inner elements and \c bnd_kernel to all
+   * boundary elements while the halo regions are updated.
+   */
+  template <typename InnerKernelT, typename BoundaryKernelT>
+  void apply(const InnerKernelT& inner_kernel,
+             const BoundaryKernelT& bnd_kernel) {
+    _halo_wrapper.update_async();
+
+    apply_inner(inner_kernel);
+    apply_boundary(bnd_kernel);
+
+    // Complete updates of regions not accessed by the stencil
+    _halo_wrapper.wait();
+  }
+
+  /**
+   * Applies \c kernel to all inner and boundary elements while the halo
+   * regions are updated. The kernel must accept inner and boundary
+   * iterators, e.g. by a templated call operator.
+   */
+  template <typename KernelT>
+  void apply(const KernelT& kernel) {
+    apply(kernel, kernel);
+  }
+
+  /**
+   * Updates the halo regions once and applies \c halo_depth() stencil
+   * sweeps, alternating between the matrix of this operator's halo wrapper
+   * and the matrix of \c dst, which must have the same halo depth. The
+   * result of the last sweep is stored in the matrix of \c dst for an odd
+   * halo depth and in the matrix of this operator otherwise.
+   *
+   * The kernel is called with a reference to a sweep iterator of the input
+   * wrapper and returns the new value of the element, which may lie in a
+   * halo region of \c dst.
+   *
+   * Halo regions of \c dst at global borders without halos are read but
+   * never computed, so \c dst is updated once before its first sweep.
+   * As the sweeps write to both matrices, all units synchronize once after
+   * the halo update, instead of after every sweep.
+   */
+  template <typename KernelT>
+  void apply_sweeps(HaloMatrixWrapperT& dst, const KernelT& kernel) {
+    auto depth = _halo_wrapper.halo_depth();
+    if(dst.halo_depth() != depth) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "StencilOperator.apply_sweeps: halo depth of output ("
+                 << dst.halo_depth() << ") differs from input (" << depth
+                 << ")");
+    }
+    if(_sweep_dst != &dst) {
+      dst.update();
+      _sweep_dst = &dst;
+    }
+    _halo_wrapper.update();
+    // Sweeps overwrite both matrices, neighbors must have completed reading
+    // their halo regions from them
+    _halo_wrapper.matrix().team().barrier();
+
+    HaloMatrixWrapperT* in  = &_halo_wrapper;
+    HaloMatrixWrapperT* out = &dst;
+    for(region_extent_t sweep = 0; sweep < depth; ++sweep) {
+      const auto      in_begin  = in->sbegin(sweep);
+      const auto      out_begin = out->sbegin(sweep);
+      pattern_index_t size      = out->send(sweep).rpos();
+      for_chunks(size, [&](pattern_index_t first, pattern_index_t last) {
+        auto it_in  = in_begin + first;
+        auto it_out = out_begin + first;
+        for(auto i = first; i < last; ++i, ++it_in, ++it_out)
+          *it_out = kernel(it_in);
+      });
+      std::swap(in, out);
+    }
+  }
+
+  HaloMatrixWrapperT& halo_wrapper() { return _halo_wrapper; }
+
+private:
+  void add_regions(
+    const std::array<std::vector<uint8_t>, NumDimensions>& reg_coords,
+    dim_t dim, region_index_t index, bool center,
+    std::vector<region_index_t>& regions) const {
+    if(dim == NumDimensions) {
+      // The center region is the local block itself
+      if(!center)
+        regions.push_back(index);
+      return;
+    }
+    for(auto coord : reg_coords[dim]) {
+      add_regions(reg_coords, dim + 1,
+                  coord + index * RegionCoords_t::REGION_INDEX_BASE,
+                  center && coord == 1, regions);
+    }
+  }
+
+  /**
+   * Calls \c body(first, last) for contiguous chunks of the range
+   * [0, size), on all threads available to the unit if OpenMP is enabled.
+   * Every thread gets one chunk to only set up iterator positions once per
+   * thread.
+   */
+  template <typename BodyT>
+  void for_chunks(pattern_index_t size, const BodyT& body) const {
+    dash::internal::parallel_for(
+      size, dash::internal::parallel_config(_num_threads),
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        body(static_cast<pattern_index_t>(first),
+             static_cast<pattern_index_t>(last));
+      });
+  }
+
+  template <typename InnerKernelT>
+  void apply_inner(const InnerKernelT& kernel) {
+    const auto      ibegin = _halo_wrapper.ibegin();
+    pattern_index_t isize  = _halo_wrapper.halo_block().view_inner().size();
+    for_chunks(isize, [&](pattern_index_t first, pattern_index_t last) {
+      auto it = ibegin + first;
+      for(auto i = first; i < last; ++i, ++it)
+        kernel(it);
+    });
+  }
+
+  template <typename BoundaryKernelT>
+  void apply_boundary(const BoundaryKernelT& kernel) {
+    std::array<bool, RegionCoords_t::MaxIndex> reg_done{};
+    std::vector<const BoundaryBlock*> pending;
+    pending.reserve(_bnd_blocks.size());
+    for(const auto& block : _bnd_blocks)
+      pending.push_back(&block);
+
+    const auto bbegin = _halo_wrapper.bbegin();
+    while(!pending.empty()) {
+      bool progress = false;
+      auto it_pending = pending.begin();
+      while(it_pending != pending.end()) {
+        const auto& block   = **it_pending;
+        bool        arrived = true;
+        for(auto index : block.regions) {
+          if(!reg_done[index])
+            reg_done[index] = _halo_wrapper.test_at(index);
+          if(!reg_done[index]) {
+            arrived = false;
+            break;
+          }
+        }
+        if(!arrived) {
+          ++it_pending;
+          continue;
+        }
+        auto it = bbegin + block.first;
+        for(pattern_index_t i = 0; i < block.size; ++i, ++it)
+          kernel(it);
+
+        it_pending = pending.erase(it_pending);
+        progress   = true;
+      }
+      if(!progress) {
+        // No block can be computed, block on a missing region of the first
+        // pending block instead of polling
+        for(auto index : pending.front()->regions) {
+          if(!reg_done[index]) {
+            DASH_LOG_TRACE("StencilOperator.apply_boundary", "wait for region",
+                           index);
+            _halo_wrapper.wait_at(index);
+            reg_done[index] = true;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+private:
+  HaloMatrixWrapperT&        _halo_wrapper;
+  std::vector<BoundaryBlock> _bnd_blocks;
+  int                        _num_threads = 1;
+  /// Output wrapper of the previous call of apply_sweeps
+  HaloMatrixWrapperT*        _sweep_dst   = nullptr;
+};
+
+}  // namespace dash
+
+#endif  // DASH__HALO__STENCILOPERATOR_H
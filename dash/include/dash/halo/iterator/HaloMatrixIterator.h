@@ -5,11 +5,18 @@
 
 #include <dash/halo/Halo.h>
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace dash {
 
-enum class StencilViewScope : std::uint8_t { INNER, BOUNDARY, ALL };
+/**
+ * Elements of the local block iterated by \c HaloMatrixIterator.
+ * \c SWEEP iterates a given view of elements that may lie in halo regions,
+ * see \c HaloBlock::view_sweep.
+ */
+enum class StencilViewScope : std::uint8_t { INNER, BOUNDARY, ALL, SWEEP };
 
 template <typename ElementT, typename PatternT, typename StencilSpecT,
           StencilViewScope Scope>
@@ -52,7 +59,7 @@ public:
     if(Scope == StencilViewScope::INNER)
       set_view_local(_haloblock.view_inner());
 
-    if(Scope == StencilViewScope::ALL)
+    if(Scope == StencilViewScope::ALL || Scope == StencilViewScope::SWEEP)
       set_view_local(_haloblock.view_inner_with_boundaries());
 
     if(Scope == StencilViewScope::BOUNDARY)
@@ -63,8 +70,26 @@ public:
     else
       _size = _view_local.size();
 
+    set_stencil_offsets(stencil_spec);
     set_coords();
+  }
+
+  /**
+   * Creates an iterator over the elements of the global view \c view.
+   * In scope \c SWEEP, the view may contain elements of halo regions,
+   * which are read and written in the halo memory.
+   */
+  HaloMatrixIterator(const HaloBlock_t& haloblock, HaloMemory_t& halomemory,
+                     const StencilSpecT& stencil_spec, const ViewSpec_t& view,
+                     pattern_index_t idx)
+  : _haloblock(haloblock), _halomemory(halomemory), _stencil_spec(stencil_spec),
+    _local_memory((ElementT*) _haloblock.globmem().lbegin()),
+    _local_layout(_haloblock.pattern().local_memory_layout()), _idx(idx) {
+    set_view_local(view);
+    _size = _view_local.size();
+
     set_stencil_offsets(stencil_spec);
+    set_coords();
   }
 
   /**
@@ -101,11 +126,18 @@ public:
    */
   reference operator[](pattern_index_t n) const {
     auto coords = set_coords(_idx + n);
+    if(Scope == StencilViewScope::SWEEP)
+      return *element_pos(coords);
+
     return _local_memory[_local_layout.at(coords)];
   }
 
   pattern_index_t rpos() const { return _idx; }
 
+  /**
+   * Local offset of the element at the iterator's position, only valid
+   * for elements of the local block.
+   */
   pattern_index_t lpos() const { return _local_layout.at(_coords); }
 
   const ElementCoords_t& coords() const { return _coords; };
@@ -150,7 +182,7 @@ public:
 
   ElementT value_at(const region_index_t index_stencil) {
 
-    if(Scope == StencilViewScope::INNER)
+    if(Scope == StencilViewScope::INNER || _inner_pos)
       return *(_current_lmemory_addr + _stencil_offsets[index_stencil]);
 
     auto        halo_coords =  _coords ;
@@ -166,6 +198,10 @@ public:
     if(halo)
       return value_halo_at(halo_coords);
 
+    // The element at the iterator's position may lie in a halo region
+    if(Scope == StencilViewScope::SWEEP && !_local_pos)
+      return _local_memory[_local_layout.at(halo_coords)];
+
     return *(_current_lmemory_addr + _stencil_offsets[index_stencil]);
   }
 
@@ -186,6 +222,9 @@ public:
       if(halo)
         return value_halo_at(halo_coords);
 
+      if(Scope == StencilViewScope::SWEEP && !_local_pos)
+        return _local_memory[_local_layout.at(halo_coords)];
+
       return *halo_pos(stencil);
     }
   }
@@ -195,7 +234,10 @@ public:
    */
   Self_t& operator++() {
     ++_idx;
-    set_coords();
+    if(Scope == StencilViewScope::SWEEP)
+      next_coords();
+    else
+      set_coords();
 
     return *this;
   }
@@ -343,7 +385,57 @@ private:
   }
 
   void set_coords() {
-    _coords            = set_coords(_idx);
+    _coords = set_coords(_idx);
+    set_pos();
+  }
+
+  /**
+   * Moves the coordinates to the next element of the view in memory order
+   * instead of computing them from the index.
+   */
+  void next_coords() {
+    if(_idx >= _size) {
+      set_coords();
+      return;
+    }
+    if(MemoryArrange == ROW_MAJOR) {
+      for(auto d = NumDimensions - 1; d >= 0; --d) {
+        signed_pattern_size_t end = _view_local.offset(d)
+                                    + _view_local.extent(d);
+        if(++_coords[d] < end)
+          break;
+        _coords[d] = _view_local.offset(d);
+      }
+    } else {
+      for(auto d = 0; d < NumDimensions; ++d) {
+        signed_pattern_size_t end = _view_local.offset(d)
+                                    + _view_local.extent(d);
+        if(++_coords[d] < end)
+          break;
+        _coords[d] = _view_local.offset(d);
+      }
+    }
+    set_pos();
+  }
+
+  void set_pos() {
+    if(Scope == StencilViewScope::SWEEP) {
+      _local_pos = true;
+      _inner_pos = true;
+      for(auto d = 0; d < NumDimensions; ++d) {
+        signed_pattern_size_t extent = _haloblock.view().extent(d);
+        if(_coords[d] < 0 || _coords[d] >= extent)
+          _local_pos = false;
+        if(_coords[d] + _stencil_reach[d].first < 0
+           || _coords[d] + _stencil_reach[d].second >= extent)
+          _inner_pos = false;
+      }
+      if(!_local_pos) {
+        _current_lmemory_addr =
+          (_idx < _size) ? halo_element_pos(_coords) : nullptr;
+        return;
+      }
+    }
     pattern_size_t off = 0;
     if(MemoryArrange == ROW_MAJOR) {
       off = _coords[0];
@@ -378,12 +470,28 @@ private:
   }
 
   ElementT value_halo_at(ElementCoords_t halo_coords) {
+    return *halo_element_pos(halo_coords);
+  }
+
+  ElementT* halo_element_pos(ElementCoords_t halo_coords) const {
     auto index =
       _haloblock.index_at(ViewSpec_t(_local_layout.extents()), halo_coords);
     _halomemory.to_halo_mem_coords(index, halo_coords);
 
-    return *(_halomemory.pos_at(index)
-             + _halomemory.value_at(index, halo_coords));
+    return _halomemory.pos_at(index) + _halomemory.value_at(index, halo_coords);
+  }
+
+  /**
+   * Position of the element at the given local coordinates in the local
+   * block or in the halo memory.
+   */
+  ElementT* element_pos(const ElementCoords_t& coords) const {
+    for(auto d = 0; d < NumDimensions; ++d) {
+      if(coords[d] < 0 || coords[d] >= _haloblock.view().extent(d))
+        return halo_element_pos(coords);
+    }
+
+    return _local_memory + _local_layout.at(coords);
   }
 
   ElementT* halo_pos(const Stencil_t& stencil) {
@@ -414,6 +522,13 @@ private:
           offset = stencil_spec[i][d] + offset * _local_layout.extent(d);
       }
       _stencil_offsets[i] = offset;
+
+      for(auto d = 0; d < NumDimensions; ++d) {
+        _stencil_reach[d].first =
+          std::min<int>(_stencil_reach[d].first, stencil_spec[i][d]);
+        _stencil_reach[d].second =
+          std::max<int>(_stencil_reach[d].second, stencil_spec[i][d]);
+      }
     }
   }
 
@@ -432,6 +547,13 @@ private:
 
   ElementCoords_t _coords;
   ElementT*       _current_lmemory_addr;
+  /// Whether the element at the iterator's position is in the local block
+  bool            _local_pos = true;
+  /// Whether all stencil points of the element are in the local block,
+  /// only set in scope SWEEP
+  bool            _inner_pos = false;
+  /// Minimum and maximum stencil offset per dimension
+  std::array<std::pair<int, int>, NumDimensions> _stencil_reach{};
 };  // class HaloMatrixIterator
 
 }  // namespace dash
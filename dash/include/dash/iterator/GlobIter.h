@@ -87,6 +87,8 @@ public:
   typedef typename PatternType::index_type             index_type;
 
 private:
+  typedef typename PatternType::local_index_t        local_pos_t;
+
   typedef GlobIter<
             const ElementType,
             PatternType,
@@ -145,6 +147,16 @@ protected:
   team_unit_t            _myid;
   /// Pointer to first element in local memory
   local_pointer          _lbegin          = nullptr;
+  /// Unit and local offset of the element at the iterator's position,
+  /// updated incrementally while \c _lpos_valid is set.
+  team_unit_t            _lpos_unit;
+  index_type             _lpos_index      = 0;
+  /// Number of elements following the iterator's position that are
+  /// stored contiguously in local memory of \c _lpos_unit.
+  index_type             _lpos_run        = 0;
+  /// Whether \c _lpos_unit, \c _lpos_index and \c _lpos_run refer to
+  /// the iterator's position.
+  bool                   _lpos_valid      = false;
 
 public:
   /**
@@ -156,7 +168,11 @@ public:
     _idx(0),
     _max_idx(0),
     _myid(dash::Team::All().myid()),
-    _lbegin(nullptr)
+    _lbegin(nullptr),
+    _lpos_unit(DART_UNDEFINED_UNIT_ID),
+    _lpos_index(0),
+    _lpos_run(0),
+    _lpos_valid(false)
   { }
 
   /**
@@ -172,7 +188,11 @@ public:
     _idx(position),
     _max_idx(pat.size() - 1),
     _myid(pat.team().myid()),
-    _lbegin(_globmem->lbegin())
+    _lbegin(_globmem->lbegin()),
+    _lpos_unit(DART_UNDEFINED_UNIT_ID),
+    _lpos_index(0),
+    _lpos_run(0),
+    _lpos_valid(false)
   { }
 
   /**
@@ -191,6 +211,10 @@ public:
   , _max_idx(other._max_idx)
   , _myid   (other._myid)
   , _lbegin (other._lbegin)
+  , _lpos_unit (other._lpos_unit)
+  , _lpos_index(other._lpos_index)
+  , _lpos_run  (other._lpos_run)
+  , _lpos_valid(other._lpos_valid)
   { }
 
   /**
@@ -209,6 +233,10 @@ public:
   , _max_idx(other._max_idx)
   , _myid   (other._myid)
   , _lbegin (other._lbegin)
+  , _lpos_unit (other._lpos_unit)
+  , _lpos_index(other._lpos_index)
+  , _lpos_run  (other._lpos_run)
+  , _lpos_valid(other._lpos_valid)
   { }
 
   /**
@@ -229,6 +257,10 @@ public:
     _max_idx = other._max_idx;
     _myid    = other._myid;
     _lbegin  = other._lbegin;
+    _lpos_unit  = other._lpos_unit;
+    _lpos_index = other._lpos_index;
+    _lpos_run   = other._lpos_run;
+    _lpos_valid = other._lpos_valid;
     return *this;
   }
 
@@ -250,6 +282,10 @@ public:
     _max_idx = other._max_idx;
     _myid    = other._myid;
     _lbegin  = other._lbegin;
+    _lpos_unit  = other._lpos_unit;
+    _lpos_index = other._lpos_index;
+    _lpos_run   = other._lpos_run;
+    _lpos_valid = other._lpos_valid;
     // no ownership to transfer
     return *this;
   }
@@ -369,7 +405,8 @@ public:
    */
   inline reference operator*()
   {
-    return this->operator[](_idx);
+    update_lpos();
+    return reference(_globmem->at(_lpos_unit, _lpos_index));
   }
 
   /**
@@ -379,6 +416,9 @@ public:
    */
   inline const_reference operator*() const
   {
+    if (_lpos_valid) {
+      return const_reference(_globmem->at(_lpos_unit, _lpos_index));
+    }
     return this->operator[](_idx);
   }
 
@@ -438,39 +478,43 @@ public:
    */
   local_pointer local() const
   {
-    /*
-     *
-     * TODO: Evaluate alternative:
-     *         auto l_idx_this = _container.pattern().local(this->pos());
-     *         return (l_idx_this.unit == _myid
-     *                 ? _lbegin + l_idx_this
-     *                 : nullptr
-     *                );
-     */
     DASH_LOG_TRACE_VAR("GlobIter.local=()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
-    index_type idx    = _idx;
-    index_type offset = 0;
-    DASH_LOG_TRACE_VAR("GlobIter.local=", _max_idx);
-    // Convert iterator position (_idx) to local index and unit.
-    if (_idx > _max_idx) {
-      // Global iterator pointing past the range indexed by the pattern
-      // which is the case for .end() iterators.
-      idx     = _max_idx;
-      offset += _idx - _max_idx;
-    }
-    DASH_LOG_TRACE_VAR("GlobIter.local=", idx);
-    DASH_LOG_TRACE_VAR("GlobIter.local=", offset);
-    // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
+    local_pos_t local_pos = lpos();
     DASH_LOG_TRACE_VAR("GlobIter.local= >", local_pos.unit);
     DASH_LOG_TRACE_VAR("GlobIter.local= >", local_pos.index);
     if (_myid != local_pos.unit) {
       // Iterator position does not point to local element
       return nullptr;
     }
-    return (_lbegin + local_pos.index + offset);
+    return (_lbegin + local_pos.index);
+  }
+
+  /**
+   * Number of elements from the iterator's position, including the
+   * element at the iterator's position, that are stored contiguously in
+   * the memory of the same unit.
+   *
+   * Together with \c local(), allows to traverse local runs of a global
+   * range on native pointers:
+   *
+   * \code
+   *   while (it != end) {
+   *     auto n = std::min(it.lrun(), end - it);
+   *     if (auto lptr = it.local()) {
+   *       std::for_each(lptr, lptr + n, f);
+   *     }
+   *     it += n;
+   *   }
+   * \endcode
+   */
+  index_type lrun() const
+  {
+    if (_lpos_valid) {
+      return _lpos_run + 1;
+    }
+    self_t it(*this);
+    it.update_lpos();
+    return it._lpos_run + 1;
   }
 
   /**
@@ -479,27 +523,15 @@ public:
   inline typename pattern_type::local_index_t lpos() const
   {
     DASH_LOG_TRACE_VAR("GlobIter.lpos()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
-    index_type idx    = _idx;
-    index_type offset = 0;
-    // Convert iterator position (_idx) to local index and unit.
-    if (_idx > _max_idx) {
-      // Global iterator pointing past the range indexed by the pattern
-      // which is the case for .end() iterators.
-      idx    = _max_idx;
-      offset = _idx - _max_idx;
-      DASH_LOG_TRACE_VAR("GlobIter.lpos", _max_idx);
-      DASH_LOG_TRACE_VAR("GlobIter.lpos", idx);
-      DASH_LOG_TRACE_VAR("GlobIter.lpos", offset);
+    if (_lpos_valid) {
+      return local_pos_t { _lpos_unit, _lpos_index };
     }
-    // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
-    local_pos.index += offset;
+    self_t it(*this);
+    it.update_lpos();
     DASH_LOG_TRACE("GlobIter.lpos >",
-                   "unit:",        local_pos.unit,
-                   "local index:", local_pos.index);
-    return local_pos;
+                   "unit:",        it._lpos_unit,
+                   "local index:", it._lpos_index);
+    return local_pos_t { it._lpos_unit, it._lpos_index };
   }
 
   /**
@@ -568,6 +600,7 @@ public:
   inline self_t & operator++()
   {
     ++_idx;
+    advance_lpos(1);
     return *this;
   }
 
@@ -578,6 +611,7 @@ public:
   {
     self_t result = *this;
     ++_idx;
+    advance_lpos(1);
     return result;
   }
 
@@ -587,6 +621,7 @@ public:
   inline self_t & operator--()
   {
     --_idx;
+    _lpos_valid = false;
     return *this;
   }
 
@@ -597,18 +632,21 @@ public:
   {
     self_t result = *this;
     --_idx;
+    _lpos_valid = false;
     return result;
   }
 
   inline self_t & operator+=(index_type n)
   {
     _idx += n;
+    advance_lpos(n);
     return *this;
   }
 
   inline self_t & operator-=(index_type n)
   {
     _idx -= n;
+    _lpos_valid = false;
     return *this;
   }
 
@@ -696,6 +734,83 @@ public:
     return _pattern->team();
   }
 
+private:
+  /**
+   * Resolves unit and local offset of the element at the iterator's
+   * position and the number of elements following it in the same local
+   * run, unless these are known already.
+   */
+  void update_lpos()
+  {
+    if (_lpos_valid) {
+      return;
+    }
+    index_type idx    = _idx;
+    index_type offset = 0;
+    // Convert iterator position (_idx) to local index and unit.
+    if (_idx > _max_idx) {
+      // Global iterator pointing past the range indexed by the pattern
+      // which is the case for .end() iterators.
+      idx    = _max_idx;
+      offset = _idx - _max_idx;
+    }
+    // Global index to local index and unit:
+    local_pos_t local_pos = _pattern->local(idx);
+    _lpos_unit  = local_pos.unit;
+    _lpos_index = local_pos.index + offset;
+    _lpos_run   = (offset == 0) ? local_run(idx, local_pos) : 0;
+    _lpos_valid = true;
+  }
+
+  /**
+   * Moves the cached local position by \c n elements if the new position
+   * is in the same local run, otherwise invalidates it.
+   */
+  inline void advance_lpos(index_type n)
+  {
+    if (_lpos_valid && n >= 0 && n <= _lpos_run) {
+      _lpos_index += n;
+      _lpos_run   -= n;
+    } else {
+      _lpos_valid = false;
+    }
+  }
+
+  /**
+   * Number of elements following the element at global index \c g_index
+   * in the pattern's memory order that are stored contiguously after it
+   * in the local memory of the same unit.
+   *
+   * Such runs are bounded by the extent of the element's block in the
+   * fastest-changing dimension.
+   */
+  index_type local_run(
+    index_type          g_index,
+    const local_pos_t & local_pos) const
+  {
+    const dim_t d = (Arrangement == dash::ROW_MAJOR) ? NumDimensions - 1 : 0;
+    auto g_coords = _pattern->coords(g_index);
+    auto block    = _pattern->block(_pattern->block_at(g_coords));
+    index_type end_d = static_cast<index_type>(block.offset(d)) +
+                       static_cast<index_type>(block.extent(d));
+    index_type extent_d = static_cast<index_type>(_pattern->extent(d));
+    if (end_d > extent_d) {
+      end_d = extent_d;
+    }
+    index_type run = end_d - static_cast<index_type>(g_coords[d]) - 1;
+    if (run <= 0) {
+      return 0;
+    }
+    // Validate the run's end as patterns are not required to store
+    // elements of a block contiguously:
+    local_pos_t local_end = _pattern->local(g_index + run);
+    if (local_end.unit  != local_pos.unit ||
+        local_end.index != local_pos.index + run) {
+      return 0;
+    }
+    return run;
+  }
+
 }; // class GlobIter
 
 
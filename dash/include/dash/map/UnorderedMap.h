@@ -17,6 +17,8 @@
 #include <dash/map/UnorderedMapLocalIter.h>
 #include <dash/map/UnorderedMapGlobIter.h>
 
+#include <dash/map/internal/UnorderedMapIndex.h>
+
 #include <iterator>
 #include <utility>
 #include <limits>
@@ -24,6 +26,7 @@
 #include <functional>
 #include <algorithm>
 #include <cstddef>
+#include <type_traits>
 
 
 namespace dash {
@@ -70,6 +73,18 @@ private:
   team_unit_t   _myid;
 }; // class HashLocal
 
+/**
+ * Type trait indicating whether a hash function maps every key to the
+ * calling unit like \c dash::HashLocal.
+ * Elements in maps using such a hash function cannot be resolved at a
+ * single owner unit, lookups have to query all units instead.
+ */
+template<typename Hash>
+struct is_local_hash : std::false_type { };
+
+template<typename Key>
+struct is_local_hash< dash::HashLocal<Key> > : std::true_type { };
+
 #ifndef DOXYGEN
 
 template<
@@ -168,6 +183,11 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+private:
+  typedef dash::internal::UnorderedMapIndex<
+            key_type, index_type, size_type>
+    key_index_type;
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -192,12 +212,35 @@ private:
   /// Iterators to elements in local memory space that are marked for move
   /// to remote unit in next commit.
   std::vector<iterator>  _move_elements;
+  /// Number of elements in local memory of all units that are marked for
+  /// move to a remote unit, as of the last commit.
+  size_type              _num_move_elements = 0;
+  /// Whether the element at a local offset has been erased.
+  std::vector<bool>      _local_erased;
+  /// Number of erased elements in local memory.
+  size_type              _local_erased_size  = 0;
+  /// Number of erased elements in local memory of remote units, as of the
+  /// last commit.
+  size_type              _remote_erased_size = 0;
+  /// Sorted local offsets of erased elements of all units as of the last
+  /// commit, grouped by unit.
+  std::vector<index_type> _erased_lidx;
+  /// Offset of every unit's erased local offsets in \c _erased_lidx.
+  std::vector<size_t>    _erased_displs;
   /// Global pointer to local element in _local_sizes.
   dart_gptr_t            _local_size_gptr = DART_GPTR_NULL;
   /// Hash type for mapping of key to unit and local offset.
   hasher                 _key_hash;
   /// Predicate for key comparison.
   key_equal              _key_equal;
+  /// Hash function for the local key index, independent from the mapping
+  /// of keys to units by \c hasher which only resolves a key's owner unit.
+  /// Requires a specialization of \c std::hash for \c key_type.
+  std::hash<key_type>    _key_index_hash;
+  /// Hash index of elements in local memory of all units.
+  key_index_type         _key_index;
+  /// Native pointers to elements in local memory by local offset.
+  std::vector<value_type *> _local_elements;
   /// Capacity of local buffer containing locally added node elements that
   /// have not been committed to global memory yet.
   /// Default is 4 KB.
@@ -297,12 +340,20 @@ public:
                      "local size at unit", u, ":", local_size_u,
                      "cumulative size:", _local_cumul_sizes[u]);
     }
+    if (_globmem != nullptr) {
+      // Publish erased elements and local key index to remote units:
+      _commit_erased();
+      _key_index.commit();
+    }
     auto new_size = size();
     DASH_LOG_TRACE("UnorderedMap.barrier", "new size:", new_size);
-    DASH_ASSERT_EQ(_remote_size, new_size - _local_sizes.local[0],
+    DASH_ASSERT_EQ(_remote_size - _remote_erased_size,
+                   new_size - lsize(),
                    "invalid size after global commit");
-    _begin = iterator(this, 0);
-    _end   = iterator(this, new_size);
+    _begin  = iterator(this, 0);
+    _end    = iterator(this, _remote_size + _local_sizes.local[0]);
+    _lbegin = local_iterator(this, 0);
+    _lend   = local_iterator(this, _local_sizes.local[0]);
     DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
   }
 
@@ -347,6 +398,10 @@ public:
     _local_sizes.local[0] = 0;
     _local_size_gptr      = _local_sizes[_myid].dart_gptr();
 
+    // Initialize key index:
+    _local_elements.clear();
+    _key_index.allocate(*_team);
+
     // Global iterators:
     _begin       = iterator(this, 0);
     _end         = _begin;
@@ -378,8 +433,8 @@ public:
     DASH_LOG_TRACE_VAR("UnorderedMap.deallocate()", this);
     // Assure all units are synchronized before deallocation, otherwise
     // other units might still be working on the map:
-    if (dash::is_initialized()) {
-      barrier();
+    if (dash::is_initialized() && _globmem != nullptr) {
+      _team->barrier();
     }
     // Remove this function from team deallocator map to avoid
     // double-free:
@@ -391,6 +446,15 @@ public:
       delete _globmem;
       _globmem = nullptr;
     }
+    _key_index.deallocate();
+    _local_elements.clear();
+    _move_elements.clear();
+    _num_move_elements    = 0;
+    _local_erased.clear();
+    _local_erased_size    = 0;
+    _remote_erased_size   = 0;
+    _erased_lidx.clear();
+    _erased_displs.clear();
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
@@ -478,7 +542,7 @@ public:
 
   inline size_type size() const noexcept
   {
-    return _remote_size + _local_sizes.local[0];
+    return _remote_size - _remote_erased_size + lsize();
   }
 
   inline size_type capacity() const noexcept
@@ -493,7 +557,7 @@ public:
 
   inline size_type lsize() const noexcept
   {
-    return _local_sizes.local[0];
+    return _local_sizes.local[0] - _local_erased_size;
   }
 
   inline size_type lcapacity() const noexcept
@@ -530,17 +594,20 @@ public:
   const_mapped_type_reference at(const key_type & key) const
   {
     DASH_LOG_TRACE("UnorderedMap.at() const", "key:", key);
-    auto found = find(key);
-    if (found == _end) {
+    auto found = const_cast<self_t *>(this)->_find(key);
+    if (found.second == -1) {
       // No equivalent key in map, throw:
       DASH_THROW(
         dash::exception::InvalidArgument,
         "No element in map for key " << key);
     }
-    dart_gptr_t gptr_mapped   = iterator(this, found.pos()).dart_gptr();
-
-    value_type  * lptr_value  = static_cast<value_type *>(
-                                  found.local());
+    dart_gptr_t   gptr_mapped = iterator(
+                                  const_cast<self_t *>(this),
+                                  found.first, found.second
+                                ).dart_gptr();
+    value_type  * lptr_value  = (found.first == _myid)
+                                ? _local_elements[found.second]
+                                : nullptr;
     mapped_type * lptr_mapped = nullptr;
 
     _lptr_value_to_mapped(lptr_value, gptr_mapped, lptr_mapped);
@@ -553,16 +620,25 @@ public:
   mapped_type_reference at(const key_type & key)
   {
     DASH_LOG_TRACE("UnorderedMap.at()", "key:", key);
-    // TODO: Unoptimized, currently calls find(key) twice as operator[](key)
-    //       calls insert(key).
-    const_iterator git_value = find(key);
-    if (git_value == _end) {
+    auto found = _find(key);
+    if (found.second == -1) {
       // No equivalent key in map, throw:
       DASH_THROW(
         dash::exception::InvalidArgument,
         "No element in map for key " << key);
     }
-    auto mapped = this->operator[](key);
+    dart_gptr_t   gptr_mapped = iterator(
+                                  this, found.first, found.second
+                                ).dart_gptr();
+    value_type  * lptr_value  = (found.first == _myid)
+                                ? _local_elements[found.second]
+                                : nullptr;
+    mapped_type * lptr_mapped = nullptr;
+
+    _lptr_value_to_mapped(lptr_value, gptr_mapped, lptr_mapped);
+    // Create global reference to mapped value member in element:
+    mapped_type_reference mapped(gptr_mapped,
+                                 lptr_mapped);
     DASH_LOG_TRACE("UnorderedMap.at >", mapped);
     return mapped;
   }
@@ -575,21 +651,30 @@ public:
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.count()", key);
     size_type nelem = 0;
-    if (find(key) != _end) {
+    if (const_cast<self_t *>(this)->_find(key).second >= 0) {
       nelem = 1;
     }
     DASH_LOG_TRACE("UnorderedMap.count >", nelem);
     return nelem;
   }
 
+  /**
+   * Resolves the element with the given key.
+   *
+   * The key is looked up in the hash index of the unit mapped to the key
+   * by the hash function, in \c O(1) expected one-sided operations.
+   * Elements inserted at other units are only visible after the next
+   * \c barrier().
+   * For hash functions mapping keys to the calling unit like
+   * \c dash::HashLocal, the indices of all units are searched.
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    auto     lpos  = _find(key);
+    iterator found = (lpos.second == -1)
+                     ? _end
+                     : iterator(this, lpos.first, lpos.second);
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -597,11 +682,11 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    auto           lpos  = const_cast<self_t *>(this)->_find(key);
+    const_iterator found = (lpos.second == -1)
+                           ? _end
+                           : const_iterator(const_cast<self_t *>(this),
+                                            lpos.first, lpos.second);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
@@ -628,7 +713,7 @@ public:
     if (found != _end) {
       DASH_LOG_TRACE("UnorderedMap.insert", "key found");
       // Existing element found, no insertion:
-      result.first  = iterator(this, found.pos());
+      result.first  = found;
       result.second = false;
     } else {
       DASH_LOG_TRACE("UnorderedMap.insert", "key not found");
@@ -651,41 +736,241 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
+    // Calling insert() on every single element in the range could cause
+    // multiple calls of globmem.grow(_local_buffer_size).
+    // Use collective bulk_insert(first,last) to insert large ranges in a
+    // single allocation per unit.
     for (auto it = first; it != last; ++it) {
       insert(*it);
     }
   }
 
+  /**
+   * Inserts the elements in the given range at the units mapped to their
+   * keys by the hash function.
+   * Collective operation, includes a \c barrier().
+   *
+   * Elements are sorted by their target unit and exchanged in a single
+   * all-to-all operation. Every unit then stores all elements it received
+   * in a single allocation, skipping elements with keys already contained
+   * in its local memory or received earlier in the same batch.
+   *
+   * \returns  Number of elements inserted at the local unit.
+   * \throws   dash::exception::RuntimeError  on all units if a unit
+   *           cannot send or receive its elements, that is if it would
+   *           send or receive more than \c INT_MAX elements.
+   */
+  template<class ForwardIterator>
+  size_type bulk_insert(
+    /// Iterator at first value in the range to insert.
+    ForwardIterator first,
+    /// Iterator past the last value in the range to insert.
+    ForwardIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert()");
+    DASH_ASSERT(_globmem != nullptr);
+    // Target unit of every element in the range:
+    std::vector<team_unit_t> value_units;
+    for (auto it = first; it != last; ++it) {
+      value_units.push_back(_key_hash(it->first));
+    }
+    auto recv_buf = _exchange<value_type>(
+                      first, last, value_units, "UnorderedMap.bulk_insert");
+    size_type ninserted = _insert_local(
+                            reinterpret_cast<const value_type *>(
+                              recv_buf.data()),
+                            recv_buf.size());
+    // Commit changes in local memory and publish key index:
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert >", "inserted:", ninserted);
+    return ninserted;
+  }
+
+  /**
+   * Removes the element at the given position.
+   * Elements can only be erased by the unit storing them in its local
+   * memory.
+   *
+   * Erased elements are marked as tombstones that are skipped by
+   * iterators, their memory is released in \c compact().
+   * Only iterators to the erased element are invalidated.
+   *
+   * \returns  Iterator following the erased element.
+   */
   iterator erase(
     const_iterator position)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_TRACE("UnorderedMap.erase()", "iterator:", position);
+    if (!position.is_local()) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "UnorderedMap.erase: element at unit " << position.lpos().unit <<
+        " can only be erased by its owner");
+    }
+    _erase_local(position.lpos().index);
+    iterator next = position;
+    ++next;
+    DASH_LOG_TRACE("UnorderedMap.erase >", next);
+    return next;
   }
 
+  /**
+   * Removes the element with the given key.
+   * Elements can only be erased by the unit storing them in its local
+   * memory, use the collective \c bulk_erase to remove elements stored at
+   * any unit.
+   *
+   * \returns  Number of erased elements, 0 or 1.
+   * \throws   dash::exception::InvalidArgument  if the element is stored
+   *           in local memory of a remote unit.
+   */
   size_type erase(
     /// Key of the container element to remove.
     const key_type & key)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_TRACE_VAR("UnorderedMap.erase()", key);
+    auto       pos  = _find(key);
+    index_type lidx = pos.second;
+    if (lidx < 0) {
+      DASH_LOG_TRACE("UnorderedMap.erase >", "not found");
+      return 0;
+    }
+    if (pos.first != _myid) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "UnorderedMap.erase: element at unit " << pos.first <<
+        " can only be erased by its owner");
+    }
+    _erase_local(lidx);
+    DASH_LOG_TRACE("UnorderedMap.erase >", 1);
+    return 1;
+  }
+
+  /**
+   * Removes the elements with the keys in the given range at the units
+   * storing them.
+   * Collective operation, includes a \c barrier().
+   *
+   * Every unit resolves the units storing the elements with the keys in
+   * its range, like \c find, and sends the keys to these units in a
+   * single all-to-all operation. Keys not contained in the map are
+   * skipped.
+   *
+   * \returns  Number of elements erased at the local unit.
+   * \throws   dash::exception::RuntimeError  on all units if a unit
+   *           cannot send or receive its keys, that is if it would
+   *           send or receive more than \c INT_MAX keys.
+   */
+  template<class ForwardIterator>
+  size_type bulk_erase(
+    /// Iterator at first key of the elements to remove.
+    ForwardIterator first,
+    /// Iterator past the last key of the elements to remove.
+    ForwardIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.bulk_erase()");
+    // Keys of elements found in the map and the units storing them:
+    std::vector<key_type>    keys;
+    std::vector<team_unit_t> key_units;
+    for (auto it = first; it != last; ++it) {
+      auto       pos  = _find(*it);
+      index_type lidx = pos.second;
+      if (lidx >= 0) {
+        keys.push_back(*it);
+        key_units.push_back(pos.first);
+      }
+    }
+    auto recv_buf = _exchange<key_type>(
+                      keys.begin(), keys.end(), key_units,
+                      "UnorderedMap.bulk_erase");
+    auto recv_keys = reinterpret_cast<const key_type *>(recv_buf.data());
+    size_type nerased = 0;
+    for (size_type k = 0; k < recv_buf.size(); ++k) {
+      // Keys may be received from several units:
+      auto lidx = _find_local(recv_keys[k]);
+      if (lidx >= 0) {
+        _erase_local(lidx);
+        ++nerased;
+      }
+    }
+    // Publish erased elements:
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.bulk_erase >", "erased:", nerased);
+    return nerased;
   }
 
+  /**
+   * Removes the elements in the given range that are stored in local
+   * memory of the calling unit.
+   * All elements in the range are erased if all units call \c erase on
+   * the same range.
+   *
+   * \returns  Iterator past the last erased element.
+   */
   iterator erase(
     /// Iterator at first element to remove.
     const_iterator first,
     /// Iterator past the last element to remove.
     const_iterator last)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_TRACE("UnorderedMap.erase(first,last)", first, last);
+    for (auto it = first; it != last; ++it) {
+      if (it.is_local()) {
+        _erase_local(it.lpos().index);
+      }
+    }
+    DASH_LOG_TRACE("UnorderedMap.erase(first,last) >");
+    return last;
+  }
+
+  /**
+   * Removes erased elements from local memory of all units and releases
+   * unused local memory.
+   * Collective operation, includes a \c barrier().
+   *
+   * Remaining elements are moved to the front of their unit's local
+   * memory, so all iterators are invalidated.
+   */
+  void compact()
+  {
+    DASH_LOG_TRACE("UnorderedMap.compact()");
+    DASH_ASSERT(_globmem != nullptr);
+    size_type nslots = _local_sizes.local[0];
+    size_type nlive  = 0;
+    _key_index.clear();
+    _move_elements.clear();
+    for (size_type lidx = 0; lidx < nslots; ++lidx) {
+      if (_is_erased(_myid, lidx)) {
+        continue;
+      }
+      value_type * lptr = _local_elements[lidx];
+      if (nlive != lidx) {
+        // Move element to first free position:
+        new (_local_elements[nlive]) value_type(*lptr);
+        lptr->~value_type();
+        lptr = _local_elements[nlive];
+      }
+      _key_index.insert(_key_index_hash(lptr->first), lptr->first, nlive);
+      if (_key_hash(lptr->first) != _myid) {
+        _move_elements.push_back(iterator(this, _myid, nlive));
+      }
+      ++nlive;
+    }
+    DASH_LOG_TRACE("UnorderedMap.compact", "slots:", nslots,
+                   "elements:", nlive);
+    _local_elements.resize(nlive);
+    _local_erased.clear();
+    _local_erased_size = 0;
+    GlobRef<Atomic<size_type>>(_local_size_gptr).set(nlive);
+    // Release unused local memory:
+    size_type local_capacity = _globmem->local_size();
+    if (local_capacity > nlive) {
+      DASH_LOG_TRACE("UnorderedMap.compact",
+                     "globmem.shrink(", local_capacity - nlive, ")");
+      _globmem->shrink(local_capacity - nlive);
+    }
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.compact >");
   }
 
   //////////////////////////////////////////////////////////////////////////
@@ -781,6 +1066,345 @@ private:
                    "lptr to mapped:", lptr_mapped);
   }
 
+  /**
+   * Resolves unit and local offset of the element with the given key.
+   *
+   * \returns  Pair of unit and offset in the unit's local memory, or
+   *           offset -1 if no element with the given key has been found.
+   */
+  std::pair<team_unit_t, index_type> _find(const key_type & key)
+  {
+    auto hash = _key_index_hash(key);
+    // Elements in local memory, including elements inserted since the last
+    // commit:
+    auto lidx = _find_local(key);
+    if (lidx >= 0) {
+      return std::make_pair(_myid, lidx);
+    }
+    // Unit mapped to the key by the hash function:
+    team_unit_t owner = _key_hash(key);
+    if (owner != _myid) {
+      lidx = _find_remote(owner, hash, key);
+      if (lidx >= 0) {
+        return std::make_pair(owner, lidx);
+      }
+    }
+    if (!dash::is_local_hash<hasher>::value && _num_move_elements == 0) {
+      // Element can only be stored at the unit mapped to its key:
+      return std::make_pair(owner, lidx);
+    }
+    // Element could be stored at any unit:
+    auto nunits = _team->size();
+    for (size_type u = 1; u < nunits; ++u) {
+      team_unit_t unit((_myid + u) % nunits);
+      if (unit == owner) {
+        continue;
+      }
+      lidx = _find_remote(unit, hash, key);
+      if (lidx >= 0) {
+        return std::make_pair(unit, lidx);
+      }
+    }
+    return std::make_pair(_myid, lidx);
+  }
+
+  /**
+   * Resolves the offset of the element with the given key in local memory.
+   *
+   * \returns  Local offset of the element, or -1 if not found.
+   */
+  index_type _find_local(const key_type & key) const
+  {
+    return _key_index.find_local(
+             _key_index_hash(key),
+             [&](const key_type & key_l) {
+               return _key_equal(key_l, key);
+             });
+  }
+
+  /**
+   * Resolves the offset of the element with the given key in the local
+   * memory of a remote unit, using the unit's published key index.
+   * Keys are compared in the fetched index slots, elements are not
+   * accessed.
+   *
+   * \returns  Offset in local memory of the unit, or -1 if not found.
+   */
+  index_type _find_remote(
+    team_unit_t        unit,
+    std::size_t        hash,
+    const key_type   & key)
+  {
+    return _key_index.find(
+             unit, hash,
+             [&](const key_type & key_u) {
+               return _key_equal(key_u, key);
+             });
+  }
+
+  /**
+   * Sends every element in the given range to the unit at the same
+   * position in \c units in a single all-to-all operation.
+   * Collective operation.
+   *
+   * \returns  Storage of the elements received from all units, ordered by
+   *           sending unit.
+   * \throws   dash::exception::RuntimeError  on all units if a unit
+   *           cannot send or receive its elements.
+   */
+  template<class ElementType, class ForwardIterator>
+  std::vector<
+    typename std::aligned_storage<
+      sizeof(ElementType), alignof(ElementType)>::type>
+  _exchange(
+    ForwardIterator                  first,
+    ForwardIterator                  last,
+    const std::vector<team_unit_t> & units,
+    const char                     * context)
+  {
+    typedef typename std::aligned_storage<
+                       sizeof(ElementType), alignof(ElementType)
+                     >::type
+      element_storage;
+
+    auto nunits = _team->size();
+    // Number of elements and their displacement in send- and receive
+    // buffer by unit:
+    std::vector<size_t>      nsend(nunits, 0);
+    std::vector<size_t>      nrecv(nunits, 0);
+    std::vector<size_t>      send_displs(nunits, 0);
+    std::vector<size_t>      recv_displs(nunits, 0);
+    for (auto unit : units) {
+      nsend[unit] += 1;
+    }
+    if (dart_alltoall(
+          nsend.data(),
+          nrecv.data(),
+          1,
+          dash::dart_datatype<size_t>::value,
+          _team->dart_id()) != DART_OK) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        context << ": exchange of element counts failed");
+    }
+    for (size_type u = 1; u < nunits; ++u) {
+      send_displs[u] = send_displs[u-1] + nsend[u-1];
+      recv_displs[u] = recv_displs[u-1] + nrecv[u-1];
+    }
+    size_type nrecv_total = recv_displs[nunits-1] + nrecv[nunits-1];
+    DASH_LOG_TRACE("UnorderedMap._exchange",
+                   "send:", units.size(), "receive:", nrecv_total);
+    // Sort elements by target unit:
+    std::vector<element_storage> send_buf(units.size());
+    std::vector<element_storage> recv_buf(nrecv_total);
+    std::vector<size_t>          send_pos(send_displs);
+    size_type                    eidx = 0;
+    for (auto it = first; it != last; ++it, ++eidx) {
+      new (&send_buf[send_pos[units[eidx]]++]) ElementType(*it);
+    }
+    // Exchange elements in a contiguous type of the element size, MPI
+    // limits counts and displacements to INT_MAX elements.
+    // Failures are agreed on before the exchange so no unit enters the
+    // collective operation alone:
+    const size_type max_exchange = std::numeric_limits<int>::max();
+    dart_datatype_t elem_dtype   = DART_TYPE_UNDEFINED;
+    int lerror = (dart_type_create_custom(sizeof(ElementType), &elem_dtype)
+                    != DART_OK ||
+                  units.size() > max_exchange ||
+                  nrecv_total  > max_exchange) ? 1 : 0;
+    int gerror = 1;
+    dart_ret_t ret = dart_allreduce(
+                       &lerror,
+                       &gerror,
+                       1,
+                       DART_TYPE_INT,
+                       DART_OP_MAX,
+                       _team->dart_id());
+    if (ret == DART_OK && gerror == 0) {
+      ret = dart_alltoallv(
+              send_buf.data(),
+              nsend.data(),
+              send_displs.data(),
+              elem_dtype,
+              recv_buf.data(),
+              nrecv.data(),
+              recv_displs.data(),
+              _team->dart_id());
+    }
+    for (auto & elem : send_buf) {
+      reinterpret_cast<ElementType *>(&elem)->~ElementType();
+    }
+    if (elem_dtype != DART_TYPE_UNDEFINED) {
+      dart_type_destroy(&elem_dtype);
+    }
+    if (lerror != 0) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        context << ": cannot exchange " <<
+        units.size() << " elements, receiving " << nrecv_total);
+    }
+    if (ret != DART_OK || gerror != 0) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        context << ": exchange of elements failed");
+    }
+    return recv_buf;
+  }
+
+  /**
+   * Insert values at the local unit, skipping values with keys already
+   * contained in local memory.
+   * Memory for all new elements is allocated in a single call of
+   * \c globmem.grow.
+   *
+   * \returns  Number of inserted elements.
+   */
+  size_type _insert_local(
+    const value_type * values,
+    size_type          nvalues)
+  {
+    DASH_LOG_TRACE("UnorderedMap._insert_local()", "nvalues:", nvalues);
+    // Number of occupied local slots including erased elements, not
+    // lsize():
+    size_type old_local_size = _local_sizes.local[0];
+    size_type local_capacity = _globmem->local_size();
+    if (old_local_size + nvalues > local_capacity) {
+      size_type ngrow = std::max<size_type>(
+                          old_local_size + nvalues - local_capacity,
+                          _local_buffer_size);
+      DASH_LOG_TRACE("UnorderedMap._insert_local",
+                     "globmem.grow(", ngrow, ")");
+      _globmem->grow(ngrow);
+    }
+    size_type ninserted = 0;
+    auto      lptr      = _globmem->lbegin() + old_local_size;
+    for (size_type v = 0; v < nvalues; ++v) {
+      auto && key = values[v].first;
+      if (_find_local(key) >= 0) {
+        continue;
+      }
+      value_type * lptr_insert = static_cast<value_type *>(lptr);
+      // Using placement new to avoid assignment/copy as value_type is
+      // const:
+      new (lptr_insert) value_type(values[v]);
+      _local_elements.push_back(lptr_insert);
+      _key_index.insert(_key_index_hash(key), key,
+                        old_local_size + ninserted);
+      ++lptr;
+      ++ninserted;
+    }
+    // Publish new local size:
+    GlobRef<Atomic<size_type>>(_local_size_gptr).fetch_add(ninserted);
+    _local_cumul_sizes[_myid] += ninserted;
+    DASH_LOG_TRACE("UnorderedMap._insert_local >", "inserted:", ninserted);
+    return ninserted;
+  }
+
+  /**
+   * Whether the element at the given unit and local offset has been
+   * erased.
+   * Erased elements at remote units are only known as of the last commit.
+   */
+  inline bool _is_erased(team_unit_t unit, index_type lidx) const
+  {
+    if (unit == _myid) {
+      return lidx < static_cast<index_type>(_local_erased.size()) &&
+             _local_erased[lidx];
+    }
+    if (_erased_lidx.empty()) {
+      return false;
+    }
+    return std::binary_search(
+             _erased_lidx.begin() + _erased_displs[unit],
+             _erased_lidx.begin() + _erased_displs[unit + 1],
+             lidx);
+  }
+
+  /**
+   * Marks the element at the given local offset as erased.
+   */
+  void _erase_local(index_type lidx)
+  {
+    DASH_LOG_TRACE("UnorderedMap._erase_local()", "lidx:", lidx);
+    DASH_ASSERT_RANGE(
+      0, lidx, static_cast<index_type>(_local_elements.size()) - 1,
+      "local offset out of range");
+    if (_is_erased(_myid, lidx)) {
+      return;
+    }
+    if (_local_erased.size() < _local_elements.size()) {
+      _local_erased.resize(_local_elements.size(), false);
+    }
+    value_type * lptr = _local_elements[lidx];
+    _key_index.erase(_key_index_hash(lptr->first), lidx);
+    lptr->~value_type();
+    _local_erased[lidx] = true;
+    ++_local_erased_size;
+    // Iterators to first element skip erased elements:
+    if (_lbegin.pos() == lidx) {
+      _lbegin = local_iterator(this, lidx);
+    }
+    if (_begin.lpos().unit == _myid && _begin.lpos().index == lidx) {
+      _begin  = iterator(this, 0);
+    }
+    DASH_LOG_TRACE("UnorderedMap._erase_local >",
+                   "local erased:", _local_erased_size);
+  }
+
+  /**
+   * Exchanges offsets of erased elements and number of elements marked for
+   * move to remote units between all units.
+   * Collective operation.
+   */
+  void _commit_erased()
+  {
+    auto nunits = _team->size();
+    // Number of elements marked for move and number of erased elements of
+    // every unit:
+    size_type lcounts[2] = { _move_elements.size(), _local_erased_size };
+    std::vector<size_type> counts(2 * nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        lcounts,
+        counts.data(),
+        2,
+        dash::dart_datatype<size_type>::value,
+        _team->dart_id()),
+      DART_OK);
+    std::vector<size_t> nerased(nunits);
+    _num_move_elements = 0;
+    _erased_displs.assign(nunits + 1, 0);
+    for (size_type u = 0; u < nunits; ++u) {
+      _num_move_elements    += counts[2 * u];
+      nerased[u]             = counts[2 * u + 1];
+      _erased_displs[u + 1]  = _erased_displs[u] + nerased[u];
+    }
+    size_type nerased_total = _erased_displs[nunits];
+    _remote_erased_size     = nerased_total - _local_erased_size;
+    _erased_lidx.clear();
+    if (nerased_total == 0) {
+      return;
+    }
+    std::vector<index_type> lerased;
+    lerased.reserve(_local_erased_size);
+    for (index_type lidx = 0; lidx < _local_erased.size(); ++lidx) {
+      if (_local_erased[lidx]) {
+        lerased.push_back(lidx);
+      }
+    }
+    _erased_lidx.resize(nerased_total);
+    DASH_ASSERT_RETURNS(
+      dart_allgatherv(
+        lerased.data(),
+        lerased.size(),
+        dash::dart_datatype<index_type>::value,
+        _erased_lidx.data(),
+        nerased.data(),
+        _erased_displs.data(),
+        _team->dart_id()),
+      DART_OK);
+  }
+
   /**
    * Insert value at specified unit.
    */
@@ -801,7 +1425,7 @@ private:
                                  ).fetch_add(1);
     size_type new_local_size   = old_local_size + 1;
     size_type local_capacity   = _globmem->local_size();
-    _local_cumul_sizes[unit]  += 1;
+    _local_cumul_sizes[_myid] += 1;
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", local_capacity);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _local_buffer_size);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", old_local_size);
@@ -827,10 +1451,17 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
-    // Convert local iterator to global iterator:
+    // Add new element to the local key index:
+    DASH_ASSERT_EQ(_local_elements.size(), old_local_size,
+                   "local key index out of sync");
+    _local_elements.push_back(lptr_insert);
+    _key_index.insert(_key_index_hash(value.first), value.first,
+                      old_local_size);
+    // Convert local iterator to global iterator, the element is stored in
+    // local memory until it is moved to its target unit:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
-                   "unit:", unit, "lidx:", old_local_size);
-    result.first  = iterator(this, unit, old_local_size);
+                   "unit:", _myid, "lidx:", old_local_size);
+    result.first  = iterator(this, _myid, old_local_size);
     result.second = true;
 
     if (unit != _myid) {
@@ -846,7 +1477,8 @@ private:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _begin");
     _begin        = iterator(this, 0);
     DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _end");
-    _end          = iterator(this, new_size);
+    _end          = iterator(this, _remote_size + new_local_size);
+    _lend         = local_iterator(this, new_local_size);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _begin);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _end);
     DASH_LOG_DEBUG("UnorderedMap._insert_at >",
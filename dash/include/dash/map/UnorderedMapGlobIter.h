@@ -296,7 +296,7 @@ public:
       // Iterator position does not point to local element
       return local_iterator(nullptr);
     }
-    return (_map->lbegin() + _idx_local_idx);
+    return local_iterator(_map, _idx_local_idx);
   }
 
   /**
@@ -308,7 +308,7 @@ public:
       // Iterator position does not point to local element
       return local_iterator(nullptr);
     }
-    return (_map->lbegin() + _idx_local_idx);
+    return local_iterator(_map, _idx_local_idx);
   }
 
   /**
@@ -495,23 +495,41 @@ private:
       //   --> UnorderedMapGlobIter(map, 0) -> (gidx:0, unit:2, lidx:0)
       //
       _idx           += offset;
-      _idx_local_idx = _idx;
-      auto & l_cumul_sizes = _map->_local_cumul_sizes;
-      // Find unit at global offset:
-      while (_idx >= l_cumul_sizes[_idx_unit_id] &&
-             _idx_unit_id < l_cumul_sizes.size() - 1) {
-        DASH_LOG_TRACE("UnorderedMapGlobIter.increment",
-                       "local cumulative size of unit", _idx_unit_id, ":",
-                       l_cumul_sizes[_idx_unit_id]);
-        _idx_unit_id++;
-      }
-      if (_idx_unit_id > 0) {
-        _idx_local_idx = _idx - l_cumul_sizes[_idx_unit_id-1];
+      update_lpos();
+      // Skip erased elements:
+      while (_map->_is_erased(_idx_unit_id, _idx_local_idx)) {
+        ++_idx;
+        update_lpos();
       }
     }
     DASH_LOG_TRACE("UnorderedMapGlobIter.increment >", *this);
   }
 
+  /**
+   * Resolve unit and local offset at the iterator's global position,
+   * starting at the current unit.
+   */
+  void update_lpos()
+  {
+    _idx_local_idx = _idx;
+    auto & l_cumul_sizes = _map->_local_cumul_sizes;
+    // Find unit at global offset, moving towards the front:
+    while (_idx_unit_id > 0 && _idx < l_cumul_sizes[_idx_unit_id-1]) {
+      _idx_unit_id--;
+    }
+    // Find unit at global offset, moving towards the back:
+    while (_idx >= l_cumul_sizes[_idx_unit_id] &&
+           _idx_unit_id < l_cumul_sizes.size() - 1) {
+      DASH_LOG_TRACE("UnorderedMapGlobIter.increment",
+                     "local cumulative size of unit", _idx_unit_id, ":",
+                     l_cumul_sizes[_idx_unit_id]);
+      _idx_unit_id++;
+    }
+    if (_idx_unit_id > 0) {
+      _idx_local_idx = _idx - l_cumul_sizes[_idx_unit_id-1];
+    }
+  }
+
   /**
    * Decrement pointer by specified position offset.
    */
@@ -525,9 +543,13 @@ private:
     if (offset < 0) {
       increment(-offset);
     } else if (offset > 0) {
-      // TODO
-      _idx           -= offset;
-      _idx_local_idx  = _idx;
+      _idx -= offset;
+      update_lpos();
+      // Skip erased elements towards the front:
+      while (_idx > 0 && _map->_is_erased(_idx_unit_id, _idx_local_idx)) {
+        --_idx;
+        update_lpos();
+      }
     }
     DASH_LOG_TRACE("UnorderedMapGlobIter.decrement >", *this);
   }
@@ -97,6 +97,7 @@ public:
   {
     DASH_LOG_TRACE("UnorderedMapLocalIter(map,lpos)()");
     DASH_LOG_TRACE_VAR("UnorderedMapLocalIter(map,lpos)", _idx);
+    skip_erased();
     DASH_LOG_TRACE("UnorderedMapLocalIter(map,lpos) >");
   }
 
@@ -164,9 +165,8 @@ public:
     if (_is_nullptr) {
       return nullptr;
     }
-    // TODO: Must be extended for correctness: _idx refers to local iteration
-    //       space, not local memory space. Undefined behaviour if local
-    //       memory space has gaps, e.g. after erasing elements.
+    // Erased elements are skipped in increment and decrement, so _idx
+    // always refers to an element in local memory space:
     local_iter_t l_it = _map->globmem().lbegin();
     return pointer(l_it + static_cast<index_type>(_idx));
   }
@@ -180,9 +180,6 @@ public:
   {
     typedef typename map_t::local_node_iterator local_iter_t;
     DASH_ASSERT(!_is_nullptr);
-    // TODO: Must be extended for correctness: _idx refers to local iteration
-    //       space, not local memory space. Undefined behaviour if local
-    //       memory space has gaps, e.g. after erasing elements.
     local_iter_t l_it = _map->globmem().lbegin();
     return *pointer(l_it + static_cast<index_type>(_idx));
   }
@@ -361,6 +358,7 @@ private:
                    "lidx:",   _idx,
                    "offset:", offset);
     _idx += offset;
+    skip_erased();
     DASH_LOG_TRACE("UnorderedMapLocalIter.increment >");
   }
 
@@ -374,9 +372,23 @@ private:
                    "lidx:",   _idx,
                    "offset:", -offset);
     _idx -= offset;
+    // Skip erased elements towards the front:
+    while (_idx > 0 && _map->_is_erased(_map->_myid, _idx)) {
+      --_idx;
+    }
     DASH_LOG_TRACE("UnorderedMapLocalIter.decrement >");
   }
 
+  /**
+   * Advance pointer to the next element that has not been erased.
+   */
+  inline void skip_erased()
+  {
+    while (_map->_is_erased(_map->_myid, _idx)) {
+      ++_idx;
+    }
+  }
+
 private:
   /// Pointer to referenced map instance.
   map_t                  * _map           = nullptr;
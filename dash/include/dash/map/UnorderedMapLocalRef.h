@@ -269,18 +269,10 @@ public:
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    iterator found = std::find_if(
-                       first, last,
-                       [&](const value_type & v) {
-                         DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                        v.first, "==?", key);
-                         return pred(v.first, key);
-                       });
+    auto     lidx  = _map->_find_local(key);
+    iterator found = (lidx < 0)
+                     ? end()
+                     : iterator(_map, lidx);
     DASH_LOG_TRACE("UnorderedMapLocalRef.find >", found);
     return found;
   }
@@ -288,18 +280,10 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find() const", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    const_iterator found = std::find_if(
-                             first, last,
-                             [&](const value_type & v) {
-                               DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                              v.first, "==?", key);
-                               return pred(v.first, key);
-                             });
+    auto           lidx  = _map->_find_local(key);
+    const_iterator found = (lidx < 0)
+                           ? end()
+                           : const_iterator(_map, lidx);
     DASH_LOG_TRACE("UnorderedMapLocalRef.find const >", found);
     return found;
   }
@@ -345,8 +329,6 @@ public:
       auto inserted = _map->_insert_at(unit, value);
       result.first  = inserted.first.local();
       result.second = inserted.second;
-      // Updated local end iterator of the referenced map:
-      _map->_lend   = _map->_lbegin + _map->lsize();
       DASH_LOG_TRACE("UnorderedMapLocalRef.insert", "updated map.lend:",
                      _map->_lend);
     }
@@ -376,8 +358,11 @@ public:
     const_iterator it)
   {
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase()", "iterator:", it);
-    erase(*it.first);
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >");
+    _map->_erase_local(it.pos());
+    iterator next = it;
+    ++next;
+    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >", next);
+    return next;
   }
 
   size_type erase(
@@ -385,16 +370,14 @@ public:
     const key_type & key)
   {
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase()", "key:", key);
-    auto b_idx  = bucket(key);
-    auto b_size = bucket_size(b_idx);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase", b_idx);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase", b_size);
-
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMapLocalRef.erase is not implemented.");
-
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >");
+    size_type nerased = 0;
+    auto      lidx    = _map->_find_local(key);
+    if (lidx >= 0) {
+      _map->_erase_local(lidx);
+      nerased = 1;
+    }
+    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >", nerased);
+    return nerased;
   }
 
   iterator erase(
@@ -407,9 +390,10 @@ public:
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase()", first);
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase()", last);
     for (auto it = first; it != last; ++it) {
-      erase(*it.first);
+      _map->_erase_local(it.pos());
     }
     DASH_LOG_DEBUG("UnorderedMapLocalRef.erase(first,last) >");
+    return last;
   }
 
   //////////////////////////////////////////////////////////////////////////
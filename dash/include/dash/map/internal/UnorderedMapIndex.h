@@ -0,0 +1,377 @@
+#ifndef DASH__MAP__INTERNAL__UNORDERED_MAP_INDEX_H__INCLUDED
+#define DASH__MAP__INTERNAL__UNORDERED_MAP_INDEX_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Array.h>
+#include <dash/Onesided.h>
+#include <dash/Exception.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+namespace dash {
+namespace internal {
+
+/**
+ * Slot in the hash index of elements in a unit's local memory space.
+ */
+template<typename KeyType, typename IndexType>
+struct UnorderedMapIndexSlot
+{
+  /// Hash code of the element's key.
+  std::size_t hash;
+  /// Offset of the element in local memory of its unit, -1 if slot is
+  /// empty, -2 if the slot's element has been erased.
+  IndexType   lidx;
+  /// Copy of the element's key.
+  KeyType     key;
+};
+
+/**
+ * Open-addressing hash index of the elements stored in the local memory
+ * of every unit in a team.
+ *
+ * Every unit maintains an authoritative index of its local elements which
+ * is updated on every local insertion. The local indices are published to
+ * other units in a symmetric global table on \c commit so that elements
+ * can be resolved in their owner's memory in \c O(1) expected one-sided
+ * operations.
+ * Slots store a copy of the element's key next to its hash code and local
+ * offset, so keys of candidates are compared in the fetched slots and a
+ * lookup at a remote unit usually requires a single get operation.
+ *
+ * Elements inserted after the last \c commit are only visible to the
+ * inserting unit.
+ */
+template<
+  typename KeyType,
+  typename IndexType,
+  typename SizeType >
+class UnorderedMapIndex
+{
+private:
+  typedef UnorderedMapIndex<KeyType, IndexType, SizeType>
+    self_t;
+
+public:
+  typedef KeyType                                           key_type;
+  typedef IndexType                                       index_type;
+  typedef SizeType                                         size_type;
+  typedef UnorderedMapIndexSlot<KeyType, IndexType>        slot_type;
+
+private:
+  /// Minimum number of slots in a unit's index.
+  static const size_type     min_capacity     = 16;
+  /// Number of slots fetched from remote index tables in a single get
+  /// operation.
+  static const size_type     remote_window    = 8;
+  /// Local offset in empty slots.
+  static const index_type    empty_lidx       = -1;
+  /// Local offset in slots of erased elements.
+  static const index_type    erased_lidx      = -2;
+
+public:
+  UnorderedMapIndex()
+  : _lslots(min_capacity, empty_slot())
+  { }
+
+  UnorderedMapIndex(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Collective allocation of the global index table for units in the
+   * specified team.
+   */
+  void allocate(dash::Team & team)
+  {
+    _team = &team;
+    clear();
+    commit();
+  }
+
+  /**
+   * Collective deallocation of the global index table.
+   */
+  void deallocate()
+  {
+    if (_gcapacity > 0) {
+      _gslots.deallocate();
+    }
+    _gcapacity = 0;
+    _team      = nullptr;
+    clear();
+  }
+
+  /**
+   * Removes all entries from the local index.
+   * Not collective, does not affect the published global table.
+   */
+  void clear()
+  {
+    _lslots.assign(min_capacity, empty_slot());
+    _lsize    = 0;
+    _lerased  = 0;
+  }
+
+  /**
+   * Number of elements in the local index.
+   */
+  inline size_type size() const noexcept
+  {
+    return _lsize;
+  }
+
+  /**
+   * Number of slots in the local index.
+   */
+  inline size_type capacity() const noexcept
+  {
+    return _lslots.size();
+  }
+
+  /**
+   * Adds an element at the given local offset to the local index.
+   * Not collective.
+   */
+  void insert(std::size_t hash, const key_type & key, index_type lidx)
+  {
+    // Keep load factor including erased slots below 1/2, rehashing
+    // drops erased slots:
+    size_type cap = _lslots.size();
+    if ((_lsize + _lerased + 1) * 2 > cap) {
+      rehash((_lsize + 1) * 4 > cap ? cap * 2 : cap);
+    }
+    if (_insert(_lslots, hash, key, lidx)) {
+      --_lerased;
+    }
+    ++_lsize;
+  }
+
+  /**
+   * Removes the element at the given local offset from the local index.
+   * The element's slot is marked as erased so probe sequences of other
+   * elements remain intact.
+   * Not collective.
+   *
+   * \returns  \c true if the element has been found in the index.
+   */
+  bool erase(std::size_t hash, index_type lidx)
+  {
+    size_type cap = _lslots.size();
+    size_type pos = slot_pos(hash, cap);
+    for (size_type probe = 0; probe < cap; ++probe) {
+      slot_type & slot = _lslots[pos];
+      if (slot.lidx == empty_lidx) {
+        break;
+      }
+      if (slot.lidx == lidx) {
+        slot.lidx = erased_lidx;
+        --_lsize;
+        ++_lerased;
+        return true;
+      }
+      pos = (pos + 1) & (cap - 1);
+    }
+    return false;
+  }
+
+  /**
+   * Resolves the local offset of an element in the local index.
+   *
+   * \returns  Local offset of the first element with the given hash code
+   *           whose key satisfies the predicate, or -1 if no such element
+   *           exists.
+   */
+  template<typename UnaryPredicate>
+  index_type find_local(
+    std::size_t      hash,
+    UnaryPredicate   match) const
+  {
+    size_type cap = _lslots.size();
+    size_type pos = slot_pos(hash, cap);
+    for (size_type probe = 0; probe < cap; ++probe) {
+      const slot_type & slot = _lslots[pos];
+      if (slot.lidx == empty_lidx) {
+        return -1;
+      }
+      if (slot.lidx >= 0 && slot.hash == hash && match(slot.key)) {
+        return slot.lidx;
+      }
+      pos = (pos + 1) & (cap - 1);
+    }
+    return -1;
+  }
+
+  /**
+   * Resolves the local offset of an element in the published index of the
+   * specified unit.
+   * Slots are fetched in windows of \c remote_window slots including the
+   * keys of candidates, so a lookup usually requires a single get
+   * operation.
+   *
+   * \returns  Offset in the local memory of the given unit of the first
+   *           element with the given hash code whose key satisfies the
+   *           predicate, or -1 if no such element exists.
+   */
+  template<typename UnaryPredicate>
+  index_type find(
+    team_unit_t      unit,
+    std::size_t      hash,
+    UnaryPredicate   match) const
+  {
+    DASH_ASSERT_MSG(_gcapacity > 0, "Global index table not allocated");
+    slot_type slots[remote_window];
+    size_type cap  = _gcapacity;
+    size_type pos  = slot_pos(hash, cap);
+    size_type left = cap;
+    while (left > 0) {
+      // Do not read past the end of the unit's table:
+      size_type nslots = std::min<size_type>(
+                           std::min<size_type>(remote_window, left),
+                           cap - pos);
+      dart_gptr_t gptr_slots = (_gslots.begin() +
+                                (unit * cap + pos)).dart_gptr();
+      dash::internal::get_blocking(gptr_slots, slots, nslots);
+      for (size_type s = 0; s < nslots; ++s) {
+        if (slots[s].lidx == empty_lidx) {
+          return -1;
+        }
+        if (slots[s].lidx >= 0 &&
+            slots[s].hash == hash && match(slots[s].key)) {
+          return slots[s].lidx;
+        }
+      }
+      left -= nslots;
+      pos   = (pos + nslots) & (cap - 1);
+    }
+    return -1;
+  }
+
+  /**
+   * Publishes the local index of all units in the global index table.
+   * Collective operation.
+   *
+   * The global table is only reallocated if the maximum capacity of local
+   * indices changed.
+   */
+  void commit()
+  {
+    DASH_LOG_TRACE("UnorderedMapIndex.commit()");
+    DASH_ASSERT_MSG(_team != nullptr, "Global index table not allocated");
+    size_type lcap = _lslots.size();
+    size_type gcap = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &lcap,
+        &gcap,
+        1,
+        dash::dart_datatype<size_type>::value,
+        DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    if (gcap != lcap) {
+      rehash(gcap);
+    }
+    if (gcap != _gcapacity) {
+      if (_gcapacity > 0) {
+        _gslots.deallocate();
+      }
+      _gslots.allocate(gcap * _team->size(), dash::BLOCKED, *_team);
+      _gcapacity = gcap;
+    }
+    std::copy(_lslots.begin(), _lslots.end(), _gslots.lbegin());
+    _team->barrier();
+    DASH_LOG_TRACE("UnorderedMapIndex.commit >",
+                   "local size:", _lsize, "capacity:", _gcapacity);
+  }
+
+private:
+  static inline slot_type empty_slot() noexcept
+  {
+    slot_type slot = slot_type();
+    slot.lidx      = empty_lidx;
+    return slot;
+  }
+
+  /**
+   * Slot position of a hash code in a table with the given capacity.
+   * Fibonacci hashing distributes consecutive hash codes such as
+   * the identity hashes of integral keys evenly.
+   */
+  static inline size_type slot_pos(std::size_t hash, size_type cap) noexcept
+  {
+    return static_cast<size_type>(
+             (static_cast<uint64_t>(hash) * 11400714819323198485ull)
+             >> (64 - log2(cap)));
+  }
+
+  static inline int log2(size_type cap) noexcept
+  {
+    int l = 0;
+    while ((static_cast<size_type>(1) << l) < cap) { ++l; }
+    return l;
+  }
+
+  /**
+   * Adds an entry to the first empty or erased slot in its probe sequence.
+   *
+   * \returns  \c true if the slot of an erased element has been reused.
+   */
+  static bool _insert(
+    std::vector<slot_type> & slots,
+    std::size_t              hash,
+    const key_type         & key,
+    index_type               lidx)
+  {
+    size_type cap = slots.size();
+    size_type pos = slot_pos(hash, cap);
+    while (slots[pos].lidx >= 0) {
+      pos = (pos + 1) & (cap - 1);
+    }
+    bool reused = (slots[pos].lidx == erased_lidx);
+    slots[pos].hash = hash;
+    slots[pos].lidx = lidx;
+    slots[pos].key  = key;
+    return reused;
+  }
+
+  void rehash(size_type capacity)
+  {
+    DASH_LOG_TRACE("UnorderedMapIndex.rehash()",
+                   "capacity:", _lslots.size(), "->", capacity);
+    std::vector<slot_type> slots(capacity, empty_slot());
+    for (const auto & slot : _lslots) {
+      if (slot.lidx >= 0) {
+        _insert(slots, slot.hash, slot.key, slot.lidx);
+      }
+    }
+    _lslots.swap(slots);
+    _lerased = 0;
+  }
+
+private:
+  /// Team containing all units sharing the global index table.
+  dash::Team                   * _team       = nullptr;
+  /// Authoritative index of elements in local memory.
+  std::vector<slot_type>         _lslots;
+  /// Number of elements in the local index.
+  size_type                      _lsize      = 0;
+  /// Number of slots of erased elements in the local index.
+  size_type                      _lerased    = 0;
+  /// Published index tables of all units, one block of \c _gcapacity
+  /// slots per unit.
+  dash::Array<slot_type>         _gslots;
+  /// Number of slots per unit in the global index table.
+  size_type                      _gcapacity  = 0;
+};
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__MAP__INTERNAL__UNORDERED_MAP_INDEX_H__INCLUDED
@@ -46,6 +46,7 @@ private:
 
   static std::unordered_map<std::string, callback_fun>  callbacks_;
   static std::unordered_map<std::string, std::string>   config_values_;
+  static size_t                                         version_;
 
 private:
   static std::string get_str(
@@ -66,6 +67,7 @@ private:
   {
     DASH_LOG_TRACE("util::Config::set_str >", key, "->", value);
     Config::config_values_[key] = value;
+    ++Config::version_;
   }
 
 
@@ -143,6 +145,7 @@ public:
     std::string value_s = ss.str();
 
     Config::config_values_[key] = value_s;
+    ++Config::version_;
     Config::on_change(key, value_s);
   }
 
@@ -182,6 +185,15 @@ public:
     return true;
   }
 
+  /**
+   * Number of changes of configuration values, values derived from the
+   * configuration can be cached until the version changes.
+   */
+  static inline size_t version()
+  {
+    return Config::version_;
+  }
+
   static void init();
 
 private:
@@ -41,6 +41,7 @@ namespace dash {
 #include <dash/Onesided.h>
 
 #include <dash/LaunchPolicy.h>
+#include <dash/Execution.h>
 
 #include <dash/Container.h>
 #include <dash/Shared.h>
@@ -49,10 +50,13 @@ namespace dash {
 #include <dash/Algorithm.h>
 #include <dash/Atomic.h>
 #include <dash/Mutex.h>
+#include <dash/SharedMutex.h>
+#include <dash/ReadCache.h>
 
 #include <dash/Pattern.h>
 
 #include <dash/halo/HaloMatrixWrapper.h>
+#include <dash/halo/StencilOperator.h>
 
 #include <dash/util/BenchmarkParams.h>
 #include <dash/util/Config.h>
@@ -10,6 +10,8 @@
 
 #include <dash/internal/Annotation.h>
 
+#include <dash/dart/if/dart_config.h>
+
 
 namespace dash {
   static bool _initialized   = false;
@@ -34,6 +36,15 @@ void dash::init(int * argc, char ** *argv)
   DASH_LOG_DEBUG("dash::init", "dash::util::Config::init()");
   dash::util::Config::init();
 
+  // Initial size of the pool used by dart_memalloc, e.g.
+  // DASH_LOCAL_ALLOC_SIZE=64M:
+  if (dash::util::Config::is_set("DASH_LOCAL_ALLOC_SIZE_BYTES")) {
+    dart_config_t * dart_cfg;
+    dart_config(&dart_cfg);
+    dart_cfg->local_alloc_size =
+      dash::util::Config::get<size_t>("DASH_LOCAL_ALLOC_SIZE_BYTES");
+  }
+
 #if defined(DASH_ENABLE_THREADSUPPORT)
   DASH_LOG_DEBUG("dash::init", "dart_init_thread()");
   dart_thread_support_level_t provided_mt;
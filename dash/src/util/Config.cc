@@ -21,6 +21,7 @@ namespace util {
 
 std::unordered_map<std::string, Config::callback_fun>  Config::callbacks_;
 std::unordered_map<std::string, std::string>           Config::config_values_;
+size_t                                                 Config::version_ = 0;
 
 void Config::init()
 {
@@ -99,6 +100,7 @@ void Config::set(
 {
   DASH_LOG_TRACE("util::Config::set(string,string)", key, value);
   Config::config_values_[key] = value;
+  ++Config::version_;
   Config::on_change(key, value);
 
   // Parse boolean values:
@@ -57,3 +57,58 @@ TEST_F(AccumulateTest, StringConcatOperaton) {
     ASSERT_STREQ("1-2-3-4", result.c_str());
   }
 }
+
+TEST_F(AccumulateTest, AllreduceFloatingPoint) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  double value                = 0.25;
+
+  dash::Array<double> target(num_elem_total, dash::BLOCKED);
+
+  dash::fill(target.begin(), target.end(), value);
+
+  dash::barrier();
+
+  double result = dash::accumulate_all(target.begin(),
+                                       target.end(),
+                                       0.5);
+
+  EXPECT_DOUBLE_EQ(0.5 + num_elem_total * value, result);
+
+  // Range ending in the first unit's block, other units have empty local
+  // ranges:
+  double max = dash::accumulate_all(target.begin(),
+                                    target.begin() + 10,
+                                    -1.0,
+                                    dash::max<double>());
+  EXPECT_DOUBLE_EQ(value, max);
+}
+
+TEST_F(AccumulateTest, CustomOperation) {
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < num_elem_local; l++) {
+    target.local[l] = static_cast<int>(target.pattern().global(l));
+  }
+
+  dash::barrier();
+
+  // Operation without DART equivalent, partial results are gathered:
+  auto op = [](long a, long b) { return a > b ? a : b; };
+  long result = dash::accumulate(target.begin(),
+                                 target.end(),
+                                 -1l,
+                                 op);
+  if (dash::myid() == 0) {
+    EXPECT_EQ_U(num_elem_total - 1, result);
+  }
+
+  long result_all = dash::accumulate_all(target.begin(),
+                                         target.end(),
+                                         -1l,
+                                         op);
+  EXPECT_EQ_U(num_elem_total - 1, result_all);
+}
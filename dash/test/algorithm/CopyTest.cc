@@ -356,6 +356,43 @@ TEST_F(CopyTest, BlockingGlobalToLocalBarrierUnaligned)
   }
 }
 
+TEST_F(CopyTest, BlockingGlobalToLocalAllUnitsPipelined)
+{
+  const size_t num_elem_per_unit = 111;
+  size_t       num_elem_total    = _dash_size * num_elem_per_unit;
+  // Range starts and ends within the blocks of the first and last unit:
+  size_t       start_index       = num_elem_per_unit / 3;
+  size_t       num_elem_copy     = num_elem_total - 2 * start_index;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = (dash::myid().id * 1000) + l;
+  }
+  array.barrier();
+
+  // Window of a single request in flight, with and without deferred
+  // copying of node-local segments:
+  for (int owner_computes = 0; owner_computes < 2; ++owner_computes) {
+    dash::util::Config::set("DASH_COPY_MAX_REQUESTS",   1);
+    dash::util::Config::set("DASH_COPY_OWNER_COMPUTES", owner_computes);
+
+    std::vector<int> local_copy(num_elem_copy, -1);
+    int * dest_last = dash::copy(array.begin() + start_index,
+                                 array.begin() + start_index + num_elem_copy,
+                                 local_copy.data());
+    EXPECT_EQ_U(local_copy.data() + num_elem_copy, dest_last);
+    for (size_t l = 0; l < num_elem_copy; ++l) {
+      size_t g = start_index + l;
+      int expected = (g / num_elem_per_unit) * 1000 + (g % num_elem_per_unit);
+      EXPECT_EQ_U(expected, local_copy[l]);
+    }
+  }
+  dash::util::Config::set("DASH_COPY_MAX_REQUESTS",   0);
+  dash::util::Config::set("DASH_COPY_OWNER_COMPUTES", 0);
+
+  array.barrier();
+}
+
 TEST_F(CopyTest, BlockingLocalToGlobalBlock)
 {
   // Copy all elements contained in a single, continuous block.
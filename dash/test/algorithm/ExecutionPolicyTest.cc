@@ -0,0 +1,187 @@
+
+#include "ExecutionPolicyTest.h"
+
+#include <dash/Array.h>
+#include <dash/Execution.h>
+#include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/ForEach.h>
+#include <dash/algorithm/Generate.h>
+#include <dash/algorithm/MinMax.h>
+#include <dash/algorithm/Transform.h>
+
+#include <vector>
+
+
+TEST_F(ExecutionPolicyTest, PolicyConfiguration)
+{
+  auto policy = dash::execution::par.with_threads(3).with_chunk_size(64);
+  EXPECT_EQ_U(3,  policy.num_threads());
+  EXPECT_EQ_U(64, policy.chunk_size());
+  EXPECT_FALSE_U(policy.config().unsequenced);
+  // Defaults are not modified:
+  EXPECT_EQ_U(0,  dash::execution::par.num_threads());
+  EXPECT_EQ_U(0,  dash::execution::par.chunk_size());
+
+  EXPECT_TRUE_U(dash::execution::par_unseq.with_threads(2)
+                                          .config().unsequenced);
+  EXPECT_EQ_U(1, dash::execution::seq.num_threads());
+
+  auto async_policy = dash::execution::async(policy);
+  EXPECT_EQ_U(3,  async_policy.num_threads());
+  EXPECT_EQ_U(64, async_policy.chunk_size());
+  EXPECT_TRUE_U(async_policy.launch_policy() == dash::launch::async);
+
+  EXPECT_TRUE_U(dash::execution::is_execution_policy<
+                  decltype(async_policy)>::value);
+  EXPECT_FALSE_U(dash::execution::is_execution_policy<int>::value);
+}
+
+TEST_F(ExecutionPolicyTest, FillGenerateForEach)
+{
+  const size_t num_local_elem = 1031;
+  dash::Array<int> array(num_local_elem * dash::size());
+
+  dash::fill(dash::execution::seq, array.begin(), array.end(), 3);
+  array.barrier();
+  for (auto l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(3, array.local[l]);
+  }
+
+  // Chunks smaller than the local range:
+  dash::generate(dash::execution::par.with_threads(2).with_chunk_size(100),
+                 array.begin(), array.end(), []() { return 5; });
+  array.barrier();
+  for (auto l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(5, array.local[l]);
+  }
+
+  dash::for_each(dash::execution::par_unseq.with_chunk_size(64),
+                 array.begin(), array.end(), [](int & v) { v *= 2; });
+  for (auto l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(10, array.local[l]);
+  }
+}
+
+TEST_F(ExecutionPolicyTest, WithIndex)
+{
+  const size_t num_local_elem = 1031;
+  dash::Array<long> array(num_local_elem * dash::size());
+
+  dash::generate_with_index(
+    dash::execution::par.with_threads(2).with_chunk_size(100),
+    array.begin(), array.end(),
+    [](long gidx) { return gidx; });
+  array.barrier();
+  for (auto l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(array.pattern().global(l), array.local[l]);
+  }
+
+  dash::for_each_with_index(
+    dash::execution::par.with_chunk_size(64),
+    array.begin(), array.end(),
+    [](long & v, long gidx) { v += gidx; });
+  for (auto l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(2 * array.pattern().global(l), array.local[l]);
+  }
+}
+
+TEST_F(ExecutionPolicyTest, TransformLocal)
+{
+  const size_t num_local_elem = 517;
+  dash::Array<int> array_a(num_local_elem * dash::size());
+  dash::Array<int> array_b(num_local_elem * dash::size());
+  dash::Array<int> array_c(num_local_elem * dash::size());
+
+  for (auto l = 0; l < array_a.lsize(); ++l) {
+    array_a.local[l] = array_a.pattern().global(l);
+    array_b.local[l] = 1000;
+    array_c.local[l] = 0;
+  }
+  array_a.barrier();
+
+  auto out_last = dash::transform(
+                    dash::execution::par.with_chunk_size(50),
+                    array_a.begin(), array_a.end(),
+                    array_b.begin(),
+                    array_c.begin(),
+                    dash::plus<int>());
+  EXPECT_EQ_U(array_c.end(), out_last);
+  array_c.barrier();
+
+  for (auto l = 0; l < array_c.lsize(); ++l) {
+    EXPECT_EQ_U(array_a.pattern().global(l) + 1000, array_c.local[l]);
+  }
+}
+
+TEST_F(ExecutionPolicyTest, Reductions)
+{
+  const size_t num_local_elem = 2053;
+  dash::Array<long> array(num_local_elem * dash::size());
+  long num_elem = array.size();
+
+  dash::generate_with_index(array.begin(), array.end(),
+                            [&](long gidx) {
+                              // Unique minimum in the middle of the range:
+                              return (gidx - num_elem / 2) *
+                                     (gidx - num_elem / 2);
+                            });
+  array.barrier();
+
+  auto min_seq = dash::min_element(dash::execution::seq,
+                                   array.begin(), array.end());
+  auto min_par = dash::min_element(
+                   dash::execution::par.with_threads(2).with_chunk_size(99),
+                   array.begin(), array.end());
+  EXPECT_EQ_U(num_elem / 2, min_seq - array.begin());
+  EXPECT_EQ_U(num_elem / 2, min_par - array.begin());
+
+  long expected = 0;
+  for (long g = 0; g < num_elem; ++g) {
+    expected += (g - num_elem / 2) * (g - num_elem / 2);
+  }
+  long sum_seq = dash::accumulate(dash::execution::seq,
+                                  array.begin(), array.end(), 0L);
+  long sum_par = dash::accumulate(
+                   dash::execution::par_unseq.with_chunk_size(128),
+                   array.begin(), array.end(), 0L, dash::plus<long>());
+  if (dash::myid() == 0) {
+    EXPECT_EQ_U(expected, sum_seq);
+    EXPECT_EQ_U(expected, sum_par);
+  }
+}
+
+TEST_F(ExecutionPolicyTest, AsyncPolicy)
+{
+  const size_t num_local_elem = 100;
+  dash::Array<int> array(num_local_elem * dash::size());
+
+  // Launched as thread if DASH is multithreaded, executed synchronously
+  // otherwise:
+  auto fut_fill = dash::fill(dash::execution::async(dash::execution::par),
+                             array.begin(), array.end(), 2);
+  fut_fill.wait();
+  array.barrier();
+
+  auto fut_sum = dash::accumulate(
+                   dash::execution::async(dash::execution::seq,
+                                          dash::launch::sync),
+                   array.begin(), array.end(), 0);
+  int sum = fut_sum.get();
+  if (dash::myid() == 0) {
+    EXPECT_EQ_U(2 * array.size(), sum);
+  }
+
+  // Copy of the next unit's block, delegates to dash::copy_async:
+  std::vector<int> buf(num_local_elem);
+  auto next  = (dash::myid() + 1) % dash::size();
+  auto first = array.begin() + next * num_local_elem;
+  auto fut_copy = dash::copy(dash::execution::async(dash::execution::par),
+                             first, first + num_local_elem, buf.data());
+  EXPECT_EQ_U(buf.data() + num_local_elem, fut_copy.get());
+  for (auto v : buf) {
+    EXPECT_EQ_U(2, v);
+  }
+  array.barrier();
+}
@@ -0,0 +1,18 @@
+#ifndef DASH__TEST__EXECUTION_POLICY_TEST_H_
+#define DASH__TEST__EXECUTION_POLICY_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for execution policies of DASH algorithms
+ */
+class ExecutionPolicyTest : public dash::test::TestBase {
+protected:
+
+  ExecutionPolicyTest() {
+  }
+
+  virtual ~ExecutionPolicyTest() {
+  }
+};
+#endif // DASH__TEST__EXECUTION_POLICY_TEST_H_
@@ -166,3 +166,18 @@ TEST_F(ForEachTest, Lambdas)
                  });
 }
 
+
+TEST_F(ForEachTest, SequentialByDefault)
+{
+    // Invoked without synchronization, in order of local elements:
+    std::vector<index_t> indices;
+    Array_t array(_num_elem);
+    dash::for_each_with_index(
+        array.begin(),
+        array.end(),
+        [&](const Element_t &, index_t idx) { indices.push_back(idx); });
+    ASSERT_EQ_U(array.lsize(), indices.size());
+    for (size_t l = 0; l < indices.size(); ++l) {
+      EXPECT_EQ_U(array.pattern().global(l), indices[l]);
+    }
+}
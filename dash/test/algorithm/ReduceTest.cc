@@ -0,0 +1,104 @@
+
+#include "ReduceTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/Fill.h>
+
+#include <complex>
+
+
+TEST_F(ReduceTest, NativeOperation) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  dash::fill(target.begin(), target.end(), 2);
+  dash::barrier();
+
+  // Result is returned at all units:
+  int sum = dash::reduce(target.begin(), target.end(), 1);
+  EXPECT_EQ_U(1 + 2 * num_elem_total, sum);
+
+  int max = dash::reduce(target.begin(), target.end(), -1,
+                         dash::max<int>());
+  EXPECT_EQ_U(2, max);
+}
+
+TEST_F(ReduceTest, UserDefinedType) {
+  typedef std::complex<double> value_t;
+
+  const size_t num_elem_local = 17;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<value_t> target(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_elem_local; l++) {
+    target.local[l] = value_t(1.0, target.pattern().global(l));
+  }
+  dash::barrier();
+
+  // No native DART type, operation and type are registered in DART:
+  value_t sum = dash::reduce(target.begin(), target.end(),
+                             value_t(0.5, 0.0),
+                             dash::plus<value_t>());
+  EXPECT_DOUBLE_EQ(0.5 + num_elem_total, sum.real());
+  EXPECT_DOUBLE_EQ((num_elem_total * (num_elem_total - 1)) / 2,
+                   sum.imag());
+}
+
+TEST_F(ReduceTest, TransformReduceArgMax) {
+  struct value_index {
+    double value;
+    long   index;
+  };
+
+  const size_t num_elem_local = 23;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<long> target(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_elem_local; l++) {
+    target.local[l] = target.pattern().global(l);
+  }
+  dash::barrier();
+
+  // Distance to the center of the range, maximum at the first element:
+  long center = num_elem_total / 2;
+  value_index init { -1.0, -1 };
+  auto argmax = dash::transform_reduce(
+                  target.begin(), target.end(),
+                  init,
+                  [](const value_index & a, const value_index & b) {
+                    return (a.value > b.value ||
+                            (a.value == b.value && a.index < b.index))
+                           ? a : b;
+                  },
+                  [center](long gidx) {
+                    return value_index {
+                             static_cast<double>(std::abs(gidx - center)),
+                             gidx };
+                  });
+  EXPECT_EQ_U(0, argmax.index);
+  EXPECT_DOUBLE_EQ(center, argmax.value);
+}
+
+TEST_F(ReduceTest, EmptyLocalRanges) {
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_elem_local; l++) {
+    target.local[l] = target.pattern().global(l);
+  }
+  dash::barrier();
+
+  // Range in the first unit's block, other units have empty local ranges:
+  auto op = [](long a, long b) { return a + b; };
+  long sum = dash::reduce(target.begin(), target.begin() + 5, 100l, op);
+  EXPECT_EQ_U(110, sum);
+
+  long sum_sq = dash::transform_reduce(
+                  target.begin(), target.begin() + 5, 0l,
+                  dash::plus<long>(),
+                  [](int v) { return static_cast<long>(v) * v; });
+  EXPECT_EQ_U(30, sum_sq);
+}
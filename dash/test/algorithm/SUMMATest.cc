@@ -2,11 +2,13 @@
 #include "SUMMATest.h"
 
 #include <dash/algorithm/SUMMA.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/Matrix.h>
 #include <dash/Meta.h>
 
 #include <sstream>
 #include <iomanip>
+#include <vector>
 
 
 #define SKIP_TEST_IF_NO_SUMMA()           \
@@ -276,3 +278,176 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
 
   dash::barrier();
 }
+
+namespace {
+
+/**
+ * Compares the built-in and the configured local matrix multiplication
+ * kernels of dash::summa with a naive reference.
+ * Elements are small integers so all results are exact.
+ */
+template<typename ValueType>
+void check_local_gemm(
+  long long        m,
+  long long        n,
+  long long        k,
+  dash::MemArrange storage)
+{
+  bool row_major = (storage == dash::ROW_MAJOR);
+  std::vector<ValueType> a(m * k);
+  std::vector<ValueType> b(k * n);
+  for (long long i = 0; i < m * k; ++i) {
+    a[i] = static_cast<ValueType>((i * 7) % 9) - 4;
+  }
+  for (long long i = 0; i < k * n; ++i) {
+    b[i] = static_cast<ValueType>((i * 5) % 7) - 3;
+  }
+  // C is initialized with ones, kernels compute C += A x B
+  std::vector<ValueType> c_ref(m * n, 1);
+  for (long long i = 0; i < m; ++i) {
+    for (long long j = 0; j < n; ++j) {
+      ValueType sum = 0;
+      for (long long l = 0; l < k; ++l) {
+        sum += row_major ? a[i * k + l] * b[l * n + j]
+                         : a[l * m + i] * b[j * k + l];
+      }
+      c_ref[row_major ? i * n + j : j * m + i] += sum;
+    }
+  }
+
+  std::vector<ValueType> c_builtin(m * n, 1);
+  std::vector<ValueType> c_mmult(m * n, 1);
+  dash::internal::gemm_local(a.data(), b.data(), c_builtin.data(),
+                             m, n, k, storage);
+  dash::internal::mmult_local<ValueType>(a.data(), b.data(), c_mmult.data(),
+                                         m, n, k, storage);
+  for (long long i = 0; i < m * n; ++i) {
+    ASSERT_EQ_U(c_ref[i], c_builtin[i]);
+    ASSERT_EQ_U(c_ref[i], c_mmult[i]);
+  }
+}
+
+} // namespace
+
+TEST_F(SUMMATest, LocalGemm)
+{
+  // Extents smaller and larger than the register and cache tiles:
+  const long long extents[][3] = {
+    {   1,   1,   1 },
+    {   5,   3,   7 },
+    {  37,  53,  29 },
+    {  64,  64,  64 },
+    { 131,  70, 301 },
+    { 200, 530,  45 }
+  };
+  for (auto storage : { dash::ROW_MAJOR, dash::COL_MAJOR }) {
+    for (const auto & ext : extents) {
+      LOG_MESSAGE("m:%lld n:%lld k:%lld row major:%d",
+                  ext[0], ext[1], ext[2], storage == dash::ROW_MAJOR);
+      check_local_gemm<double>(ext[0], ext[1], ext[2], storage);
+      check_local_gemm<float>(ext[0], ext[1], ext[2], storage);
+    }
+  }
+}
+
+namespace {
+
+/**
+ * Multiplies matrices with rectangular blocks on a process grid of
+ * \c grid_rows x \c grid_cols units using dash::summa_bcast and compares
+ * the result with the product computed from the element formulas.
+ */
+template<dash::MemArrange Arr>
+void check_summa_bcast(
+  dash::default_extent_t grid_rows,
+  dash::default_extent_t grid_cols,
+  int                    pipeline_depth)
+{
+  typedef dash::TilePattern<2, Arr>      pattern_t;
+  typedef typename pattern_t::index_type index_t;
+  typedef double                         value_t;
+  typedef dash::Matrix<value_t, 2, index_t, pattern_t> matrix_t;
+
+  // Block extents of C: 4 x 5, inner block extent: 3
+  const index_t bs_rows  = 4;
+  const index_t bs_cols  = 5;
+  const index_t bs_inner = 3;
+  // Number of block rows and columns not divisible by the grid extents:
+  const index_t rows     = bs_rows  * (2 * grid_rows + 1);
+  const index_t cols     = bs_cols  * (grid_cols + 1);
+  const index_t inner    = bs_inner * 7;
+
+  dash::TeamSpec<2> teamspec(grid_rows, grid_cols);
+  pattern_t pattern_a(dash::SizeSpec<2>(rows, inner),
+                      dash::DistributionSpec<2>(dash::TILE(bs_rows),
+                                                dash::TILE(bs_inner)),
+                      teamspec);
+  pattern_t pattern_b(dash::SizeSpec<2>(inner, cols),
+                      dash::DistributionSpec<2>(dash::TILE(bs_inner),
+                                                dash::TILE(bs_cols)),
+                      teamspec);
+  pattern_t pattern_c(dash::SizeSpec<2>(rows, cols),
+                      dash::DistributionSpec<2>(dash::TILE(bs_rows),
+                                                dash::TILE(bs_cols)),
+                      teamspec);
+  matrix_t matrix_a(pattern_a);
+  matrix_t matrix_b(pattern_b);
+  matrix_t matrix_c(pattern_c);
+
+  auto value_a = [](index_t i, index_t l) -> value_t {
+    return static_cast<value_t>((i * 7 + l * 3) % 11) - 5;
+  };
+  auto value_b = [](index_t l, index_t j) -> value_t {
+    return static_cast<value_t>((l * 5 + j * 2) % 9) - 4;
+  };
+
+  if (dash::myid().id == 0) {
+    for (index_t i = 0; i < rows; ++i) {
+      for (index_t l = 0; l < inner; ++l) {
+        matrix_a[i][l] = value_a(i, l);
+      }
+    }
+    for (index_t l = 0; l < inner; ++l) {
+      for (index_t j = 0; j < cols; ++j) {
+        matrix_b[l][j] = value_b(l, j);
+      }
+    }
+  }
+  dash::fill(matrix_c.begin(), matrix_c.end(), 1.0);
+  dash::barrier();
+
+  dash::summa_bcast(matrix_a, matrix_b, matrix_c, pipeline_depth);
+
+  if (dash::myid().id == 0) {
+    for (index_t i = 0; i < rows; ++i) {
+      for (index_t j = 0; j < cols; ++j) {
+        value_t expect = 1.0;
+        for (index_t l = 0; l < inner; ++l) {
+          expect += value_a(i, l) * value_b(l, j);
+        }
+        value_t actual = matrix_c[i][j];
+        ASSERT_EQ_U(expect, actual);
+      }
+    }
+  }
+  dash::barrier();
+}
+
+} // namespace
+
+TEST_F(SUMMATest, BcastTilePattern)
+{
+  auto nunits = dash::size();
+  dash::TeamSpec<2> teamspec_bal(nunits, 1);
+  teamspec_bal.balance_extents();
+  auto bal_rows = teamspec_bal.extent(0);
+  auto bal_cols = teamspec_bal.extent(1);
+
+  for (int depth = 1; depth <= 3; ++depth) {
+    LOG_MESSAGE("pipeline depth: %d", depth);
+    check_summa_bcast<dash::ROW_MAJOR>(bal_rows, bal_cols, depth);
+    check_summa_bcast<dash::ROW_MAJOR>(nunits, 1, depth);
+    check_summa_bcast<dash::ROW_MAJOR>(1, nunits, depth);
+  }
+  check_summa_bcast<dash::COL_MAJOR>(bal_rows, bal_cols, 2);
+}
@@ -0,0 +1,172 @@
+
+#include "ScanTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Scan.h>
+#include <dash/algorithm/Copy.h>
+
+#include <vector>
+
+
+namespace {
+
+/**
+ * Affine function x -> a * x + b, composition is associative but not
+ * commutative.
+ */
+struct affine {
+  long a;
+  long b;
+};
+
+struct affine_compose {
+  affine operator()(const affine & f, const affine & g) const {
+    // g after f
+    return affine { g.a * f.a, g.a * f.b + g.b };
+  }
+};
+
+} // namespace
+
+TEST_F(ScanTest, InclusiveSum) {
+  // Size not divisible by number of units
+  const size_t num_elem = 100 * _dash_size + 7;
+  dash::Array<long> in(num_elem, dash::BLOCKED);
+  dash::Array<long> out(num_elem, dash::BLOCKED);
+  for (auto i = 0; i < in.lsize(); ++i) {
+    in.local[i] = (in.pattern().global(i) % 7) + 1;
+  }
+  in.barrier();
+
+  auto out_last = dash::inclusive_scan(in.begin(), in.end(), out.begin());
+  ASSERT_EQ_U(out.end(), out_last);
+  out.barrier();
+
+  if (_dash_id == 0) {
+    std::vector<long> l_out(num_elem);
+    dash::copy(out.begin(), out.end(), l_out.data());
+    long sum = 0;
+    for (size_t i = 0; i < num_elem; ++i) {
+      sum += (i % 7) + 1;
+      ASSERT_EQ_U(sum, l_out[i]);
+    }
+  }
+}
+
+TEST_F(ScanTest, ExclusiveInPlace) {
+  const size_t num_elem = 50 * _dash_size;
+  dash::Array<int> arr(num_elem, dash::BLOCKED);
+  for (auto i = 0; i < arr.lsize(); ++i) {
+    arr.local[i] = arr.pattern().global(i) % 3;
+  }
+  arr.barrier();
+
+  dash::exclusive_scan(arr.begin(), arr.end(), arr.begin(), 10);
+  arr.barrier();
+
+  if (_dash_id == 0) {
+    std::vector<int> l_arr(num_elem);
+    dash::copy(arr.begin(), arr.end(), l_arr.data());
+    int sum = 10;
+    for (size_t i = 0; i < num_elem; ++i) {
+      ASSERT_EQ_U(sum, l_arr[i]);
+      sum += i % 3;
+    }
+  }
+}
+
+TEST_F(ScanTest, InclusiveMaxWithInit) {
+  const size_t num_elem = 20 * _dash_size;
+  dash::Array<int> in(num_elem, dash::BLOCKED);
+  dash::Array<int> out(num_elem, dash::BLOCKED);
+  for (auto i = 0; i < in.lsize(); ++i) {
+    auto gi = in.pattern().global(i);
+    in.local[i] = (gi % 2 == 0) ? static_cast<int>(gi) : -1;
+  }
+  in.barrier();
+
+  dash::inclusive_scan(in.begin(), in.end(), out.begin(),
+                       dash::max<int>(), 5);
+  out.barrier();
+
+  if (_dash_id == 0) {
+    std::vector<int> l_out(num_elem);
+    dash::copy(out.begin(), out.end(), l_out.data());
+    int max = 5;
+    for (size_t i = 0; i < num_elem; ++i) {
+      if (i % 2 == 0) {
+        max = std::max<int>(max, i);
+      }
+      ASSERT_EQ_U(max, l_out[i]);
+    }
+  }
+}
+
+TEST_F(ScanTest, NonCommutativeOperation) {
+  // Combined from gathered totals, units with empty local ranges
+  const size_t num_elem = 3 * _dash_size - 2;
+  dash::Array<affine> in(num_elem, dash::BLOCKED);
+  dash::Array<affine> out(num_elem, dash::BLOCKED);
+  for (auto i = 0; i < in.lsize(); ++i) {
+    long gi = in.pattern().global(i);
+    in.local[i] = affine { gi % 2 + 1, gi };
+  }
+  in.barrier();
+
+  dash::inclusive_scan(in.begin(), in.end(), out.begin(), affine_compose());
+  out.barrier();
+
+  if (_dash_id == 0) {
+    std::vector<affine> l_out(num_elem);
+    dash::copy(out.begin(), out.end(), l_out.data());
+    affine f { 1, 0 };
+    for (size_t i = 0; i < num_elem; ++i) {
+      f = affine_compose()(f, affine { static_cast<long>(i % 2 + 1),
+                                       static_cast<long>(i) });
+      ASSERT_EQ_U(f.a, l_out[i].a);
+      ASSERT_EQ_U(f.b, l_out[i].b);
+    }
+  }
+}
+
+TEST_F(ScanTest, NonContiguousLocalRange) {
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  // Every unit owns two blocks
+  const size_t num_elem = 8 * _dash_size;
+  dash::Array<int> in(num_elem, dash::BLOCKCYCLIC(4));
+  dash::Array<int> out(num_elem, dash::BLOCKCYCLIC(4));
+  EXPECT_THROW(
+    dash::inclusive_scan(in.begin(), in.end(), out.begin()),
+    dash::exception::InvalidArgument);
+}
+
+TEST_F(ScanTest, NonContiguousLocalRangeAtSingleUnit) {
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  // Only unit 0 owns two blocks in the range, all units must throw
+  const size_t num_elem = 8 * _dash_size;
+  dash::Array<int> in(num_elem, dash::BLOCKCYCLIC(4));
+  dash::Array<int> out(num_elem, dash::BLOCKCYCLIC(4));
+  EXPECT_THROW(
+    dash::inclusive_scan(in.begin(), in.begin() + 4 * (_dash_size + 1),
+                         out.begin()),
+    dash::exception::InvalidArgument);
+}
+
+TEST_F(ScanTest, LocalRangesNotOrderedByUnit) {
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  // The block of the last unit precedes the block of unit 0 in the range
+  const size_t num_elem = 8 * _dash_size;
+  dash::Array<int> in(num_elem, dash::BLOCKCYCLIC(4));
+  dash::Array<int> out(num_elem, dash::BLOCKCYCLIC(4));
+  EXPECT_THROW(
+    dash::inclusive_scan(in.begin() + 4 * (_dash_size - 1),
+                         in.begin() + 4 * (_dash_size + 1),
+                         out.begin() + 4 * (_dash_size - 1)),
+    dash::exception::InvalidArgument);
+}
@@ -0,0 +1,102 @@
+
+#include <gtest/gtest.h>
+
+#include "SortTest.h"
+#include "../TestBase.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Sort.h>
+#include <dash/algorithm/Accumulate.h>
+
+#include <functional>
+#include <random>
+
+
+template<typename ArrayType, typename Compare>
+static void check_sorted(
+  ArrayType & array,
+  long        begin,
+  long        end,
+  Compare     compare)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+  std::vector<typename ArrayType::value_type> values;
+  for (long i = begin; i < end; ++i) {
+    values.push_back(array[i]);
+  }
+  for (size_t i = 1; i < values.size(); ++i) {
+    EXPECT_FALSE_U(compare(values[i], values[i-1]));
+  }
+}
+
+TEST_F(SortTest, BlockedRandom)
+{
+  const size_t num_elem_local = 1000;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<long> array(num_elem_total, dash::BLOCKED);
+
+  std::mt19937 rng(_dash_id);
+  std::uniform_int_distribution<long> dist(-100000, 100000);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = dist(rng);
+  }
+  array.barrier();
+
+  long sum_before = dash::accumulate_all(array.begin(), array.end(), 0l);
+
+  dash::sort(array.begin(), array.end());
+
+  long sum_after  = dash::accumulate_all(array.begin(), array.end(), 0l);
+  EXPECT_EQ_U(sum_before, sum_after);
+  check_sorted(array, 0, num_elem_total, std::less<long>());
+}
+
+TEST_F(SortTest, Duplicates)
+{
+  const size_t num_elem_local = 500;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = static_cast<int>((l + _dash_id) % 3);
+  }
+  array.barrier();
+
+  dash::sort(array.begin(), array.end());
+
+  // Duplicate keys are distributed evenly, local sizes are preserved:
+  EXPECT_EQ_U(num_elem_local, array.lsize());
+  check_sorted(array, 0, num_elem_total, std::less<int>());
+}
+
+TEST_F(SortTest, CyclicSubrangeCompare)
+{
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<double> array(num_elem_total, dash::CYCLIC);
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = static_cast<double>(array.pattern().global(l));
+  }
+  array.barrier();
+
+  long begin = 3;
+  long end   = num_elem_total - 5;
+  dash::sort(array.begin() + begin, array.begin() + end,
+             std::greater<double>());
+
+  check_sorted(array, begin, end, std::greater<double>());
+  if (_dash_id == 0) {
+    // Elements outside of the range are not modified:
+    EXPECT_EQ_U(0.0, static_cast<double>(array[0]));
+    EXPECT_EQ_U(end - 1, static_cast<double>(array[begin]));
+    EXPECT_EQ_U(begin, static_cast<double>(array[end - 1]));
+    EXPECT_EQ_U(num_elem_total - 1,
+                static_cast<double>(array[num_elem_total - 1]));
+  }
+}
@@ -0,0 +1,44 @@
+
+#include "SharedCounterTest.h"
+
+#include <dash/SharedCounter.h>
+
+
+TEST_F(SharedCounterTest, AtomicIncrement)
+{
+  dash::SharedCounter<long> counter;
+
+  for (int i = 0; i < 10; ++i) {
+    counter.inc(dash::myid() + 1);
+  }
+  counter.dec(1);
+  counter.barrier();
+
+  long nunits   = dash::size();
+  long expected = 10 * (nunits * (nunits + 1)) / 2 - nunits;
+  EXPECT_EQ_U(expected, counter.get());
+  EXPECT_EQ_U(0, counter.buffered());
+}
+
+TEST_F(SharedCounterTest, RelaxedFlush)
+{
+  dash::SharedCounter<size_t> counter(dash::Team::All(),
+                                      dash::counter_mode::relaxed);
+  EXPECT_EQ_U(dash::counter_mode::relaxed, counter.mode());
+
+  for (int i = 0; i < 100; ++i) {
+    counter.inc(2);
+  }
+  counter.dec(50);
+  EXPECT_EQ_U(150, counter.buffered());
+
+  // Buffered increments are not visible before flush:
+  dash::barrier();
+  EXPECT_EQ_U(0, counter.get());
+  dash::barrier();
+
+  counter.flush();
+  EXPECT_EQ_U(0, counter.buffered());
+  counter.barrier();
+  EXPECT_EQ_U(150 * dash::size(), counter.get());
+}
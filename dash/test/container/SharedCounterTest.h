@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__SHARED_COUNTER_TEST_H_
+#define DASH__TEST__SHARED_COUNTER_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::SharedCounter
+ */
+class SharedCounterTest : public dash::test::TestBase {
+protected:
+
+  SharedCounterTest() {
+    LOG_MESSAGE(">>> Test suite: SharedCounterTest");
+  }
+
+  virtual ~SharedCounterTest()
+  {
+    LOG_MESSAGE("<<< Closing test suite: SharedCounterTest");
+  }
+};
+
+#endif // DASH__TEST__SHARED_COUNTER_TEST_H_
@@ -543,3 +543,231 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, BulkInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits            = dash::size();
+  // Use small local buffer size to enforce reallocation:
+  size_type local_buffer_size = 4;
+  size_type local_elements    = 100;
+
+  map_t map(0, local_buffer_size);
+
+  // Every unit inserts values for all keys in range [0, local_elements)
+  // and values for keys in its own range which are owned by any unit:
+  std::vector<std::pair<key_t, mapped_t>> values;
+  for (int li = 0; li < local_elements; ++li) {
+    values.push_back(std::make_pair(li, 1.0 * li));
+    key_t key = (local_elements * (dash::myid().id + 1)) + li;
+    values.push_back(std::make_pair(key, 1.0 * key));
+  }
+  auto ninserted = map.bulk_insert(values.begin(), values.end());
+
+  // Keys are unique after bulk insert:
+  EXPECT_EQ_U(ninserted,                           map.lsize());
+  EXPECT_EQ_U(local_elements * (nunits + 1),       map.size());
+  // Every unit only stores the elements mapped to it:
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    key_t key = (*lit).first;
+    EXPECT_EQ_U(dash::myid().id, key % nunits);
+  }
+  // Every unit can resolve all elements:
+  for (int key = 0; key < local_elements * (nunits + 1); ++key) {
+    auto found = map.find(key);
+    EXPECT_NE_U(map.end(), found);
+    map_value found_value = *found;
+    EXPECT_EQ_U(key,       found_value.first);
+    EXPECT_EQ_U(1.0 * key, found_value.second);
+  }
+}
+
+TEST_F(UnorderedMapTest, EraseCompact)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits            = dash::size();
+  size_type local_buffer_size = 4;
+  size_type local_elements    = 20;
+
+  map_t map(0, local_buffer_size);
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + dash::myid().id;
+    map.local.insert(map_value({ key, 1.0 * key }));
+  }
+  map.barrier();
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+
+  // Erase elements at even local offsets, including the first element:
+  for (int li = 0; li < local_elements; li += 2) {
+    key_t key = (nunits * li) + dash::myid().id;
+    EXPECT_EQ_U(1, map.erase(key));
+    EXPECT_EQ_U(0, map.erase(key));
+  }
+  EXPECT_EQ_U(local_elements / 2, map.lsize());
+  // Erased elements are skipped in local iteration:
+  size_type nlvisited = 0;
+  for (auto lit = map.local.begin(); lit != map.local.end(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(1, (value.first / nunits) % 2);
+    ++nlvisited;
+  }
+  EXPECT_EQ_U(map.lsize(), nlvisited);
+  map.barrier();
+  EXPECT_EQ_U(nunits * local_elements / 2, map.size());
+
+  // Erased elements are skipped in global iteration and lookups:
+  size_type nvisited = 0;
+  for (auto git = map.begin(); git != map.end(); ++git) {
+    map_value value = *git;
+    EXPECT_EQ_U(1, (value.first / nunits) % 2);
+    ++nvisited;
+  }
+  EXPECT_EQ_U(map.size(), nvisited);
+  for (int key = 0; key < nunits * local_elements; ++key) {
+    EXPECT_EQ_U(((key / nunits) % 2), map.count(key));
+  }
+
+  // Compaction releases memory of erased elements:
+  map.compact();
+  EXPECT_EQ_U(nunits * local_elements / 2, map.size());
+  EXPECT_EQ_U(local_elements / 2,          map.lsize());
+  EXPECT_EQ_U(map.lsize(),                 map.lcapacity());
+  for (int key = 0; key < nunits * local_elements; ++key) {
+    auto found = map.find(key);
+    if ((key / nunits) % 2 == 0) {
+      EXPECT_EQ_U(map.end(), found);
+    } else {
+      EXPECT_NE_U(map.end(), found);
+      map_value found_value = *found;
+      EXPECT_EQ_U(1.0 * key, found_value.second);
+    }
+  }
+}
+
+TEST_F(UnorderedMapTest, EraseBulkInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits            = dash::size();
+  size_type local_buffer_size = 4;
+  size_type local_elements    = 20;
+
+  map_t map(0, local_buffer_size);
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + dash::myid().id;
+    map.local.insert(map_value({ key, 1.0 * key }));
+  }
+  map.barrier();
+
+  // Erase elements at even local offsets:
+  for (int li = 0; li < local_elements; li += 2) {
+    key_t key = (nunits * li) + dash::myid().id;
+    EXPECT_EQ_U(1, map.erase(key));
+  }
+  map.barrier();
+
+  // Bulk insert must not overwrite elements following erased elements:
+  std::vector<std::pair<key_t, mapped_t>> values;
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * (local_elements + li)) + dash::myid().id;
+    values.push_back(std::make_pair(key, 1.0 * key));
+  }
+  auto ninserted = map.bulk_insert(values.begin(), values.end());
+  EXPECT_EQ_U(local_elements, ninserted);
+  EXPECT_EQ_U(local_elements / 2 + local_elements, map.lsize());
+  EXPECT_EQ_U(nunits * (local_elements / 2 + local_elements), map.size());
+
+  for (int key = 0; key < nunits * local_elements * 2; ++key) {
+    auto found = map.find(key);
+    if (key < nunits * local_elements && (key / nunits) % 2 == 0) {
+      EXPECT_EQ_U(map.end(), found);
+    } else {
+      EXPECT_NE_U(map.end(), found);
+      map_value found_value = *found;
+      EXPECT_EQ_U(key,       found_value.first);
+      EXPECT_EQ_U(1.0 * key, found_value.second);
+    }
+  }
+}
+
+TEST_F(UnorderedMapTest, BulkErase)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits            = dash::size();
+  size_type local_buffer_size = 4;
+  size_type local_elements    = 20;
+
+  map_t map(0, local_buffer_size);
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + dash::myid().id;
+    map.local.insert(map_value({ key, 1.0 * key }));
+  }
+  map.barrier();
+
+  // Every unit erases the elements with even keys at the next unit and
+  // a key not contained in the map:
+  key_t next = (dash::myid().id + 1) % nunits;
+  std::vector<key_t> keys;
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + next;
+    if (key % 2 == 0) {
+      keys.push_back(key);
+    }
+  }
+  keys.push_back(nunits * local_elements * 2);
+  EXPECT_EQ_U(0, map.erase(nunits * local_elements * 2));
+  if (nunits > 1) {
+    // Elements at remote units can only be erased collectively:
+    EXPECT_THROW(map.erase(nunits + next), dash::exception::InvalidArgument);
+  }
+  size_type nerased_exp = 0;
+  for (int li = 0; li < local_elements; ++li) {
+    nerased_exp += ((nunits * li) + dash::myid().id) % 2 == 0 ? 1 : 0;
+  }
+  auto nerased = map.bulk_erase(keys.begin(), keys.end());
+  EXPECT_EQ_U(nerased_exp,                  nerased);
+  EXPECT_EQ_U(local_elements - nerased_exp, map.lsize());
+
+  size_type nvisited = 0;
+  for (auto git = map.begin(); git != map.end(); ++git) {
+    map_value value = *git;
+    EXPECT_EQ_U(1, value.first % 2);
+    ++nvisited;
+  }
+  EXPECT_EQ_U(map.size(), nvisited);
+
+  // Erased elements are skipped in reverse global iteration:
+  auto git = map.end();
+  for (size_type v = 0; v < nvisited; ++v) {
+    --git;
+    map_value value = *git;
+    EXPECT_EQ_U(1, value.first % 2);
+  }
+  EXPECT_EQ_U(map.begin(), git);
+}
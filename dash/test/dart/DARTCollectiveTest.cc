@@ -50,3 +50,152 @@ TEST_F(DARTCollectiveTest, Sendrecv) {
     ASSERT_EQ(recv, data[partner]);
   }
 }
+
+TEST_F(DARTCollectiveTest, Alltoall) {
+  // every unit sends (sender * 1000 + receiver) to every unit
+  std::vector<int> send(_dash_size);
+  std::vector<int> recv(_dash_size, -1);
+  for(int u = 0; u < _dash_size; ++u) {
+    send[u] = _dash_id * 1000 + u;
+  }
+  dart_alltoall(send.data(), recv.data(), 1, DART_TYPE_INT, DART_TEAM_ALL);
+  for(int u = 0; u < _dash_size; ++u) {
+    ASSERT_EQ(u * 1000 + _dash_id, recv[u]);
+  }
+}
+
+TEST_F(DARTCollectiveTest, Alltoallv) {
+  // every unit sends (receiver + 1) values to every unit
+  std::vector<size_t> nsend(_dash_size);
+  std::vector<size_t> sdispls(_dash_size);
+  std::vector<size_t> nrecv(_dash_size);
+  std::vector<size_t> rdispls(_dash_size);
+  std::vector<int>    send;
+  for(int u = 0; u < _dash_size; ++u) {
+    nsend[u]   = u + 1;
+    sdispls[u] = send.size();
+    send.insert(send.end(), nsend[u], _dash_id * 1000 + u);
+    nrecv[u]   = _dash_id + 1;
+    rdispls[u] = u * (_dash_id + 1);
+  }
+  std::vector<int> recv(_dash_size * (_dash_id + 1), -1);
+  dart_alltoallv(send.data(), nsend.data(), sdispls.data(), DART_TYPE_INT,
+                 recv.data(), nrecv.data(), rdispls.data(), DART_TEAM_ALL);
+  for(int u = 0; u < _dash_size; ++u) {
+    for(int i = 0; i < _dash_id + 1; ++i) {
+      ASSERT_EQ(u * 1000 + _dash_id, recv[rdispls[u] + i]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, BcastHandle) {
+  // two broadcasts from different roots in flight at the same time
+  const int nelem = 100;
+  dart_team_unit_t root_first  = { 0 };
+  dart_team_unit_t root_second = { static_cast<dart_unit_t>(_dash_size - 1) };
+  std::vector<int> first(nelem, -1);
+  std::vector<int> second(nelem, -1);
+  if (_dash_id == root_first.id) {
+    for (int i = 0; i < nelem; ++i) {
+      first[i] = i;
+    }
+  }
+  if (_dash_id == root_second.id) {
+    for (int i = 0; i < nelem; ++i) {
+      second[i] = 1000 + i;
+    }
+  }
+  dart_handle_t handles[2];
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_bcast_handle(first.data(), nelem, DART_TYPE_INT, root_first,
+                      DART_TEAM_ALL, &handles[0]));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_bcast_handle(second.data(), nelem, DART_TYPE_INT, root_second,
+                      DART_TEAM_ALL, &handles[1]));
+  ASSERT_EQ_U(DART_OK, dart_waitall(handles, 2));
+  ASSERT_EQ_U(DART_HANDLE_NULL, handles[0]);
+  for (int i = 0; i < nelem; ++i) {
+    ASSERT_EQ_U(i, first[i]);
+    ASSERT_EQ_U(1000 + i, second[i]);
+  }
+}
+
+TEST_F(DARTCollectiveTest, Exscan) {
+  // unit i receives the sum of 1..i and the maximum of 1..i
+  int  value = _dash_id + 1;
+  int  sum   = -1;
+  int  max   = -1;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_exscan(&value, &sum, 1, DART_TYPE_INT, DART_OP_SUM,
+                DART_TEAM_ALL));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_exscan(&value, &max, 1, DART_TYPE_INT, DART_OP_MAX,
+                DART_TEAM_ALL));
+  if (_dash_id > 0) {
+    ASSERT_EQ_U(_dash_id * (_dash_id + 1) / 2, sum);
+    ASSERT_EQ_U(_dash_id, max);
+  }
+}
+
+namespace {
+
+struct value_index {
+  double value;
+  int    index;
+};
+
+// Maximum value with smallest or largest index of its occurrences:
+void argmax_op(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * userdata)
+{
+  const value_index * in    = static_cast<const value_index *>(invec);
+  value_index       * inout = static_cast<value_index *>(inoutvec);
+  bool                smallest = *static_cast<bool *>(userdata);
+  for (size_t i = 0; i < len; ++i) {
+    if (in[i].value > inout[i].value ||
+        (in[i].value == inout[i].value &&
+         (in[i].index < inout[i].index) == smallest)) {
+      inout[i] = in[i];
+    }
+  }
+}
+
+} // namespace
+
+TEST_F(DARTCollectiveTest, CustomOperation) {
+  dart_datatype_t  dtype;
+  dart_operation_t op;
+  bool             smallest = true;
+  ASSERT_EQ_U(DART_OK, dart_type_create_custom(sizeof(value_index), &dtype));
+  ASSERT_EQ_U(DART_OK,
+              dart_op_create(&argmax_op, &smallest, true, dtype, &op));
+
+  // Maximum 1.0 at units 1 and 2 if available:
+  value_index l_val;
+  l_val.value = (_dash_id == 1 || _dash_id == 2) ? 1.0 : 0.5;
+  l_val.index = _dash_id;
+  value_index g_val;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_allreduce(&l_val, &g_val, 1, dtype, op, DART_TEAM_ALL));
+  ASSERT_EQ_U((_dash_size > 1) ? 1 : 0, g_val.index);
+  ASSERT_EQ_U((_dash_size > 1) ? 1.0 : 0.5, g_val.value);
+
+  // Operation is bound to the type it has been created for:
+  int l_int = 0;
+  int g_int = 0;
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_allreduce(&l_int, &g_int, 1, DART_TYPE_INT, op, DART_TEAM_ALL));
+
+  ASSERT_EQ_U(DART_OK, dart_op_destroy(&op));
+  ASSERT_EQ_U(DART_OK, dart_type_destroy(&dtype));
+  ASSERT_EQ_U(DART_OP_UNDEFINED, op);
+}
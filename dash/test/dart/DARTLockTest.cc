@@ -3,6 +3,9 @@
 #include <dash/Shared.h>
 #include <dash/dart/if/dart.h>
 
+#include <cstdlib>
+#include <string>
+
 
 TEST_F(DARTLockTest, LockUnlockDoNothing) {
   using value_t = int;
@@ -234,3 +237,200 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, HandoffBound) {
+  using value_t = int;
+  constexpr int num_iterations = 20;
+
+  // Bound of node-local handoffs is read at initialization of the lock,
+  // 0 releases the lock to other nodes after every critical section:
+  for (int handoff_max : { 0, 1, 1000 }) {
+    dash::Shared<value_t> shared;
+    dart_lock_t lock;
+
+    if (dash::myid() == 0) {
+      shared.set(0);
+    }
+
+    setenv("DART_LOCK_HANDOFF_MAX",
+           std::to_string(handoff_max).c_str(), 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_lock_init(DART_TEAM_ALL, &lock));
+    unsetenv("DART_LOCK_HANDOFF_MAX");
+
+    dash::barrier();
+    for (int i = 0; i < num_iterations; ++i) {
+      // alternate between blocking and non-blocking acquisition
+      if (i % 2 == 0) {
+        ASSERT_EQ_U(
+          DART_OK,
+          dart_lock_acquire(lock));
+      } else {
+        int32_t acquired;
+        do {
+          ASSERT_EQ_U(
+            DART_OK,
+            dart_lock_try_acquire(lock, &acquired));
+        } while (!acquired);
+      }
+      shared.set(shared.get() + 1);
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_release(lock));
+    }
+    dash::barrier();
+
+    ASSERT_EQ_U(num_iterations * dash::size(),
+                static_cast<value_t>(shared.get()));
+
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_lock_destroy(&lock));
+  }
+}
+
+TEST_F(DARTLockTest, RWLockConcurrentReaders) {
+  dart_rwlock_t lock;
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  // All units hold the lock for reading at the same time, the barrier
+  // would not be reached if readers excluded each other:
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_acquire_read(lock));
+  dash::barrier();
+
+  // Writers cannot acquire the lock while readers hold it:
+  int32_t acquired;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_try_acquire_write(lock, &acquired));
+  ASSERT_EQ_U(0, acquired);
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_release_read(lock));
+  // Releasing a lock not held for reading is erroneous:
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_rwlock_release_read(lock));
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, RWLockExclusiveWriter) {
+  using value_t = int;
+  dash::Shared<value_t> shared;
+  dart_rwlock_t lock;
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_acquire_write(lock));
+  }
+  dash::barrier();
+
+  // Neither readers nor writers can acquire the lock held by a writer:
+  if (dash::myid() != 0) {
+    int32_t acquired;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_try_acquire_read(lock, &acquired));
+    ASSERT_EQ_U(0, acquired);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_try_acquire_write(lock, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    shared.set(1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_release_write(lock));
+  }
+
+  // Readers blocked by the writer observe its update:
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_acquire_read(lock));
+  ASSERT_EQ_U(1, static_cast<value_t>(shared.get()));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_release_read(lock));
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, RWLockReadWrite) {
+  using value_t = int;
+  constexpr int num_iterations = 20;
+  dash::Shared<value_t> shared;
+  dart_rwlock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  dash::barrier();
+  value_t last = 0;
+  for (int i = 0; i < num_iterations; ++i) {
+    if (i % 4 == 0) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_acquire_write(lock));
+      shared.set(shared.get() + 1);
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_release_write(lock));
+    } else {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_acquire_read(lock));
+      // the counter is monotonic
+      value_t current = shared.get();
+      ASSERT_LE_U(last, current);
+      last = current;
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_release_read(lock));
+    }
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U((num_iterations / 4) * dash::size(),
+              static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
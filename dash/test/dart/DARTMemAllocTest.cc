@@ -4,6 +4,9 @@
 #include <dash/dart/if/dart_globmem.h>
 #include <dash/Array.h>
 
+#include <algorithm>
+#include <vector>
+
 TEST_F(DARTMemAllocTest, SmallLocalAlloc)
 {
 
@@ -160,3 +163,193 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
     DART_OK,
     dart_team_memfree(gptr2));
 }
+
+TEST_F(DARTMemAllocTest, ManySegments)
+{
+  // more segments than initial entries in the segment table
+  const int num_segments = 48;
+  std::vector<dart_gptr_t> gptrs(num_segments);
+  for (int s = 0; s < num_segments; ++s) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memalloc_aligned(DART_TEAM_ALL, 1, DART_TYPE_INT, &gptrs[s]));
+    dart_gptr_t gptr_u = gptrs[s];
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_setunit(&gptr_u, dash::team_unit_t(dash::myid())));
+    int value = s * dash::size() + dash::myid();
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_put_blocking(gptr_u, &value, 1, DART_TYPE_INT, DART_TYPE_INT));
+  }
+  dash::barrier();
+
+  // read values of the right neighbor in every segment
+  dash::team_unit_t neighbor((dash::myid() + 1) % dash::size());
+  for (int s = 0; s < num_segments; ++s) {
+    dart_gptr_t gptr_n = gptrs[s];
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_setunit(&gptr_n, neighbor));
+    int value = -1;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_blocking(&value, gptr_n, 1, DART_TYPE_INT, DART_TYPE_INT));
+    ASSERT_EQ_U(s * dash::size() + neighbor, value);
+  }
+  dash::barrier();
+
+  // released segment IDs are re-used
+  std::vector<int16_t> released;
+  for (int s = 0; s < num_segments; s += 2) {
+    released.push_back(gptrs[s].segid);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memfree(gptrs[s]));
+  }
+  for (int s = 0; s < num_segments; s += 2) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memalloc_aligned(DART_TEAM_ALL, 1, DART_TYPE_INT, &gptrs[s]));
+    EXPECT_NE_U(
+      released.end(),
+      std::find(released.begin(), released.end(), gptrs[s].segid));
+  }
+
+  for (int s = 0; s < num_segments; ++s) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memfree(gptrs[s]));
+  }
+}
+
+TEST_F(DARTMemAllocTest, MixedSizeLocalAlloc)
+{
+  // allocation sizes in bytes spanning small and large allocations:
+  const std::vector<size_t> sizes = { 1, 8, 17, 100, 129, 1000, 4096,
+                                      4097, 10000, 70000 };
+  const size_t num_rounds = 50;
+
+  dart_memalloc_stats_t stats_begin;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats_begin));
+
+  std::vector<dart_gptr_t> gptrs;
+  for (size_t r = 0; r < num_rounds; ++r) {
+    for (size_t s : sizes) {
+      dart_gptr_t gptr;
+      ASSERT_EQ_U(DART_OK, dart_memalloc(s, DART_TYPE_BYTE, &gptr));
+      char * addr;
+      ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr, (void**)&addr));
+      memset(addr, static_cast<int>(gptrs.size() % 128), s);
+      gptrs.push_back(gptr);
+    }
+  }
+
+  dart_memalloc_stats_t stats;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  EXPECT_EQ_U(stats_begin.num_allocs + gptrs.size(), stats.num_allocs);
+  EXPECT_GE_U(stats.bytes_reserved, stats.bytes_used);
+  EXPECT_GE_U(stats.bytes_reserved_peak, stats.bytes_reserved);
+  EXPECT_GT_U(stats.num_slabs, static_cast<size_t>(0));
+
+  // allocations do not overlap:
+  for (size_t i = 0; i < gptrs.size(); ++i) {
+    char * addr;
+    ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptrs[i], (void**)&addr));
+    size_t s = sizes[i % sizes.size()];
+    for (size_t b = 0; b < s; ++b) {
+      ASSERT_EQ_U(static_cast<int>(i % 128), addr[b]);
+    }
+  }
+
+  // free every other allocation first to interleave free and used objects:
+  for (size_t i = 0; i < gptrs.size(); i += 2) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+  }
+  for (size_t i = 1; i < gptrs.size(); i += 2) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+  }
+
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  EXPECT_EQ_U(stats_begin.num_allocs, stats.num_allocs);
+  EXPECT_EQ_U(stats_begin.bytes_used, stats.bytes_used);
+  EXPECT_LE_U(stats.bytes_reserved, stats.pool_size);
+  EXPECT_LE_U(stats.bytes_largest_free, stats.pool_size - stats.bytes_reserved);
+}
+
+TEST_F(DARTMemAllocTest, GrowLocalPool)
+{
+  typedef int value_t;
+  const size_t chunk_bytes = 1024 * 1024;
+  // larger than extension regions shared by allocations:
+  const size_t large_bytes = 40 * 1024 * 1024;
+
+  dart_memalloc_stats_t stats_begin;
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats_begin));
+  ASSERT_GE_U(stats_begin.num_regions, static_cast<size_t>(1));
+
+  // exhaust the initial region of the pool:
+  std::vector<dart_gptr_t> gptrs;
+  size_t max_chunks = stats_begin.pool_size / chunk_bytes + 2;
+  dart_memalloc_stats_t stats = stats_begin;
+  while (stats.num_regions == stats_begin.num_regions &&
+         gptrs.size() < max_chunks) {
+    dart_gptr_t gptr;
+    ASSERT_EQ_U(DART_OK, dart_memalloc(chunk_bytes, DART_TYPE_BYTE, &gptr));
+    gptrs.push_back(gptr);
+    ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  }
+  EXPECT_GT_U(stats.num_regions, stats_begin.num_regions);
+
+  dart_gptr_t gptr_large;
+  ASSERT_EQ_U(DART_OK, dart_memalloc(large_bytes, DART_TYPE_BYTE,
+                                     &gptr_large));
+  gptrs.push_back(gptr_large);
+
+  for (size_t i = 0; i < gptrs.size(); ++i) {
+    value_t * addr;
+    ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptrs[i], (void**)&addr));
+    size_t nelem = ((i + 1 == gptrs.size()) ? large_bytes : chunk_bytes)
+                   / sizeof(value_t);
+    addr[0]         = dash::myid().id * 1000 + i;
+    addr[nelem - 1] = dash::myid().id * 1000 + i;
+  }
+
+  // the last allocations are served from extension regions and must be
+  // accessible by other units:
+  dash::Array<dart_gptr_t> arr(dash::size() * 2);
+  arr.local[0] = gptrs[gptrs.size() - 2];
+  arr.local[1] = gptr_large;
+  arr.barrier();
+
+  size_t neighbor_id = (dash::myid().id + 1) % dash::size();
+  for (size_t k = 0; k < 2; ++k) {
+    dart_gptr_t gptr = arr[neighbor_id * 2 + k];
+    size_t      idx  = gptrs.size() - 2 + k;
+    size_t nelem = ((k == 1) ? large_bytes : chunk_bytes) / sizeof(value_t);
+    value_t neighbor_val;
+    dash::dart_storage<value_t> ds(1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_blocking(&neighbor_val, gptr, ds.nelem, ds.dtype, ds.dtype));
+    EXPECT_EQ_U(neighbor_id * 1000 + idx, neighbor_val);
+
+    gptr.addr_or_offs.offset += (nelem - 1) * sizeof(value_t);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_blocking(&neighbor_val, gptr, ds.nelem, ds.dtype, ds.dtype));
+    EXPECT_EQ_U(neighbor_id * 1000 + idx, neighbor_val);
+  }
+
+  arr.barrier();
+
+  for (auto gptr : gptrs) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptr));
+  }
+
+  // dedicated regions are released once freed:
+  ASSERT_EQ_U(DART_OK, dart_memalloc_stats(&stats));
+  EXPECT_EQ_U(stats_begin.num_allocs, stats.num_allocs);
+  EXPECT_EQ_U(stats_begin.bytes_used, stats.bytes_used);
+  EXPECT_GT_U(stats.num_regions, stats_begin.num_regions);
+}
@@ -630,3 +630,126 @@ TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
   dart_team_memfree(gptr);
 }
 
+
+TEST_F(DARTOnesidedTest, StridedGetRepeated) {
+  constexpr size_t num_elem_per_unit = 120;
+  constexpr size_t stride            = 3;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = i;
+  }
+
+  dash::barrier();
+  int *buf = new int[num_elem_per_unit];
+
+  dart_unit_t neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid = neighbor;
+
+  dart_datatype_t new_type;
+  dart_type_create_strided(DART_TYPE_INT, stride, 1, &new_type);
+
+  // use the same type with more distinct block counts than cached and
+  // repeat every transfer
+  for (int rep = 0; rep < 2; ++rep) {
+    for (size_t nblocks = 1; nblocks <= num_elem_per_unit / stride;
+         nblocks += 3) {
+      LOG_MESSAGE("Testing GET with %zu blocks", nblocks);
+      memset(buf, 0, sizeof(int)*num_elem_per_unit);
+      dart_get_blocking(buf, gptr, nblocks, new_type, DART_TYPE_INT);
+      for (int i = 0; i < nblocks; ++i) {
+        ASSERT_EQ_U(i*stride, buf[i]);
+      }
+    }
+  }
+  dart_type_destroy(&new_type);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+
+  delete[] buf;
+}
+
+TEST_F(DARTOnesidedTest, SubarrayGetPut) {
+  constexpr size_t nrows = 8;
+  constexpr size_t ncols = 10;
+  constexpr size_t num_elem_per_unit = nrows * ncols;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = i;
+  }
+
+  // 3x4 tile at offset (2,5) of the 8x10 local block:
+  size_t sizes[2]    = { nrows, ncols };
+  size_t subsizes[2] = { 3, 4 };
+  size_t starts[2]   = { 2, 5 };
+  size_t tile_size   = subsizes[0] * subsizes[1];
+  dart_datatype_t tile_type;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_type_create_subarray(
+      DART_TYPE_INT, 2, sizes, subsizes, starts, &tile_type));
+
+  // tile exceeding the array extents is rejected:
+  size_t starts_inv[2] = { 6, 5 };
+  dart_datatype_t inv_type;
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_type_create_subarray(
+      DART_TYPE_INT, 2, sizes, subsizes, starts_inv, &inv_type));
+
+  dash::barrier();
+
+  dart_unit_t neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid = neighbor;
+
+  // global-to-local subarray-to-contig
+  std::vector<int> buf(tile_size, 0);
+  dart_get_blocking(buf.data(), gptr, tile_size, tile_type, DART_TYPE_INT);
+  for (size_t r = 0; r < subsizes[0]; ++r) {
+    for (size_t c = 0; c < subsizes[1]; ++c) {
+      ASSERT_EQ_U((starts[0] + r) * ncols + starts[1] + c,
+                  buf[r * subsizes[1] + c]);
+    }
+  }
+
+  dash::barrier();
+
+  // local-to-global contig-to-subarray
+  for (size_t i = 0; i < tile_size; ++i) {
+    buf[i] = -1;
+  }
+  dart_put_blocking(gptr, buf.data(), tile_size, DART_TYPE_INT, tile_type);
+
+  dash::barrier();
+
+  for (size_t r = 0; r < nrows; ++r) {
+    for (size_t c = 0; c < ncols; ++c) {
+      bool in_tile = r >= starts[0] && r < starts[0] + subsizes[0] &&
+                     c >= starts[1] && c < starts[1] + subsizes[1];
+      int expected = in_tile ? -1 : static_cast<int>(r * ncols + c);
+      ASSERT_EQ_U(expected, local_ptr[r * ncols + c]);
+    }
+  }
+  dart_type_destroy(&tile_type);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+}
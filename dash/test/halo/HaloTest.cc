@@ -4,6 +4,7 @@
 #include <dash/Matrix.h>
 #include <dash/Algorithm.h>
 #include <dash/halo/HaloMatrixWrapper.h>
+#include <dash/halo/StencilOperator.h>
 
 #include <iostream>
 
@@ -886,3 +887,377 @@ TEST_F(HaloTest, HaloMatrixWrapperBigMix3D)
   }
   dash::Team::All().barrier();
 }
+
+template<typename ValueT>
+struct StencilSumKernel {
+  ValueT* out;
+  int     num_points;
+
+  template<typename IteratorT>
+  void operator()(IteratorT& it) const {
+    ValueT sum = *it;
+    for(auto i = 0; i < num_points; ++i)
+      sum += (i + 2) * it.value_at(i);
+
+    out[it.lpos()] = sum;
+  }
+};
+
+template<typename HaloWrapperT, typename MatrixT>
+void check_stencil_operator(HaloWrapperT& halo_wrapper, MatrixT& matrix_op,
+                            MatrixT& matrix_ref) {
+  using value_t = typename MatrixT::value_type;
+
+  auto& matrix = halo_wrapper.matrix();
+  for(auto i = 0; i < matrix.local.size(); ++i)
+    matrix.lbegin()[i] = dash::myid() * 1000000 + i;
+
+  dash::fill(matrix_op.begin(), matrix_op.end(), -1);
+  dash::fill(matrix_ref.begin(), matrix_ref.end(), -1);
+  dash::Team::All().barrier();
+
+  int num_points = halo_wrapper.stencil_spec().num_stencil_points();
+  StencilSumKernel<value_t> kernel_op{ matrix_op.lbegin(), num_points };
+  StencilSumKernel<value_t> kernel_ref{ matrix_ref.lbegin(), num_points };
+
+  dash::StencilOperator<HaloWrapperT> stencil_op(halo_wrapper);
+  stencil_op.apply(kernel_op);
+
+  halo_wrapper.update();
+  auto it_iend = halo_wrapper.iend();
+  for(auto it = halo_wrapper.ibegin(); it != it_iend; ++it)
+    kernel_ref(it);
+  auto it_bend = halo_wrapper.bend();
+  for(auto it = halo_wrapper.bbegin(); it != it_bend; ++it)
+    kernel_ref(it);
+
+  for(auto i = 0; i < matrix.local.size(); ++i)
+    EXPECT_EQ_U(matrix_ref.lbegin()[i], matrix_op.lbegin()[i]);
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, StencilOperator2D)
+{
+  using PatternT = dash::Pattern<2>;
+  using index_type = typename PatternT::index_type;
+  using MatrixT = dash::Matrix<long, 2, index_type, PatternT>;
+  using StencilT = Stencil<2>;
+  using StencilSpecT = StencilSpec<2, 4>;
+
+  dash::DistributionSpec<2> dist_spec(dash::BLOCKED, dash::BLOCKED);
+  dash::TeamSpec<2> team_spec{};
+  team_spec.balance_extents();
+  PatternT pattern(dash::SizeSpec<2>(ext_per_dim, ext_per_dim), dist_spec,
+                   team_spec, dash::Team::All());
+
+  MatrixT matrix_halo(pattern);
+  MatrixT matrix_op(pattern);
+  MatrixT matrix_ref(pattern);
+
+  StencilSpecT stencil_spec({
+      StencilT(-1, 0), StencilT(1, 0), StencilT(0, -1), StencilT(0, 1)});
+  CycleSpec<2> cycle_spec(Cycle::CYCLIC, Cycle::CYCLIC);
+  HaloMatrixWrapper<MatrixT,StencilSpecT> halo_wrapper(
+    matrix_halo, stencil_spec, cycle_spec);
+
+  check_stencil_operator(halo_wrapper, matrix_op, matrix_ref);
+}
+
+TEST_F(HaloTest, StencilOperatorMix3D)
+{
+  using PatternT = dash::Pattern<3>;
+  using PatternColT = dash::Pattern<3, dash::COL_MAJOR>;
+  using index_type = typename PatternT::index_type;
+  using MatrixT = dash::Matrix<long, 3, index_type, PatternT>;
+  using MatrixColT = dash::Matrix<long, 3, index_type, PatternColT>;
+  using SizeSpecT = dash::SizeSpec<3>;
+  using StencilT = Stencil<3>;
+  using StencilSpecT = StencilSpec<3, 8>;
+
+  auto ext = ext_per_dim / 2;
+  dash::DistributionSpec<3> dist_spec(dash::BLOCKED, dash::BLOCKED,
+                                      dash::BLOCKED);
+  dash::TeamSpec<3> team_spec{};
+  team_spec.balance_extents();
+  PatternT pattern(SizeSpecT(ext, ext, ext), dist_spec, team_spec,
+                   dash::Team::All());
+  PatternColT pattern_col(SizeSpecT(ext, ext, ext), dist_spec, team_spec,
+                          dash::Team::All());
+
+  StencilSpecT stencil_spec({
+      StencilT(-2, 0, 0), StencilT(2, 0, 0),
+      StencilT( 0,-1, 0), StencilT(0, 1, 0),
+      StencilT( 0, 0,-1), StencilT(0, 0, 1),
+      StencilT(-1,-1, 1), StencilT(1, 1,-1)});
+  CycleSpec<3> cycle_spec(Cycle::NONE, Cycle::CYCLIC, Cycle::FIXED);
+
+  {
+    MatrixT matrix_halo(pattern);
+    MatrixT matrix_op(pattern);
+    MatrixT matrix_ref(pattern);
+    HaloMatrixWrapper<MatrixT,StencilSpecT> halo_wrapper(
+      matrix_halo, stencil_spec, cycle_spec);
+    halo_wrapper.set_fixed_halos(
+      [](const std::array<dash::default_index_t,3>& coords) {
+        return 20;
+      });
+    check_stencil_operator(halo_wrapper, matrix_op, matrix_ref);
+  }
+  {
+    MatrixColT matrix_halo(pattern_col);
+    MatrixColT matrix_op(pattern_col);
+    MatrixColT matrix_ref(pattern_col);
+    HaloMatrixWrapper<MatrixColT,StencilSpecT> halo_wrapper(
+      matrix_halo, stencil_spec, cycle_spec);
+    halo_wrapper.set_fixed_halos(
+      [](const std::array<dash::default_index_t,3>& coords) {
+        return 20;
+      });
+    check_stencil_operator(halo_wrapper, matrix_op, matrix_ref);
+  }
+}
+
+template<typename MatrixT, typename StencilSpecT, typename CycleSpecT>
+void stencil_sum_mode(MatrixT& matrix, MatrixT& matrix_out,
+                      const StencilSpecT& stencil_spec,
+                      const CycleSpecT& cycle_spec, HaloUpdateMode mode) {
+  using value_t = typename MatrixT::value_type;
+  using HaloWrapperT = HaloMatrixWrapper<MatrixT, StencilSpecT>;
+
+  HaloWrapperT halo_wrapper(matrix, stencil_spec, cycle_spec, mode);
+  EXPECT_TRUE_U(mode == halo_wrapper.mode());
+  halo_wrapper.set_fixed_halos(
+    [](const std::array<dash::default_index_t,3>& coords) {
+      return 20;
+    });
+
+  StencilSumKernel<value_t> kernel{
+    matrix_out.lbegin(),
+    static_cast<int>(StencilSpecT::num_stencil_points()) };
+  dash::StencilOperator<HaloWrapperT> stencil_op(halo_wrapper);
+  // Repeated updates must not interfere with each other:
+  for(auto i = 0; i < 3; ++i) {
+    stencil_op.apply(kernel);
+    dash::Team::All().barrier();
+  }
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloUpdateModes3D)
+{
+  using PatternT = dash::Pattern<3>;
+  using index_type = typename PatternT::index_type;
+  using MatrixT = dash::Matrix<long, 3, index_type, PatternT>;
+  using SizeSpecT = dash::SizeSpec<3>;
+  using StencilT = Stencil<3>;
+  using StencilSpecT = StencilSpec<3, 8>;
+
+  auto ext = ext_per_dim / 2;
+  dash::DistributionSpec<3> dist_spec(dash::BLOCKED, dash::BLOCKED,
+                                      dash::BLOCKED);
+  dash::TeamSpec<3> team_spec{};
+  team_spec.balance_extents();
+  PatternT pattern(SizeSpecT(ext, ext + 3, ext - 5), dist_spec, team_spec,
+                   dash::Team::All());
+
+  StencilSpecT stencil_spec({
+      StencilT(-2, 0, 0), StencilT(2, 0, 0),
+      StencilT( 0,-1, 0), StencilT(0, 1, 0),
+      StencilT( 0, 0,-1), StencilT(0, 0, 1),
+      StencilT(-1,-1, 1), StencilT(1, 1,-1)});
+  CycleSpec<3> cycle_spec(Cycle::CYCLIC, Cycle::FIXED, Cycle::CYCLIC);
+
+  MatrixT matrix(pattern);
+  MatrixT matrix_get(pattern);
+  MatrixT matrix_mode(pattern);
+  for(auto i = 0; i < matrix.local.size(); ++i)
+    matrix.lbegin()[i] = dash::myid() * 1000000 + i;
+  dash::Team::All().barrier();
+
+  stencil_sum_mode(matrix, matrix_get, stencil_spec, cycle_spec,
+                   HaloUpdateMode::GET);
+
+  for(auto mode : { HaloUpdateMode::SHARED, HaloUpdateMode::PUSH }) {
+    dash::fill(matrix_mode.begin(), matrix_mode.end(), -1);
+    dash::Team::All().barrier();
+
+    stencil_sum_mode(matrix, matrix_mode, stencil_spec, cycle_spec, mode);
+    for(auto i = 0; i < matrix.local.size(); ++i)
+      EXPECT_EQ_U(matrix_get.lbegin()[i], matrix_mode.lbegin()[i]);
+
+    dash::Team::All().barrier();
+  }
+}
+
+template<typename ValueT>
+struct StencilSumSweepKernel {
+  int num_points;
+
+  template<typename IteratorT>
+  ValueT operator()(IteratorT& it) const {
+    ValueT sum = *it;
+    for(auto i = 0; i < num_points; ++i)
+      sum += (i + 2) * it.value_at(i);
+
+    return sum;
+  }
+};
+
+struct FixedHaloValue {
+  template<typename CoordsT>
+  long operator()(const CoordsT& coords) const { return 20; }
+};
+
+template<typename MatrixT, typename StencilSpecT, typename CycleSpecT>
+void check_halo_sweeps(const typename MatrixT::pattern_type& pattern,
+                       const StencilSpecT& stencil_spec,
+                       const CycleSpecT& cycle_spec, uint16_t depth) {
+  using value_t = typename MatrixT::value_type;
+  using HaloWrapperT = HaloMatrixWrapper<MatrixT, StencilSpecT>;
+
+  MatrixT matrix_a(pattern);
+  MatrixT matrix_b(pattern);
+  MatrixT matrix_ref_a(pattern);
+  MatrixT matrix_ref_b(pattern);
+  for(auto i = 0; i < matrix_a.local.size(); ++i) {
+    matrix_a.lbegin()[i]     = dash::myid() * 1000000 + i;
+    matrix_ref_a.lbegin()[i] = dash::myid() * 1000000 + i;
+    matrix_b.lbegin()[i]     = -i;
+    matrix_ref_b.lbegin()[i] = -i;
+  }
+  dash::Team::All().barrier();
+
+  int num_points = stencil_spec.num_stencil_points();
+
+  // Reference: one halo update per sweep
+  {
+    HaloWrapperT halo_a(matrix_ref_a, stencil_spec, cycle_spec);
+    HaloWrapperT halo_b(matrix_ref_b, stencil_spec, cycle_spec);
+    halo_a.set_fixed_halos(FixedHaloValue());
+    halo_b.set_fixed_halos(FixedHaloValue());
+
+    HaloWrapperT* in  = &halo_a;
+    HaloWrapperT* out = &halo_b;
+    for(auto sweep = 0; sweep < 2 * depth; ++sweep) {
+      in->update();
+      StencilSumKernel<value_t> kernel{ out->matrix().lbegin(), num_points };
+      auto it_end = in->end();
+      for(auto it = in->begin(); it != it_end; ++it)
+        kernel(it);
+      dash::Team::All().barrier();
+      std::swap(in, out);
+    }
+  }
+
+  // One halo update per depth sweeps, two updates in total
+  {
+    HaloWrapperT halo_a(matrix_a, stencil_spec, cycle_spec,
+                        HaloUpdateMode::GET, depth);
+    HaloWrapperT halo_b(matrix_b, stencil_spec, cycle_spec,
+                        HaloUpdateMode::GET, depth);
+    EXPECT_EQ_U(depth, halo_a.halo_depth());
+    halo_a.set_fixed_halos(FixedHaloValue());
+    halo_b.set_fixed_halos(FixedHaloValue());
+
+    dash::StencilOperator<HaloWrapperT> stencil_op_a(halo_a);
+    dash::StencilOperator<HaloWrapperT> stencil_op_b(halo_b);
+    StencilSumSweepKernel<value_t> kernel{ num_points };
+    stencil_op_a.apply_sweeps(halo_b, kernel);
+    dash::Team::All().barrier();
+    if(depth % 2)
+      stencil_op_b.apply_sweeps(halo_a, kernel);
+    else
+      stencil_op_a.apply_sweeps(halo_b, kernel);
+    dash::Team::All().barrier();
+  }
+
+  for(auto i = 0; i < matrix_a.local.size(); ++i)
+    EXPECT_EQ_U(matrix_ref_a.lbegin()[i], matrix_a.lbegin()[i]);
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloDeepSweeps)
+{
+  {
+    using PatternT = dash::Pattern<2>;
+    using MatrixT = dash::Matrix<long, 2, dash::default_index_t, PatternT>;
+    using StencilT = Stencil<2>;
+    using StencilSpecT = StencilSpec<2, 4>;
+
+    dash::TeamSpec<2> team_spec{};
+    team_spec.balance_extents();
+    PatternT pattern(dash::SizeSpec<2>(ext_per_dim / 2, ext_per_dim / 2),
+                     dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                     team_spec, dash::Team::All());
+    StencilSpecT stencil_spec({
+        StencilT(-1, 0), StencilT(1, 0), StencilT(0, -1), StencilT(0, 1)});
+    CycleSpec<2> cycle_spec(Cycle::CYCLIC, Cycle::CYCLIC);
+
+    for(uint16_t depth : { 1, 2, 3 })
+      check_halo_sweeps<MatrixT>(pattern, stencil_spec, cycle_spec, depth);
+  }
+  {
+    using PatternT = dash::Pattern<3, dash::COL_MAJOR>;
+    using MatrixT = dash::Matrix<long, 3, dash::default_index_t, PatternT>;
+    using StencilT = Stencil<3>;
+    using StencilSpecT = StencilSpec<3, 8>;
+
+    auto ext = ext_per_dim / 4;
+    dash::TeamSpec<3> team_spec{};
+    team_spec.balance_extents();
+    PatternT pattern(dash::SizeSpec<3>(ext, ext + 3, ext - 5),
+                     dash::DistributionSpec<3>(dash::BLOCKED, dash::BLOCKED,
+                                               dash::BLOCKED),
+                     team_spec, dash::Team::All());
+    StencilSpecT stencil_spec({
+        StencilT(-2, 0, 0), StencilT(2, 0, 0),
+        StencilT( 0,-1, 0), StencilT(0, 1, 0),
+        StencilT( 0, 0,-1), StencilT(0, 0, 1),
+        StencilT(-1,-1, 1), StencilT(1, 1,-1)});
+    CycleSpec<3> cycle_spec(Cycle::NONE, Cycle::CYCLIC, Cycle::FIXED);
+
+    check_halo_sweeps<MatrixT>(pattern, stencil_spec, cycle_spec, 2);
+  }
+}
+
+TEST_F(HaloTest, HaloInvalidDepth)
+{
+  using PatternT = dash::Pattern<2>;
+  using MatrixT = dash::Matrix<long, 2, dash::default_index_t, PatternT>;
+  using StencilT = Stencil<2>;
+  using StencilSpecT = StencilSpec<2, 2>;
+  using HaloWrapperT = HaloMatrixWrapper<MatrixT, StencilSpecT>;
+
+  auto num_units = dash::size();
+  if(num_units < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+
+  // Blocks of num_units rows, the last unit only holds a single row:
+  dash::TeamSpec<2> team_spec(num_units, 1);
+  PatternT pattern(dash::SizeSpec<2>(num_units * (num_units - 1) + 1, 10),
+                   dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE),
+                   team_spec, dash::Team::All());
+  MatrixT matrix(pattern);
+  StencilSpecT stencil_spec({ StencilT(-1, 0), StencilT(1, 0) });
+  CycleSpec<2> cycle_spec(Cycle::CYCLIC, Cycle::CYCLIC);
+
+  EXPECT_THROW(
+    HaloWrapperT(matrix, stencil_spec, cycle_spec, HaloUpdateMode::GET, 0),
+    dash::exception::InvalidArgument);
+
+  // Halo regions of depth 2 only exceed the local block of the last unit,
+  // all units fail before allocating halo buffers collectively:
+  EXPECT_THROW(
+    HaloWrapperT(matrix, stencil_spec, cycle_spec, HaloUpdateMode::PUSH, 2),
+    dash::exception::InvalidArgument);
+
+  {
+    HaloWrapperT halo(matrix, stencil_spec, cycle_spec,
+                      HaloUpdateMode::PUSH, 1);
+    EXPECT_EQ_U(1, halo.halo_depth());
+  }
+  dash::Team::All().barrier();
+}
@@ -49,6 +49,60 @@ TEST_F(GlobAsyncRefTest, Push) {
 }
 
 
+/**
+ * Non-blocking accumulation on elements of a distributed array.
+ */
+TEST_F(GlobAsyncRefTest, Accumulate) {
+  int num_elem_per_unit = 20;
+  dash::Array<int> array(dash::size() * num_elem_per_unit);
+  for (auto li = 0; li < array.lcapacity(); ++li) {
+    array.local[li] = 0;
+  }
+  array.barrier();
+  // Every unit increments every element:
+  for (size_t gi = 0; gi < array.size(); ++gi) {
+    array.async[gi].add(1);
+  }
+  array.async.flush();
+  array.barrier();
+  for (auto li = 0; li < array.lcapacity(); ++li) {
+    ASSERT_EQ_U(dash::size(), array.local[li]);
+  }
+  array.barrier();
+  // Fetch previous values of the right neighbor's first element:
+  size_t rneighbor = (dash::myid() + 1) % dash::size();
+  int    prev      = -1;
+  array.async[rneighbor * num_elem_per_unit].fetch_op(
+    dash::plus<int>(), 2, &prev);
+  array.async.flush();
+  ASSERT_GE_U(prev, static_cast<int>(dash::size()));
+  array.barrier();
+  ASSERT_EQ_U(dash::size() + 2, array.local[0]);
+}
+
+/**
+ * Non-blocking accumulation remains in flight until flush.
+ */
+TEST_F(GlobAsyncRefTest, AccumulateInFlight) {
+  const size_t num_ops = dash::internal::AsyncOps::Capacity + 10;
+  dash::Array<int> array(dash::size());
+  array.local[0] = 0;
+  array.barrier();
+  auto & pending = dash::internal::AsyncOps::get();
+  // Every unit increments the right neighbor's element, pending
+  // operations are completed in batches:
+  size_t rneighbor = (dash::myid() + 1) % dash::size();
+  for (size_t op = 0; op < num_ops; ++op) {
+    array.async[rneighbor].add(1);
+  }
+  EXPECT_EQ_U(num_ops % dash::internal::AsyncOps::Capacity, pending.size());
+  array.async.flush();
+  EXPECT_EQ_U(0, pending.size());
+  array.barrier();
+  EXPECT_EQ_U(num_ops, array.local[0]);
+  array.barrier();
+}
+
 TEST_F(GlobAsyncRefTest, GetSet) {
   // Initialize values:
   dash::Array<int> array(dash::size());
@@ -0,0 +1,176 @@
+
+#include "GlobIterTest.h"
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+
+#include <algorithm>
+
+
+/**
+ * Traverses the global range of a container with increments of
+ * \c step elements and compares the local position of every element
+ * with the pattern's mapping.
+ */
+template <class ContainerT>
+void check_traversal(ContainerT & container, int step)
+{
+  auto & pattern = container.pattern();
+  auto   begin   = container.begin();
+  auto   end     = container.end();
+  for (auto it = begin; it < end; it += step) {
+    auto g_idx     = it.pos();
+    auto exp_lpos  = pattern.local(g_idx);
+    dart_gptr_t exp_gptr = begin[g_idx].dart_gptr();
+    dart_gptr_t gptr     = (*it).dart_gptr();
+    ASSERT_TRUE_U(DART_GPTR_EQUAL(exp_gptr, gptr));
+    auto lpos = it.lpos();
+    ASSERT_EQ_U(exp_lpos.unit,  lpos.unit);
+    ASSERT_EQ_U(exp_lpos.index, lpos.index);
+    if (exp_lpos.unit == pattern.team().myid()) {
+      ASSERT_EQ_U(container.lbegin() + exp_lpos.index, it.local());
+    } else {
+      ASSERT_EQ_U(nullptr, it.local());
+    }
+    // elements in the local run are stored contiguously:
+    auto run = it.lrun();
+    ASSERT_GE_U(run, 1);
+    auto run_end_lpos = pattern.local(g_idx + run - 1);
+    ASSERT_EQ_U(exp_lpos.unit,            run_end_lpos.unit);
+    ASSERT_EQ_U(exp_lpos.index + run - 1, run_end_lpos.index);
+  }
+  // post-increment and dereference at end of range:
+  auto it = begin;
+  for (auto i = 0; i < container.size(); ++i) {
+    it++;
+  }
+  ASSERT_EQ_U(end, it);
+  ASSERT_EQ_U(end.lpos().unit,  it.lpos().unit);
+  ASSERT_EQ_U(end.lpos().index, it.lpos().index);
+}
+
+/**
+ * Sums the local elements of a container by traversing its global range
+ * on runs of native pointers.
+ */
+template <class ContainerT>
+void check_local_runs(ContainerT & container)
+{
+  typedef typename ContainerT::value_type value_t;
+
+  std::fill(container.lbegin(), container.lend(),
+            static_cast<value_t>(dash::myid().id + 1));
+  container.barrier();
+
+  value_t lsum     = 0;
+  size_t  nvisited = 0;
+  auto    it       = container.begin();
+  auto    end      = container.end();
+  while (it != end) {
+    auto n = std::min(it.lrun(), end - it);
+    ASSERT_GT_U(n, 0);
+    auto lptr = it.local();
+    if (lptr != nullptr) {
+      lsum = std::accumulate(lptr, lptr + n, lsum);
+    }
+    nvisited += n;
+    it       += n;
+  }
+  ASSERT_EQ_U(container.size(), nvisited);
+  ASSERT_EQ_U((container.lend() - container.lbegin()) * (dash::myid().id + 1),
+              lsum);
+
+  container.barrier();
+}
+
+TEST_F(GlobIterTest, IncrementBlockPattern)
+{
+  typedef dash::BlockPattern<1>                     pattern_t;
+  typedef dash::Array<int, dash::default_index_t, pattern_t> array_t;
+
+  // BLOCKED with underfilled last block:
+  array_t arr_blocked(dash::size() * 11 - 3);
+  // BLOCKCYCLIC with underfilled last block:
+  array_t arr_cyclic(dash::size() * 17 + 2, dash::BLOCKCYCLIC(5));
+
+  for (int step : { 1, 2, 7 }) {
+    check_traversal(arr_blocked, step);
+    check_traversal(arr_cyclic,  step);
+  }
+}
+
+TEST_F(GlobIterTest, IncrementTilePattern)
+{
+  typedef dash::TilePattern<2, dash::ROW_MAJOR> pattern_row_t;
+  typedef dash::TilePattern<2, dash::COL_MAJOR> pattern_col_t;
+  typedef dash::default_index_t                 index_t;
+
+  auto num_units = dash::size();
+
+  dash::Matrix<int, 2, index_t, pattern_row_t> mat_row(
+    dash::SizeSpec<2>(num_units * 4, num_units * 6),
+    dash::DistributionSpec<2>(dash::TILE(2), dash::TILE(3)),
+    dash::Team::All(),
+    dash::TeamSpec<2>(num_units, 1));
+  dash::Matrix<int, 2, index_t, pattern_col_t> mat_col(
+    dash::SizeSpec<2>(num_units * 6, num_units * 4),
+    dash::DistributionSpec<2>(dash::TILE(3), dash::TILE(2)),
+    dash::Team::All(),
+    dash::TeamSpec<2>(1, num_units));
+
+  for (int step : { 1, 5 }) {
+    check_traversal(mat_row, step);
+    check_traversal(mat_col, step);
+  }
+}
+
+TEST_F(GlobIterTest, IncrementSeqTilePattern)
+{
+  typedef dash::SeqTilePattern<2>  pattern_t;
+  typedef dash::default_index_t    index_t;
+
+  auto num_units = dash::size();
+
+  dash::Matrix<int, 2, index_t, pattern_t> matrix(
+    dash::SizeSpec<2>(num_units * 4, num_units * 6),
+    dash::DistributionSpec<2>(dash::TILE(4), dash::TILE(3)));
+
+  for (int step : { 1, 5 }) {
+    check_traversal(matrix, step);
+  }
+}
+
+TEST_F(GlobIterTest, IncrementBlockPattern2D)
+{
+  typedef dash::BlockPattern<2>   pattern_t;
+  typedef dash::default_index_t   index_t;
+
+  auto num_units = dash::size();
+
+  dash::Matrix<int, 2, index_t, pattern_t> matrix(
+    dash::SizeSpec<2>(num_units * 3 + 1, num_units * 5 + 2),
+    dash::DistributionSpec<2>(dash::BLOCKCYCLIC(2), dash::BLOCKCYCLIC(3)),
+    dash::Team::All(),
+    dash::TeamSpec<2>(1, num_units));
+
+  for (int step : { 1, 4 }) {
+    check_traversal(matrix, step);
+  }
+}
+
+TEST_F(GlobIterTest, LocalRuns)
+{
+  typedef dash::default_index_t index_t;
+
+  auto num_units = dash::size();
+
+  dash::Array<int> array(num_units * 23 + 3, dash::BLOCKCYCLIC(4));
+  check_local_runs(array);
+
+  dash::Matrix<int, 2, index_t, dash::TilePattern<2>> matrix(
+    dash::SizeSpec<2>(num_units * 4, num_units * 6),
+    dash::DistributionSpec<2>(dash::TILE(2), dash::TILE(3)),
+    dash::Team::All(),
+    dash::TeamSpec<2>(num_units, 1));
+  check_local_runs(matrix);
+}
@@ -0,0 +1,21 @@
+#ifndef DASH__TEST__GLOB_ITER_TEST_H_
+#define DASH__TEST__GLOB_ITER_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::GlobIter
+ */
+class GlobIterTest : public dash::test::TestBase {
+protected:
+
+  GlobIterTest() {
+    LOG_MESSAGE(">>> Test suite: GlobIterTest");
+  }
+
+  virtual ~GlobIterTest() {
+    LOG_MESSAGE("<<< Closing test suite: GlobIterTest");
+  }
+};
+
+#endif // DASH__TEST__GLOB_ITER_TEST_H_
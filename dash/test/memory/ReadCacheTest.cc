@@ -0,0 +1,179 @@
+
+#include "ReadCacheTest.h"
+
+#include <dash/ReadCache.h>
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+
+
+TEST_F(ReadCacheTest, HitsAndMisses)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+  const size_t nlocal = 100;
+  dash::Array<int> array(nlocal * dash::size());
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = dash::myid() * 1000 + l;
+  }
+  array.barrier();
+
+  dash::ReadCache<dash::Array<int>> cache(array, 16);
+  EXPECT_EQ_U(16, cache.line_size());
+
+  // Read the block of the next unit twice:
+  auto neighbor = (dash::myid() + 1) % dash::size();
+  for (int r = 0; r < 2; ++r) {
+    for (size_t l = 0; l < nlocal; ++l) {
+      EXPECT_EQ_U(neighbor * 1000 + l, cache[neighbor * nlocal + l]);
+    }
+  }
+  EXPECT_EQ_U(7,   cache.misses());
+  EXPECT_EQ_U(193, cache.hits());
+
+  // Local elements are not cached:
+  cache.reset_stats();
+  for (size_t l = 0; l < nlocal; ++l) {
+    EXPECT_EQ_U(dash::myid() * 1000 + l, cache[dash::myid() * nlocal + l]);
+  }
+  EXPECT_EQ_U(0, cache.misses());
+  EXPECT_EQ_U(0, cache.hits());
+
+  array.barrier();
+}
+
+TEST_F(ReadCacheTest, InvalidateAtBarrier)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+  const size_t nlocal = 32;
+  dash::Array<int> array(nlocal * dash::size());
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = dash::myid();
+  }
+  array.barrier();
+
+  dash::ReadCache<dash::Array<int>> cache(array, 8);
+  auto neighbor = (dash::myid() + 1) % dash::size();
+  for (size_t l = 0; l < nlocal; ++l) {
+    EXPECT_EQ_U(neighbor, cache[neighbor * nlocal + l]);
+  }
+  EXPECT_EQ_U(4, cache.misses());
+
+  array.barrier();
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = dash::myid() + 100;
+  }
+  array.barrier();
+
+  // Cached lines have been fetched before the last barrier:
+  for (size_t l = 0; l < nlocal; ++l) {
+    EXPECT_EQ_U(neighbor + 100, cache[neighbor * nlocal + l]);
+  }
+  EXPECT_EQ_U(8, cache.misses());
+
+  // Collective barrier of the cache:
+  cache.barrier();
+  for (size_t l = 0; l < nlocal; ++l) {
+    EXPECT_EQ_U(neighbor + 100, cache[neighbor * nlocal + l]);
+  }
+  EXPECT_EQ_U(12, cache.misses());
+
+  array.barrier();
+}
+
+TEST_F(ReadCacheTest, Flush)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+  const size_t nlocal = 16;
+  dash::Array<int> array(nlocal * dash::size());
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = l;
+  }
+  array.barrier();
+
+  dash::ReadCache<dash::Array<int>> cache(array);
+  auto neighbor = (dash::myid() + 1) % dash::size();
+  EXPECT_EQ_U(3, cache[neighbor * nlocal + 3]);
+  EXPECT_EQ_U(4, cache[neighbor * nlocal + 4]);
+  EXPECT_EQ_U(1, cache.misses());
+  EXPECT_EQ_U(1, cache.hits());
+
+  cache.flush();
+  EXPECT_EQ_U(4, cache[neighbor * nlocal + 4]);
+  EXPECT_EQ_U(2, cache.misses());
+  EXPECT_EQ_U(1, cache.hits());
+
+  array.barrier();
+}
+
+TEST_F(ReadCacheTest, Eviction)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+  const size_t nlocal = 12;
+  dash::Array<int> array(nlocal * dash::size());
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = l;
+  }
+  array.barrier();
+
+  // Two lines of 4 elements:
+  dash::ReadCache<dash::Array<int>> cache(array, 4, 2);
+  EXPECT_EQ_U(2, cache.num_lines());
+  auto offset = ((dash::myid() + 1) % dash::size()) * nlocal;
+
+  EXPECT_EQ_U(0, cache[offset + 0]);
+  EXPECT_EQ_U(4, cache[offset + 4]);
+  EXPECT_EQ_U(1, cache[offset + 1]);
+  EXPECT_EQ_U(2, cache.misses());
+  EXPECT_EQ_U(1, cache.hits());
+
+  // Evicts the first line:
+  EXPECT_EQ_U(8, cache[offset + 8]);
+  EXPECT_EQ_U(5, cache[offset + 5]);
+  EXPECT_EQ_U(3, cache.misses());
+  EXPECT_EQ_U(2, cache.hits());
+  EXPECT_EQ_U(2, cache[offset + 2]);
+  EXPECT_EQ_U(4, cache.misses());
+
+  array.barrier();
+}
+
+TEST_F(ReadCacheTest, IteratorAccess)
+{
+  typedef dash::TilePattern<2>       pattern_t;
+  typedef dash::Matrix<double, 2, dash::default_index_t, pattern_t>
+    matrix_t;
+
+  auto num_units = dash::size();
+  const size_t tile_ext = 4;
+  const size_t extent   = tile_ext * num_units;
+  matrix_t matrix(
+    dash::SizeSpec<2>(extent, extent),
+    dash::DistributionSpec<2>(dash::TILE(tile_ext), dash::TILE(tile_ext)));
+
+  if (dash::myid() == 0) {
+    for (size_t g = 0; g < matrix.size(); ++g) {
+      matrix.begin()[g] = static_cast<double>(g);
+    }
+  }
+  matrix.barrier();
+
+  dash::ReadCache<matrix_t> cache(matrix, tile_ext * tile_ext);
+  size_t g = 0;
+  for (auto it = matrix.begin(); it != matrix.end(); ++it, ++g) {
+    EXPECT_EQ_U(static_cast<double>(g), cache.get(it));
+    EXPECT_EQ_U(static_cast<double>(g), cache[g]);
+  }
+  // One miss per remote tile:
+  size_t num_tiles_remote = (matrix.size() - matrix.local_size()) /
+                            (tile_ext * tile_ext);
+  EXPECT_EQ_U(num_tiles_remote, cache.misses());
+
+  matrix.barrier();
+}
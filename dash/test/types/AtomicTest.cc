@@ -4,6 +4,7 @@
 #include <dash/Atomic.h>
 #include <dash/Array.h>
 #include <dash/Mutex.h>
+#include <dash/SharedMutex.h>
 #include <dash/Matrix.h>
 #include <dash/Shared.h>
 
@@ -15,6 +16,9 @@
 #include "AtomicTest.h"
 
 #include <vector>
+#if __cplusplus >= 201402L
+#include <shared_mutex>
+#endif
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
@@ -52,6 +56,39 @@ TEST_F(AtomicTest, FetchAndOp)
 }
 
 
+TEST_F(AtomicTest, FetchAndOpAsync)
+{
+  typedef size_t value_t;
+
+  value_t           val_init  = 100;
+  dash::team_unit_t owner(dash::size() - 1);
+
+  dash::Shared< dash::Atomic<value_t> > shared(owner);
+
+  if (dash::myid() == 0) {
+    shared.set(val_init);
+  }
+  // wait for initialization:
+  shared.barrier();
+
+  auto fut = shared.get().fetch_add_async(2);
+  shared.get().add_async(1);
+  // previous value returned by the fetching operation:
+  value_t prev = fut.get();
+  EXPECT_GE_U(prev, val_init);
+  EXPECT_LE_U(prev, val_init + (dash::size() * 3) - 2);
+  shared.get().flush();
+  // wait for completion of all atomic operations:
+  shared.barrier();
+
+  // incremented by 3 by every unit:
+  value_t val_expect   = val_init + (dash::size() * 3);
+  value_t s_val_actual = shared.get();
+  EXPECT_EQ_U(val_expect, s_val_actual);
+
+  dash::barrier();
+}
+
 TEST_F(AtomicTest, CompareExchange)
 {
   typedef size_t value_t;
@@ -478,6 +515,49 @@ TEST_F(AtomicTest, MutexInterface){
   }
 }
 
+TEST_F(AtomicTest, SharedMutexInterface){
+  dash::SharedMutex mx;
+
+  dash::Shared<int> shared(dash::team_unit_t{0});
+
+  if(dash::myid() == 0){
+    shared.set(0);
+  }
+
+  dash::barrier();
+
+  {
+    std::lock_guard<dash::SharedMutex> lg(mx);
+    int tmp = shared.get();
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    shared.set(tmp + 1);
+  }
+
+  dash::barrier();
+
+  // shared ownership by all units at once
+  mx.lock_shared();
+  EXPECT_EQ_U(static_cast<int>(dash::size()), shared.get());
+  EXPECT_FALSE_U(mx.try_lock());
+  dash::barrier();
+  mx.unlock_shared();
+
+  while(!mx.try_lock_shared()){  }
+  EXPECT_EQ_U(static_cast<int>(dash::size()), shared.get());
+  mx.unlock_shared();
+
+  dash::barrier();
+
+#if __cplusplus >= 201402L
+  // this even works with std::shared_lock
+  {
+    std::shared_lock<dash::SharedMutex> sl(mx);
+    EXPECT_EQ_U(static_cast<int>(dash::size()), shared.get());
+  }
+  dash::barrier();
+#endif
+}
+
 
 TEST_F(AtomicTest, AtomicSignal){
   using value_t = int;